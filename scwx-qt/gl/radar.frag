@@ -8,6 +8,7 @@ uniform uint uDataMomentOffset;
 uniform float uDataMomentScale;
 
 uniform bool uCFPEnabled;
+uniform bool uMaskZeroDataMoment;
 
 flat in uint dataMoment;
 flat in uint cfpMoment;
@@ -16,6 +17,12 @@ layout (location = 0) out vec4 fragColor;
 
 void main()
 {
+   // A data moment of 0 masks a bin below threshold
+   if (uMaskZeroDataMoment && dataMoment == 0u)
+   {
+      discard;
+   }
+
    float texCoord = float(dataMoment - uDataMomentOffset) / uDataMomentScale;
 
    if (uCFPEnabled && cfpMoment > 8u)
@@ -11,6 +11,7 @@
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/types/qt_types.hpp>
 #include <scwx/qt/ui/setup/setup_wizard.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/network/cpr.hpp>
 #include <scwx/util/environment.hpp>
 #include <scwx/util/logger.hpp>
@@ -117,6 +118,18 @@ int main(int argc, char* argv[])
          QString::fromStdString(scwx::qt::types::GetUiStyleName(uiStyle)));
    }
 
+   // Radar projection
+   auto& fastRadialProjection =
+      scwx::qt::settings::GeneralSettings::Instance().fast_radial_projection();
+   auto  setProjectionMode = [](const bool& fast)
+   {
+      scwx::qt::util::GeographicLib::SetProjectionMode(
+         fast ? scwx::qt::util::GeographicLib::ProjectionMode::Fast :
+                scwx::qt::util::GeographicLib::ProjectionMode::Exact);
+   };
+   setProjectionMode(fastRadialProjection.GetValue());
+   fastRadialProjection.RegisterValueChangedCallback(setProjectionMode);
+
    // Run initial setup if required
    if (scwx::qt::ui::setup::SetupWizard::IsSetupRequired())
    {
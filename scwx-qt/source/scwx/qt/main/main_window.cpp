@@ -22,6 +22,7 @@
 #include <scwx/qt/ui/alert_dock_widget.hpp>
 #include <scwx/qt/ui/animation_dock_widget.hpp>
 #include <scwx/qt/ui/collapsible_group.hpp>
+#include <scwx/qt/ui/cross_section_dialog.hpp>
 #include <scwx/qt/ui/flow_layout.hpp>
 #include <scwx/qt/ui/gps_info_dialog.hpp>
 #include <scwx/qt/ui/imgui_debug_dialog.hpp>
@@ -46,7 +47,9 @@
 #include <QDesktopServices>
 #include <QKeyEvent>
 #include <QFileDialog>
+#include <QInputDialog>
 #include <QMessageBox>
+#include <QRegularExpression>
 #include <QSplitter>
 #include <QStandardPaths>
 #include <QTimer>
@@ -86,6 +89,7 @@ public:
        alertDockWidget_ {nullptr},
        animationDockWidget_ {nullptr},
        aboutDialog_ {nullptr},
+       crossSectionDialog_ {nullptr},
        gpsInfoDialog_ {nullptr},
        imGuiDebugDialog_ {nullptr},
        layerDialog_ {nullptr},
@@ -192,6 +196,7 @@ public:
    ui::AlertDockWidget*     alertDockWidget_;
    ui::AnimationDockWidget* animationDockWidget_;
    ui::AboutDialog*         aboutDialog_;
+   ui::CrossSectionDialog*  crossSectionDialog_;
    ui::GpsInfoDialog*       gpsInfoDialog_;
    ui::ImGuiDebugDialog*    imGuiDebugDialog_;
    ui::LayerDialog*         layerDialog_;
@@ -267,6 +272,9 @@ MainWindow::MainWindow(QWidget* parent) :
    p->alertDockWidget_->setVisible(false);
    addDockWidget(Qt::BottomDockWidgetArea, p->alertDockWidget_);
 
+   // Cross Section Dialog
+   p->crossSectionDialog_ = new ui::CrossSectionDialog(this);
+
    // GPS Info Dialog
    p->gpsInfoDialog_ = new ui::GpsInfoDialog(this);
 
@@ -576,6 +584,38 @@ void MainWindow::on_actionLayerManager_triggered()
    p->layerDialog_->show();
 }
 
+void MainWindow::on_actionRadarMosaic_triggered()
+{
+   bool    ok;
+   QString text = QInputDialog::getText(
+      this,
+      tr("Radar Mosaic"),
+      tr("Additional radar sites (e.g., KLOT, KILX):"),
+      QLineEdit::EchoMode::Normal,
+      {},
+      &ok);
+
+   if (!ok)
+   {
+      return;
+   }
+
+   std::vector<std::string> radarIds {};
+   for (const QString& id : text.split(QRegularExpression {"[,\\s]+"},
+                                       Qt::SplitBehaviorFlags::SkipEmptyParts))
+   {
+      radarIds.push_back(id.toUpper().toStdString());
+   }
+
+   if (radarIds.empty())
+   {
+      return;
+   }
+
+   // The mosaic is combined with the current radar site of the active map
+   p->activeMap_->SelectRadarMosaic(radarIds);
+}
+
 void MainWindow::on_actionImGuiDebug_triggered()
 {
    p->imGuiDebugDialog_->show();
@@ -860,6 +900,24 @@ void MainWindowImpl::ConnectMapSignals()
          },
          Qt::QueuedConnection);
 
+      connect(mapWidget,
+              &map::MapWidget::CrossSectionRequested,
+              this,
+              [&](common::Coordinate start, common::Coordinate end)
+              {
+                 auto radarSite = mapWidget->GetRadarSite();
+
+                 if (radarSite != nullptr)
+                 {
+                    crossSectionDialog_->SelectCrossSection(
+                       manager::RadarProductManager::Instance(radarSite->id()),
+                       mapWidget->GetSelectedTime(),
+                       start,
+                       end);
+                    crossSectionDialog_->show();
+                 }
+              });
+
       connect(
          mapWidget,
          &map::MapWidget::Level3ProductsChanged,
@@ -1277,6 +1335,11 @@ void MainWindowImpl::SelectRadarProduct(map::MapWidget*           mapWidget,
    }
 
    mapWidget->SelectRadarProduct(group, productName, productCode, volumeTime_);
+
+   if (group == common::RadarProductGroup::Level3)
+   {
+      timelineManager_->LoadLevel3Loop(productName);
+   }
 }
 
 void MainWindowImpl::SetActiveMap(map::MapWidget* mapWidget)
@@ -44,6 +44,7 @@ private slots:
    void on_actionRadarSites_triggered(bool checked);
    void on_actionPlacefileManager_triggered();
    void on_actionLayerManager_triggered();
+   void on_actionRadarMosaic_triggered();
    void on_actionImGuiDebug_triggered();
    void on_actionDumpLayerList_triggered();
    void on_actionDumpRadarProductRecords_triggered();
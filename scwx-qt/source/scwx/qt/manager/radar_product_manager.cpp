@@ -4,15 +4,20 @@
 #include <scwx/qt/types/time_types.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/constants.hpp>
+#include <scwx/provider/level2_chunks_data_provider.hpp>
 #include <scwx/provider/nexrad_data_provider_factory.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/map.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 
+#include <cmath>
 #include <deque>
 #include <execution>
+#include <map>
 #include <mutex>
+#include <numbers>
+#include <set>
 #include <shared_mutex>
 #include <unordered_set>
 
@@ -27,7 +32,7 @@
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
 #include <fmt/chrono.h>
-#include <qmaplibre.hpp>
+#include <GeographicLib/GeodesicLine.hpp>
 
 #if defined(_MSC_VER)
 #   pragma warning(pop)
@@ -44,7 +49,8 @@ static const std::string logPrefix_ =
    "scwx::qt::manager::radar_product_manager";
 static const auto logger_ = scwx::util::Logger::Create(logPrefix_);
 
-typedef std::function<std::shared_ptr<wsr88d::NexradFile>()>
+typedef std::function<std::shared_ptr<wsr88d::NexradFile>(
+   const wsr88d::NexradFileFactory::PreloadFunction& preload)>
    CreateNexradFileFunction;
 typedef std::map<std::chrono::system_clock::time_point,
                  std::weak_ptr<types::RadarProductRecord>>
@@ -66,6 +72,16 @@ static const std::string kDefaultLevel3Product_ {"N0B"};
 static constexpr std::chrono::seconds kFastRetryInterval_ {15};
 static constexpr std::chrono::seconds kSlowRetryInterval_ {120};
 
+// Chunks of the volume in progress are published every few seconds, if
+// enabled
+static constexpr std::chrono::seconds kChunksRetryInterval_ {5};
+
+static constexpr std::size_t kMaxConcurrentLevel3Loads_ {8u};
+
+static constexpr std::size_t  kCoordinatesCacheLimit_ {8u};
+static constexpr float        kAzimuthQuantization_ {100.0f}; // 0.01 degrees
+static constexpr std::int32_t kAzimuthQuantizedCircle_ {36000};
+
 static std::unordered_map<std::string, std::weak_ptr<RadarProductManager>>
                          instanceMap_;
 static std::shared_mutex instanceMutex_;
@@ -119,6 +135,7 @@ public:
    boost::asio::steady_timer                     refreshTimer_;
    std::mutex                                    refreshTimerMutex_;
    std::shared_ptr<provider::NexradDataProvider> provider_;
+   std::chrono::milliseconds fastRetryInterval_ {kFastRetryInterval_};
 
 signals:
    void NewDataAvailable(common::RadarProductGroup             group,
@@ -126,6 +143,88 @@ signals:
                          std::chrono::system_clock::time_point latestTime);
 };
 
+struct RadialCoordinatesKey
+{
+   std::vector<std::int32_t>           azimuths_ {}; // Quantized azimuths
+   std::uint16_t                       rangeBins_ {0};
+   util::GeographicLib::ProjectionMode projectionMode_ {};
+
+   auto operator<=>(const RadialCoordinatesKey&) const = default;
+};
+
+struct CoordinatesCacheEntry
+{
+   std::shared_ptr<const std::vector<float>> coordinates_ {};
+   std::size_t                               lastUsed_ {0};
+};
+
+/**
+ * @brief A least recently used cache of projected coordinates. Coordinates are
+ * calculated outside of the cache mutex, so a lookup is not blocked by the
+ * calculation of other coordinates.
+ */
+template<class Key>
+class CoordinatesCache
+{
+public:
+   std::shared_ptr<const std::vector<float>> Find(const Key& key)
+   {
+      std::unique_lock lock {mutex_};
+
+      auto it = entries_.find(key);
+      if (it != entries_.end())
+      {
+         it->second.lastUsed_ = ++useCount_;
+         return it->second.coordinates_;
+      }
+
+      return nullptr;
+   }
+
+   std::shared_ptr<const std::vector<float>>
+   Store(const Key& key, std::shared_ptr<const std::vector<float>> coordinates)
+   {
+      std::unique_lock lock {mutex_};
+
+      // If the same coordinates were calculated concurrently, share the
+      // coordinates which were stored first
+      auto it = entries_.find(key);
+      if (it != entries_.end())
+      {
+         it->second.lastUsed_ = ++useCount_;
+         return it->second.coordinates_;
+      }
+
+      // Evict the least recently used coordinates when the cache is full. Views
+      // hold their own references, so evicted coordinates remain valid.
+      if (entries_.size() >= kCoordinatesCacheLimit_)
+      {
+         entries_.erase(std::min_element(
+            entries_.begin(),
+            entries_.end(),
+            [](const auto& a, const auto& b)
+            { return a.second.lastUsed_ < b.second.lastUsed_; }));
+      }
+
+      entries_.emplace(key, CoordinatesCacheEntry {coordinates, ++useCount_});
+
+      return coordinates;
+   }
+
+private:
+   std::map<Key, CoordinatesCacheEntry> entries_ {};
+   std::size_t                          useCount_ {0};
+   std::mutex                           mutex_ {};
+};
+
+struct Level2VolumeEntry
+{
+   std::weak_ptr<wsr88d::Ar2vFile>            file_ {};
+   std::chrono::system_clock::time_point      scanTime_ {};
+   std::chrono::system_clock::time_point      endTime_ {};
+   std::shared_ptr<const wsr88d::VolumeIndex> index_ {nullptr};
+};
+
 class RadarProductManagerImpl
 {
 public:
@@ -146,6 +245,8 @@ public:
        level3ProductRecordMutex_ {},
        level2ProviderManager_ {std::make_shared<ProviderManager>(
           self_, radarId_, common::RadarProductGroup::Level2)},
+       level2ChunksProviderManager_ {std::make_shared<ProviderManager>(
+          self_, radarId_, common::RadarProductGroup::Level2, "Chunks")},
        level3ProviderManagerMap_ {},
        level3ProviderManagerMutex_ {},
        initializeMutex_ {},
@@ -163,10 +264,26 @@ public:
 
       level2ProviderManager_->provider_ =
          provider::NexradDataProviderFactory::CreateLevel2DataProvider(radarId);
+      level2ChunksProviderManager_->provider_ =
+         provider::NexradDataProviderFactory::CreateLevel2ChunksDataProvider(
+            radarId);
+      level2ChunksProviderManager_->fastRetryInterval_ = kChunksRetryInterval_;
+
+      level2ChunksCallbackUuid_ =
+         settings::GeneralSettings::Instance()
+            .level2_chunks_enabled()
+            .RegisterValueChangedCallback(
+               [this](const bool& enabled)
+               { UpdateLevel2ChunksRefresh(enabled); });
    }
    ~RadarProductManagerImpl()
    {
+      settings::GeneralSettings::Instance()
+         .level2_chunks_enabled()
+         .UnregisterValueChangedCallback(level2ChunksCallbackUuid_);
+
       level2ProviderManager_->Disable();
+      level2ChunksProviderManager_->Disable();
 
       std::shared_lock lock(level3ProviderManagerMutex_);
       std::for_each(std::execution::par_unseq,
@@ -182,6 +299,10 @@ public:
       std::unique_lock loadLevel2DataLock {loadLevel2DataMutex_};
       std::unique_lock loadLevel3DataLock {loadLevel3DataMutex_};
 
+      // Batch loads which have not started are abandoned
+      level3BatchThreadPool_.stop();
+      level3BatchThreadPool_.join();
+
       threadPool_.join();
    }
 
@@ -189,13 +310,28 @@ public:
 
    boost::asio::thread_pool threadPool_ {4u};
 
+   // Batch loads are not serialized by a load data mutex, and the number of
+   // threads limits the number of files in flight
+   boost::asio::thread_pool level3BatchThreadPool_ {kMaxConcurrentLevel3Loads_};
+
    std::shared_ptr<ProviderManager>
    GetLevel3ProviderManager(const std::string& product);
 
+   void InitializeCoordinates();
+
    void EnableRefresh(boost::uuids::uuid               uuid,
                       std::shared_ptr<ProviderManager> providerManager,
                       bool                             enabled);
+   void EnableLevel2ChunksRefresh(boost::uuids::uuid uuid, bool enabled);
+   void UpdateLevel2ChunksRefresh(bool chunksEnabled);
    void RefreshData(std::shared_ptr<ProviderManager> providerManager);
+   void PublishLevel2ElevationScans();
+
+   void
+   LoadLevel3DataBatchItem(std::shared_ptr<ProviderManager> providerManager,
+                           std::chrono::system_clock::time_point time);
+   bool IsLevel3DataLoaded(const std::string&                    product,
+                           std::chrono::system_clock::time_point time);
 
    std::tuple<std::shared_ptr<types::RadarProductRecord>,
               std::chrono::system_clock::time_point>
@@ -206,6 +342,8 @@ public:
                           std::chrono::system_clock::time_point time);
    std::shared_ptr<types::RadarProductRecord>
    StoreRadarProductRecord(std::shared_ptr<types::RadarProductRecord> record);
+   void RemoveRadarProductRecord(
+      const std::shared_ptr<types::RadarProductRecord>& record);
    void UpdateRecentRecords(RadarProductRecordList& recentList,
                             std::shared_ptr<types::RadarProductRecord> record);
 
@@ -236,6 +374,24 @@ public:
                   const std::shared_ptr<request::NexradFileRequest>& request,
                   std::mutex&                                        mutex,
                   std::chrono::system_clock::time_point              time = {});
+   // Record stored before its volume has completed loading
+   struct PreloadedRecord
+   {
+      std::weak_ptr<types::RadarProductRecord> record_ {};
+      std::weak_ptr<RadarProductManager>       manager_ {};
+   };
+
+   static void PreloadLevel2File(
+      const std::shared_ptr<wsr88d::Ar2vFile>&           level2File,
+      const std::shared_ptr<request::NexradFileRequest>& request,
+      std::chrono::system_clock::time_point              time,
+      const std::shared_ptr<PreloadedRecord>&            preloadedRecord);
+   static std::tuple<std::shared_ptr<types::RadarProductRecord>,
+                     std::shared_ptr<RadarProductManager>>
+   StoreNexradFile(
+      const std::shared_ptr<wsr88d::NexradFile>&         nexradFile,
+      const std::shared_ptr<request::NexradFileRequest>& request,
+      std::chrono::system_clock::time_point              time);
 
    const std::string radarId_;
    bool              initialized_;
@@ -244,8 +400,21 @@ public:
    std::shared_ptr<config::RadarSite> radarSite_;
    std::size_t                        cacheLimit_ {6u};
 
-   std::vector<float> coordinates0_5Degree_;
-   std::vector<float> coordinates1Degree_;
+   std::shared_ptr<const std::vector<float>> coordinates0_5Degree_;
+   std::shared_ptr<const std::vector<float>> coordinates1Degree_;
+   util::GeographicLib::ProjectionMode       coordinatesProjectionMode_ {
+      util::GeographicLib::ProjectionMode::Exact};
+
+   CoordinatesCache<RadarProductManager::RasterGrid> rasterCoordinates_ {};
+   CoordinatesCache<RadialCoordinatesKey>            radialCoordinates_ {};
+
+   std::map<wsr88d::rda::DataBlockType, Level2VolumeEntry>
+              level2Volumes_ {};
+   std::mutex level2VolumesMutex_ {};
+
+   std::weak_ptr<const wsr88d::VolumeIndex>       derivedProductsVolume_ {};
+   std::shared_ptr<const wsr88d::DerivedProducts> derivedProducts_ {nullptr};
+   std::mutex                                     derivedProductsMutex_ {};
 
    RadarProductRecordMap  level2ProductRecords_;
    RadarProductRecordList level2ProductRecentRecords_;
@@ -257,6 +426,7 @@ public:
    std::shared_mutex level3ProductRecordMutex_;
 
    std::shared_ptr<ProviderManager> level2ProviderManager_;
+   std::shared_ptr<ProviderManager> level2ChunksProviderManager_;
    std::unordered_map<std::string, std::shared_ptr<ProviderManager>>
                      level3ProviderManagerMap_;
    std::shared_mutex level3ProviderManagerMutex_;
@@ -274,6 +444,17 @@ public:
                       boost::hash<boost::uuids::uuid>>
                      refreshMap_ {};
    std::shared_mutex refreshMapMutex_ {};
+
+   // Level 3 files queued by batch loads. A queued file is not queued again
+   // until its load has completed.
+   std::set<std::pair<std::string, std::chrono::system_clock::time_point>>
+              level3BatchPending_ {};
+   std::mutex level3BatchPendingMutex_ {};
+
+   // Level 2 refresh also follows the real-time chunk feed, if enabled
+   std::unordered_set<boost::uuids::uuid, boost::hash<boost::uuids::uuid>>
+                      level2ChunksRefreshSet_ {};
+   boost::uuids::uuid level2ChunksCallbackUuid_ {};
 };
 
 RadarProductManager::RadarProductManager(const std::string& radarId) :
@@ -286,7 +467,7 @@ std::string ProviderManager::name() const
 {
    std::string name;
 
-   if (group_ == common::RadarProductGroup::Level3)
+   if (group_ == common::RadarProductGroup::Level3 || product_ != "???")
    {
       name = fmt::format("{}, {}, {}",
                          radarId_,
@@ -379,9 +560,13 @@ void RadarProductManager::DumpRecords()
       });
 }
 
-const std::vector<float>&
+std::shared_ptr<const std::vector<float>>
 RadarProductManager::coordinates(common::RadialSize radialSize) const
 {
+   std::unique_lock lock {p->initializeMutex_};
+
+   p->InitializeCoordinates();
+
    switch (radialSize)
    {
    case common::RadialSize::_0_5Degree:
@@ -440,7 +625,16 @@ void RadarProductManager::Initialize()
 {
    std::unique_lock lock {p->initializeMutex_};
 
-   if (p->initialized_)
+   p->InitializeCoordinates();
+}
+
+void RadarProductManagerImpl::InitializeCoordinates()
+{
+   const util::GeographicLib::ProjectionMode projectionMode =
+      util::GeographicLib::GetProjectionMode();
+
+   // The fixed coordinate grids are rebuilt when the projection mode changes
+   if (initialized_ && coordinatesProjectionMode_ == projectionMode)
    {
       return;
    }
@@ -449,89 +643,223 @@ void RadarProductManager::Initialize()
 
    boost::timer::cpu_timer timer;
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
-
-   const QMapLibre::Coordinate radar(p->radarSite_->latitude(),
-                                     p->radarSite_->longitude());
+   const common::Coordinate radar {radarSite_->latitude(),
+                                   radarSite_->longitude()};
 
-   const float gateSize = gate_size();
+   const units::length::meters<double> gateSize {self_->gate_size()};
 
    // Calculate half degree azimuth coordinates
    timer.start();
-   std::vector<float>& coordinates0_5Degree = p->coordinates0_5Degree_;
+   auto coordinates0_5Degree =
+      std::make_shared<std::vector<float>>(NUM_COORIDNATES_0_5_DEGREE);
+
+   auto radials0_5Degree =
+      boost::irange<uint32_t>(0, common::MAX_0_5_DEGREE_RADIALS);
+
+   std::for_each(
+      std::execution::par_unseq,
+      radials0_5Degree.begin(),
+      radials0_5Degree.end(),
+      [&](uint32_t radial)
+      {
+         const float angle = radial * 0.5f; // 0.5 degree radial
+
+         util::GeographicLib::GetRadialCoordinates(
+            radar,
+            units::angle::degrees<double> {angle},
+            gateSize,
+            gateSize,
+            std::span {*coordinates0_5Degree}.subspan(
+               radial * common::MAX_DATA_MOMENT_GATES * 2,
+               common::MAX_DATA_MOMENT_GATES * 2),
+            projectionMode);
+      });
+   timer.stop();
+   logger_->debug("Coordinates (0.5 degree) calculated in {}",
+                  timer.format(6, "%ws"));
 
-   coordinates0_5Degree.resize(NUM_COORIDNATES_0_5_DEGREE);
+   // Calculate 1 degree azimuth coordinates
+   timer.start();
+   auto coordinates1Degree =
+      std::make_shared<std::vector<float>>(NUM_COORIDNATES_1_DEGREE);
 
-   auto radialGates0_5Degree =
-      boost::irange<uint32_t>(0, NUM_RADIAL_GATES_0_5_DEGREE);
+   auto radials1Degree =
+      boost::irange<uint32_t>(0, common::MAX_1_DEGREE_RADIALS);
 
    std::for_each(
       std::execution::par_unseq,
-      radialGates0_5Degree.begin(),
-      radialGates0_5Degree.end(),
-      [&](uint32_t radialGate)
+      radials1Degree.begin(),
+      radials1Degree.end(),
+      [&](uint32_t radial)
       {
-         const uint16_t gate =
-            static_cast<uint16_t>(radialGate % common::MAX_DATA_MOMENT_GATES);
-         const uint16_t radial =
-            static_cast<uint16_t>(radialGate / common::MAX_DATA_MOMENT_GATES);
+         const float angle = radial * 1.0f; // 1 degree radial
+
+         util::GeographicLib::GetRadialCoordinates(
+            radar,
+            units::angle::degrees<double> {angle},
+            gateSize,
+            gateSize,
+            std::span {*coordinates1Degree}.subspan(
+               radial * common::MAX_DATA_MOMENT_GATES * 2,
+               common::MAX_DATA_MOMENT_GATES * 2),
+            projectionMode);
+      });
+   timer.stop();
+   logger_->debug("Coordinates (1 degree) calculated in {}",
+                  timer.format(6, "%ws"));
 
-         const float  angle  = radial * 0.5f; // 0.5 degree radial
-         const float  range  = (gate + 1) * gateSize;
-         const size_t offset = radialGate * 2;
+   coordinates0_5Degree_      = std::move(coordinates0_5Degree);
+   coordinates1Degree_        = std::move(coordinates1Degree);
+   coordinatesProjectionMode_ = projectionMode;
+   initialized_               = true;
+}
 
-         double latitude;
-         double longitude;
+std::shared_ptr<const std::vector<float>>
+RadarProductManager::GetRadialCoordinates(std::span<const float> azimuths,
+                                          std::uint16_t          rangeBins)
+{
+   RadialCoordinatesKey key {};
+   key.rangeBins_      = std::min<std::uint16_t>(rangeBins,
+                                                 common::MAX_DATA_MOMENT_GATES);
+   key.projectionMode_ = util::GeographicLib::GetProjectionMode();
+   key.azimuths_.reserve(azimuths.size());
+
+   for (float azimuth : azimuths)
+   {
+      std::int32_t quantizedAzimuth =
+         static_cast<std::int32_t>(
+            std::lroundf(azimuth * kAzimuthQuantization_)) %
+         kAzimuthQuantizedCircle_;
+      if (quantizedAzimuth < 0)
+      {
+         quantizedAzimuth += kAzimuthQuantizedCircle_;
+      }
+      key.azimuths_.push_back(quantizedAzimuth);
+   }
+
+   auto cachedCoordinates = p->radialCoordinates_.Find(key);
+   if (cachedCoordinates != nullptr)
+   {
+      return cachedCoordinates;
+   }
+
+   boost::timer::cpu_timer timer;
+
+   const common::Coordinate radar {p->radarSite_->latitude(),
+                                   p->radarSite_->longitude()};
+
+   const units::length::meters<double> gateSize {gate_size()};
+
+   const std::uint32_t numRadials =
+      static_cast<std::uint32_t>(key.azimuths_.size());
 
-         geodesic.Direct(
-            radar.first, radar.second, angle, range, latitude, longitude);
+   auto coordinates = std::make_shared<std::vector<float>>();
+   coordinates->resize(static_cast<std::size_t>(numRadials) *
+                       common::MAX_DATA_MOMENT_GATES * 2);
 
-         coordinates0_5Degree[offset]     = latitude;
-         coordinates0_5Degree[offset + 1] = longitude;
+   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
+
+   timer.start();
+
+   std::for_each(
+      std::execution::par_unseq,
+      radials.begin(),
+      radials.end(),
+      [&](std::uint32_t radial)
+      {
+         const double angle =
+            key.azimuths_[radial] / static_cast<double>(kAzimuthQuantization_);
+
+         util::GeographicLib::GetRadialCoordinates(
+            radar,
+            units::angle::degrees<double> {angle},
+            gateSize,
+            gateSize,
+            std::span {*coordinates}.subspan(
+               static_cast<std::size_t>(radial) *
+                  common::MAX_DATA_MOMENT_GATES * 2,
+               static_cast<std::size_t>(key.rangeBins_) * 2),
+            key.projectionMode_);
       });
+
    timer.stop();
-   logger_->debug("Coordinates (0.5 degree) calculated in {}",
+   logger_->debug("Radial coordinates ({} radials) calculated in {}",
+                  numRadials,
                   timer.format(6, "%ws"));
 
-   // Calculate 1 degree azimuth coordinates
-   timer.start();
-   std::vector<float>& coordinates1Degree = p->coordinates1Degree_;
+   return p->radialCoordinates_.Store(key, coordinates);
+}
 
-   coordinates1Degree.resize(NUM_COORIDNATES_1_DEGREE);
+std::shared_ptr<const std::vector<float>>
+RadarProductManager::GetRasterCoordinates(const RasterGrid& rasterGrid)
+{
+   auto cachedCoordinates = p->rasterCoordinates_.Find(rasterGrid);
+   if (cachedCoordinates != nullptr)
+   {
+      return cachedCoordinates;
+   }
+
+   boost::timer::cpu_timer timer;
+
+   const GeographicLib::Geodesic& geodesic =
+      util::GeographicLib::DefaultGeodesic();
+
+   const std::uint32_t rowCoordinates    = rasterGrid.rows_ + 1u;
+   const std::uint32_t columnCoordinates = rasterGrid.columns_ + 1u;
 
-   auto radialGates1Degree =
-      boost::irange<uint32_t>(0, NUM_RADIAL_GATES_1_DEGREE);
+   const double iCoordinate =
+      (-rasterGrid.iCoordinateStart_ - 1.0 - rasterGrid.range_) * 1000.0;
+   const double jCoordinate =
+      (rasterGrid.jCoordinateStart_ + 1.0 + rasterGrid.range_) * 1000.0;
+
+   const std::uint32_t numCoordinates = rowCoordinates * columnCoordinates;
+   auto coordinateRange = boost::irange<std::uint32_t>(0, numCoordinates);
+
+   auto coordinates = std::make_shared<std::vector<float>>();
+   coordinates->resize(static_cast<std::size_t>(numCoordinates) * 2);
+
+   timer.start();
 
    std::for_each(
       std::execution::par_unseq,
-      radialGates1Degree.begin(),
-      radialGates1Degree.end(),
-      [&](uint32_t radialGate)
+      coordinateRange.begin(),
+      coordinateRange.end(),
+      [&](std::uint32_t index)
       {
-         const uint16_t gate =
-            static_cast<uint16_t>(radialGate % common::MAX_DATA_MOMENT_GATES);
-         const uint16_t radial =
-            static_cast<uint16_t>(radialGate / common::MAX_DATA_MOMENT_GATES);
+         // For each row or column, there is one additional coordinate. Each bin
+         // is bounded by 4 coordinates.
+         const std::uint32_t col = index % columnCoordinates;
+         const std::uint32_t row = index / columnCoordinates;
+
+         const double i = iCoordinate + rasterGrid.xResolution_ * col;
+         const double j = jCoordinate - rasterGrid.yResolution_ * row;
 
-         const float  angle  = radial * 1.0f; // 1 degree radial
-         const float  range  = (gate + 1) * gateSize;
-         const size_t offset = radialGate * 2;
+         // Calculate polar coordinates based on i and j
+         const double angle  = std::atan2(i, j) * 180.0 / std::numbers::pi;
+         const double range  = std::sqrt(i * i + j * j);
+         const size_t offset = static_cast<size_t>(index) * 2;
 
          double latitude;
          double longitude;
 
-         geodesic.Direct(
-            radar.first, radar.second, angle, range, latitude, longitude);
+         geodesic.Direct(rasterGrid.latitude_,
+                         rasterGrid.longitude_,
+                         angle,
+                         range,
+                         latitude,
+                         longitude);
 
-         coordinates1Degree[offset]     = latitude;
-         coordinates1Degree[offset + 1] = longitude;
+         (*coordinates)[offset]     = static_cast<float>(latitude);
+         (*coordinates)[offset + 1] = static_cast<float>(longitude);
       });
+
    timer.stop();
-   logger_->debug("Coordinates (1 degree) calculated in {}",
+   logger_->debug("Raster coordinates ({}x{}) calculated in {}",
+                  rasterGrid.rows_,
+                  rasterGrid.columns_,
                   timer.format(6, "%ws"));
 
-   p->initialized_ = true;
+   return p->rasterCoordinates_.Store(rasterGrid, coordinates);
 }
 
 std::shared_ptr<ProviderManager>
@@ -565,9 +893,13 @@ void RadarProductManager::EnableRefresh(common::RadarProductGroup group,
    if (group == common::RadarProductGroup::Level2)
    {
       p->EnableRefresh(uuid, p->level2ProviderManager_, enabled);
+      p->EnableLevel2ChunksRefresh(uuid, enabled);
    }
    else
    {
+      // Refreshing a Level 3 product replaces any Level 2 refresh
+      p->EnableLevel2ChunksRefresh(uuid, false);
+
       std::shared_ptr<ProviderManager> providerManager =
          p->GetLevel3ProviderManager(product);
 
@@ -654,6 +986,52 @@ void RadarProductManagerImpl::EnableRefresh(
    }
 }
 
+void RadarProductManagerImpl::EnableLevel2ChunksRefresh(
+   boost::uuids::uuid uuid, bool enabled)
+{
+   {
+      std::unique_lock lock {refreshMapMutex_};
+
+      // The archive provider lags the radar by a full volume scan. The chunk
+      // feed is refreshed while any Level 2 refresh is enabled, so elevation
+      // scans of the volume in progress are available as soon as they are
+      // complete.
+      if (enabled)
+      {
+         level2ChunksRefreshSet_.insert(uuid);
+      }
+      else
+      {
+         level2ChunksRefreshSet_.erase(uuid);
+      }
+   }
+
+   UpdateLevel2ChunksRefresh(
+      settings::GeneralSettings::Instance().level2_chunks_enabled().GetValue());
+}
+
+void RadarProductManagerImpl::UpdateLevel2ChunksRefresh(bool chunksEnabled)
+{
+   // The chunk feed is polled every few seconds, so it is only followed if
+   // enabled in the settings
+   std::unique_lock lock {refreshMapMutex_};
+   const bool       refresh = chunksEnabled && !level2ChunksRefreshSet_.empty();
+   lock.unlock();
+
+   if (!refresh)
+   {
+      if (level2ChunksProviderManager_->refreshEnabled_)
+      {
+         level2ChunksProviderManager_->Disable();
+      }
+   }
+   else if (!level2ChunksProviderManager_->refreshEnabled_)
+   {
+      level2ChunksProviderManager_->refreshEnabled_ = true;
+      RefreshData(level2ChunksProviderManager_);
+   }
+}
+
 void RadarProductManagerImpl::RefreshData(
    std::shared_ptr<ProviderManager> providerManager)
 {
@@ -673,7 +1051,13 @@ void RadarProductManagerImpl::RefreshData(
          auto [newObjects, totalObjects] =
             providerManager->provider_->Refresh();
 
-         std::chrono::milliseconds interval = kFastRetryInterval_;
+         std::chrono::milliseconds interval =
+            providerManager->fastRetryInterval_;
+
+         if (providerManager == level2ChunksProviderManager_ && newObjects > 0)
+         {
+            PublishLevel2ElevationScans();
+         }
 
          if (totalObjects > 0)
          {
@@ -698,13 +1082,16 @@ void RadarProductManagerImpl::RefreshData(
                // been last modified, slow the retry period
                interval = kSlowRetryInterval_;
             }
-            else if (interval < std::chrono::milliseconds {kFastRetryInterval_})
+            else if (interval < providerManager->fastRetryInterval_)
             {
                // The interval should be no quicker than the fast retry interval
-               interval = kFastRetryInterval_;
+               interval = providerManager->fastRetryInterval_;
             }
 
-            if (newObjects > 0)
+            // New data from the chunk feed is announced for each elevation
+            // scan as it is published
+            if (newObjects > 0 &&
+                providerManager != level2ChunksProviderManager_)
             {
                Q_EMIT providerManager->NewDataAvailable(
                   providerManager->group_,
@@ -755,6 +1142,56 @@ void RadarProductManagerImpl::RefreshData(
       });
 }
 
+void RadarProductManagerImpl::PublishLevel2ElevationScans()
+{
+   auto chunksProvider =
+      std::dynamic_pointer_cast<provider::Level2ChunksDataProvider>(
+         level2ChunksProviderManager_->provider_);
+
+   if (chunksProvider == nullptr)
+   {
+      logger_->error("Level 2 chunks provider not available");
+      return;
+   }
+
+   std::unordered_map<std::string, std::shared_ptr<types::RadarProductRecord>>
+      records {};
+
+   for (const auto& [key, elevationCut] :
+        chunksProvider->TakeCompletedElevationScans())
+   {
+      std::shared_ptr<types::RadarProductRecord>& record = records[key];
+
+      if (record == nullptr)
+      {
+         // The volume in progress is stored with its first elevation scan, and
+         // the stored record grows as the remaining chunks are loaded
+         std::shared_ptr<wsr88d::NexradFile> nexradFile =
+            chunksProvider->LoadObjectByKey(key);
+
+         if (nexradFile == nullptr)
+         {
+            logger_->warn("Volume in progress not found: {}", key);
+            continue;
+         }
+
+         record = types::RadarProductRecord::Create(nexradFile);
+         record->set_time(chunksProvider->GetTimePointByKey(key));
+         record = StoreRadarProductRecord(record);
+      }
+
+      logger_->debug("Level 2 elevation scan available: {}, {} degrees",
+                     key,
+                     elevationCut);
+
+      Q_EMIT self_->Level2ElevationScanAvailable(record, elevationCut);
+      Q_EMIT level2ChunksProviderManager_->NewDataAvailable(
+         common::RadarProductGroup::Level2,
+         level2ChunksProviderManager_->product_,
+         record->time());
+   }
+}
+
 std::set<std::chrono::system_clock::time_point>
 RadarProductManager::GetActiveVolumeTimes(
    std::chrono::system_clock::time_point time)
@@ -841,7 +1278,9 @@ void RadarProductManagerImpl::LoadProviderData(
                   scwx::util::TimeString(time));
 
    LoadNexradFileAsync(
-      [=, &recordMap, &recordMutex]() -> std::shared_ptr<wsr88d::NexradFile>
+      [=, &recordMap, &recordMutex](
+         const wsr88d::NexradFileFactory::PreloadFunction& preload)
+         -> std::shared_ptr<wsr88d::NexradFile>
       {
          std::shared_ptr<types::RadarProductRecord> existingRecord = nullptr;
          std::shared_ptr<wsr88d::NexradFile>        nexradFile     = nullptr;
@@ -868,7 +1307,8 @@ void RadarProductManagerImpl::LoadProviderData(
 
             if (!key.empty())
             {
-               nexradFile = providerManager->provider_->LoadObjectByKey(key);
+               nexradFile =
+                  providerManager->provider_->LoadObjectByKey(key, preload);
             }
             else
             {
@@ -934,6 +1374,161 @@ void RadarProductManager::LoadLevel3Data(
                        request);
 }
 
+std::size_t RadarProductManager::LoadLevel3Data(
+   const std::vector<std::string>&       products,
+   std::chrono::system_clock::time_point startTime,
+   std::chrono::system_clock::time_point endTime)
+{
+   logger_->debug("LoadLevel3Data: {} products, {} - {}",
+                  products.size(),
+                  scwx::util::TimeString(startTime),
+                  scwx::util::TimeString(endTime));
+
+   std::vector<std::pair<std::shared_ptr<ProviderManager>,
+                         std::chrono::system_clock::time_point>>
+      loadList {};
+
+   for (const std::string& product : products)
+   {
+      auto level3ProviderManager = p->GetLevel3ProviderManager(product);
+
+      // Ensure product times are populated for each day in the time range.
+      // Each population covers the previous, current and next day.
+      for (auto date = std::chrono::floor<std::chrono::days>(startTime) +
+                       std::chrono::days {1};
+           date - std::chrono::days {1} <= endTime;
+           date += std::chrono::days {3})
+      {
+         p->PopulateLevel3ProductTimes(product, date);
+      }
+
+      // Find the product times in the time range which are not loaded
+      std::shared_lock lock {p->level3ProductRecordMutex_};
+
+      auto it = p->level3ProductRecordsMap_.find(product);
+      if (it == p->level3ProductRecordsMap_.cend())
+      {
+         continue;
+      }
+
+      for (auto recordIt = it->second.lower_bound(startTime);
+           recordIt != it->second.cend() && recordIt->first <= endTime;
+           ++recordIt)
+      {
+         if (recordIt->second.expired())
+         {
+            loadList.emplace_back(level3ProviderManager, recordIt->first);
+         }
+      }
+   }
+
+   // Files queued by a previous batch are not queued again
+   {
+      std::unique_lock lock {p->level3BatchPendingMutex_};
+
+      std::erase_if(loadList,
+                    [this](const auto& item)
+                    {
+                       return !p->level3BatchPending_
+                                  .emplace(item.first->product_, item.second)
+                                  .second;
+                    });
+   }
+
+   logger_->debug("Loading {} level 3 files", loadList.size());
+
+   // Load the most recent files first
+   std::sort(loadList.begin(),
+             loadList.end(),
+             [](const auto& a, const auto& b) { return a.second > b.second; });
+
+   for (auto& [providerManager, time] : loadList)
+   {
+      boost::asio::post(p->level3BatchThreadPool_,
+                        [=, this]()
+                        { p->LoadLevel3DataBatchItem(providerManager, time); });
+   }
+
+   return loadList.size();
+}
+
+std::vector<std::string> RadarProductManager::GetActiveLevel3Products()
+{
+   std::set<std::string> products {};
+
+   std::shared_lock refreshLock {p->refreshMapMutex_};
+
+   for (auto& refreshEntry : p->refreshMap_)
+   {
+      if (refreshEntry.second->group_ == common::RadarProductGroup::Level3)
+      {
+         products.insert(refreshEntry.second->product_);
+      }
+   }
+
+   return {products.cbegin(), products.cend()};
+}
+
+bool RadarProductManagerImpl::IsLevel3DataLoaded(
+   const std::string& product, std::chrono::system_clock::time_point time)
+{
+   std::shared_lock lock {level3ProductRecordMutex_};
+
+   auto productIt = level3ProductRecordsMap_.find(product);
+   if (productIt == level3ProductRecordsMap_.cend())
+   {
+      return false;
+   }
+
+   auto recordIt = productIt->second.find(time);
+   return recordIt != productIt->second.cend() && !recordIt->second.expired();
+}
+
+void RadarProductManagerImpl::LoadLevel3DataBatchItem(
+   std::shared_ptr<ProviderManager>      providerManager,
+   std::chrono::system_clock::time_point time)
+{
+   std::shared_ptr<types::RadarProductRecord> record = nullptr;
+
+   // The file may have been loaded by a single request since it was queued
+   if (!IsLevel3DataLoaded(providerManager->product_, time))
+   {
+      std::string key = providerManager->provider_->FindKey(time);
+
+      if (!key.empty())
+      {
+         // Fetch and decode the file without holding a load data mutex, so
+         // other files in the batch are loaded concurrently
+         std::shared_ptr<wsr88d::NexradFile> nexradFile =
+            providerManager->provider_->LoadObjectByKey(key, {});
+
+         if (nexradFile != nullptr)
+         {
+            record = types::RadarProductRecord::Create(nexradFile);
+            record->set_time(time);
+
+            self_->Initialize();
+            record = StoreRadarProductRecord(record);
+         }
+      }
+      else
+      {
+         logger_->warn("Attempting to load object without key: {}",
+                       scwx::util::TimeString(time));
+      }
+   }
+
+   {
+      std::unique_lock lock {level3BatchPendingMutex_};
+      level3BatchPending_.erase({providerManager->product_, time});
+   }
+
+   if (record != nullptr)
+   {
+      Q_EMIT self_->DataReloaded(record);
+   }
+}
+
 void RadarProductManager::LoadData(
    std::istream& is, const std::shared_ptr<request::NexradFileRequest>& request)
 {
@@ -943,8 +1538,9 @@ void RadarProductManager::LoadData(
       [=, &is]()
       {
          RadarProductManagerImpl::LoadNexradFile(
-            [=, &is]() -> std::shared_ptr<wsr88d::NexradFile>
-            { return wsr88d::NexradFileFactory::Create(is); },
+            [=, &is](const wsr88d::NexradFileFactory::PreloadFunction& preload)
+               -> std::shared_ptr<wsr88d::NexradFile>
+            { return wsr88d::NexradFileFactory::Create(is, preload); },
             request,
             fileLoadMutex_);
       });
@@ -988,8 +1584,9 @@ void RadarProductManager::LoadFile(
          [=]()
          {
             RadarProductManagerImpl::LoadNexradFile(
-               [=]() -> std::shared_ptr<wsr88d::NexradFile>
-               { return wsr88d::NexradFileFactory::Create(filename); },
+               [=](const wsr88d::NexradFileFactory::PreloadFunction& preload)
+                  -> std::shared_ptr<wsr88d::NexradFile>
+               { return wsr88d::NexradFileFactory::Create(filename, preload); },
                request,
                fileLoadMutex_);
          });
@@ -1020,35 +1617,39 @@ void RadarProductManagerImpl::LoadNexradFile(
 {
    std::unique_lock lock {mutex};
 
-   std::shared_ptr<wsr88d::NexradFile> nexradFile = load();
+   auto preloadedRecord = std::make_shared<PreloadedRecord>();
 
-   std::shared_ptr<types::RadarProductRecord> record  = nullptr;
-   std::shared_ptr<RadarProductManager>       manager = nullptr;
+   std::shared_ptr<wsr88d::NexradFile> nexradFile = load(
+      [=](const std::shared_ptr<wsr88d::NexradFile>& file)
+      {
+         auto level2File = std::dynamic_pointer_cast<wsr88d::Ar2vFile>(file);
+         if (level2File != nullptr)
+         {
+            PreloadLevel2File(level2File, request, time, preloadedRecord);
+         }
+      });
+
+   std::shared_ptr<types::RadarProductRecord> record = nullptr;
 
    bool fileValid = (nexradFile != nullptr);
 
    if (fileValid)
    {
-      record = types::RadarProductRecord::Create(nexradFile);
-
-      // If the time is already determined, override the time in the file.
-      // Sometimes, level 2 data has been seen to be a few seconds off
-      // between filename and file data. Overriding this can help prevent
-      // issues with locating and storing the correct records.
-      if (time != std::chrono::system_clock::time_point {})
-      {
-         record->set_time(time);
-      }
+      std::tie(record, std::ignore) =
+         StoreNexradFile(nexradFile, request, time);
+   }
+   else
+   {
+      // If the volume failed to load after its first elevation scans were
+      // published, the partial record must not be served as a complete volume
+      auto partialRecord = preloadedRecord->record_.lock();
+      auto manager       = preloadedRecord->manager_.lock();
 
-      std::string recordRadarId = (record->radar_id());
-      if (recordRadarId.empty())
+      if (partialRecord != nullptr && manager != nullptr)
       {
-         recordRadarId = request->current_radar_site();
+         logger_->warn("Removing partially loaded record");
+         manager->p->RemoveRadarProductRecord(partialRecord);
       }
-
-      manager = RadarProductManager::Instance(recordRadarId);
-      manager->Initialize();
-      record = manager->p->StoreRadarProductRecord(record);
    }
 
    lock.unlock();
@@ -1060,6 +1661,85 @@ void RadarProductManagerImpl::LoadNexradFile(
    }
 }
 
+void RadarProductManagerImpl::PreloadLevel2File(
+   const std::shared_ptr<wsr88d::Ar2vFile>&           level2File,
+   const std::shared_ptr<request::NexradFileRequest>& request,
+   std::chrono::system_clock::time_point              time,
+   const std::shared_ptr<PreloadedRecord>&            preloadedRecord)
+{
+   // If enabled, only the data moments which are displayed are decoded
+   level2File->set_lazy_moment_decoding(
+      settings::GeneralSettings::Instance().lazy_moment_decoding().GetValue());
+
+   // The file owns the callback, so only weak references are held to avoid
+   // circular ownership
+   std::weak_ptr<wsr88d::Ar2vFile>           weakFile {level2File};
+   std::weak_ptr<request::NexradFileRequest> weakRequest {request};
+
+   level2File->SetElevationScanCallback(
+      [=](float elevationCut)
+      {
+         std::shared_ptr<types::RadarProductRecord> record =
+            preloadedRecord->record_.lock();
+         std::shared_ptr<RadarProductManager> manager =
+            preloadedRecord->manager_.lock();
+
+         if (record == nullptr || manager == nullptr)
+         {
+            auto nexradFile = weakFile.lock();
+            if (nexradFile == nullptr)
+            {
+               return;
+            }
+
+            // Store the record when the first elevation scan is available,
+            // before the remainder of the volume has loaded
+            std::tie(record, manager) =
+               StoreNexradFile(nexradFile, weakRequest.lock(), time);
+            preloadedRecord->record_  = record;
+            preloadedRecord->manager_ = manager;
+         }
+
+         logger_->debug("Level 2 elevation scan available: {} degrees",
+                        elevationCut);
+
+         Q_EMIT manager->Level2ElevationScanAvailable(record, elevationCut);
+      });
+}
+
+std::tuple<std::shared_ptr<types::RadarProductRecord>,
+           std::shared_ptr<RadarProductManager>>
+RadarProductManagerImpl::StoreNexradFile(
+   const std::shared_ptr<wsr88d::NexradFile>&         nexradFile,
+   const std::shared_ptr<request::NexradFileRequest>& request,
+   std::chrono::system_clock::time_point              time)
+{
+   std::shared_ptr<types::RadarProductRecord> record =
+      types::RadarProductRecord::Create(nexradFile);
+
+   // If the time is already determined, override the time in the file.
+   // Sometimes, level 2 data has been seen to be a few seconds off
+   // between filename and file data. Overriding this can help prevent
+   // issues with locating and storing the correct records.
+   if (time != std::chrono::system_clock::time_point {})
+   {
+      record->set_time(time);
+   }
+
+   std::string recordRadarId = (record->radar_id());
+   if (recordRadarId.empty())
+   {
+      recordRadarId = request->current_radar_site();
+   }
+
+   std::shared_ptr<RadarProductManager> manager =
+      RadarProductManager::Instance(recordRadarId);
+   manager->Initialize();
+   record = manager->p->StoreRadarProductRecord(record);
+
+   return {record, manager};
+}
+
 void RadarProductManagerImpl::PopulateLevel2ProductTimes(
    std::chrono::system_clock::time_point time)
 {
@@ -1335,6 +2015,28 @@ RadarProductManagerImpl::StoreRadarProductRecord(
    return storedRecord;
 }
 
+void RadarProductManagerImpl::RemoveRadarProductRecord(
+   const std::shared_ptr<types::RadarProductRecord>& record)
+{
+   auto timeInSeconds =
+      std::chrono::time_point_cast<std::chrono::seconds,
+                                   std::chrono::system_clock>(record->time());
+
+   if (record->radar_product_group() == common::RadarProductGroup::Level2)
+   {
+      std::unique_lock lock {level2ProductRecordMutex_};
+
+      // The volume time remains available to be loaded again
+      auto it = level2ProductRecords_.find(timeInSeconds);
+      if (it != level2ProductRecords_.end() && it->second.lock() == record)
+      {
+         it->second.reset();
+      }
+
+      level2ProductRecentRecords_.remove(record);
+   }
+}
+
 void RadarProductManagerImpl::UpdateRecentRecords(
    RadarProductRecordList&                    recentList,
    std::shared_ptr<types::RadarProductRecord> record)
@@ -1363,7 +2065,7 @@ void RadarProductManagerImpl::UpdateRecentRecords(
    }
 }
 
-std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+std::tuple<std::shared_ptr<wsr88d::rda::FlatElevationScan>,
            float,
            std::vector<float>,
            std::chrono::system_clock::time_point>
@@ -1371,21 +2073,187 @@ RadarProductManager::GetLevel2Data(wsr88d::rda::DataBlockType dataBlockType,
                                    float                      elevation,
                                    std::chrono::system_clock::time_point time)
 {
-   std::shared_ptr<wsr88d::rda::ElevationScan> radarData    = nullptr;
-   float                                       elevationCut = 0.0f;
-   std::vector<float>                          elevationCuts;
+   std::shared_ptr<wsr88d::rda::FlatElevationScan> radarData    = nullptr;
+   float                                           elevationCut = 0.0f;
+   std::vector<float>                              elevationCuts;
 
    std::shared_ptr<types::RadarProductRecord> record;
-   std::tie(record, time) = p->GetLevel2ProductRecord(time);
+   std::chrono::system_clock::time_point      recordTime;
+   std::tie(record, recordTime) = p->GetLevel2ProductRecord(time);
 
    if (record != nullptr)
    {
+      // If the volume itself was selected, use the most recent cut of the
+      // selected elevation. Otherwise, use the cut collected nearest the time
+      // requested within the volume (e.g., repeated SAILS cuts).
+      const bool volumeSelected =
+         time == std::chrono::system_clock::time_point {} ||
+         std::chrono::floor<std::chrono::seconds>(time) ==
+            std::chrono::floor<std::chrono::seconds>(recordTime);
+      const std::chrono::system_clock::time_point scanTime =
+         volumeSelected ? std::chrono::system_clock::time_point {} : time;
+
       std::tie(radarData, elevationCut, elevationCuts) =
-         record->level2_file()->GetElevationScan(
-            dataBlockType, elevation, time);
+         record->level2_file()->GetFlatElevationScan(
+            dataBlockType, elevation, scanTime);
+
+      if (!volumeSelected)
+      {
+         // Keep the time requested, which continues to select the same cut
+         recordTime = time;
+      }
+   }
+
+   return {radarData, elevationCut, elevationCuts, recordTime};
+}
+
+std::tuple<std::shared_ptr<const wsr88d::VolumeIndex>,
+           std::chrono::system_clock::time_point>
+RadarProductManager::GetLevel2Volume(wsr88d::rda::DataBlockType dataBlockType,
+                                     std::chrono::system_clock::time_point time)
+{
+   std::shared_ptr<const wsr88d::VolumeIndex> volumeIndex = nullptr;
+
+   std::shared_ptr<types::RadarProductRecord> record;
+   std::chrono::system_clock::time_point      recordTime;
+   std::tie(record, recordTime) = p->GetLevel2ProductRecord(time);
+
+   if (record == nullptr)
+   {
+      return {volumeIndex, recordTime};
+   }
+
+   // Select cuts within the volume in the same manner as GetLevel2Data
+   const bool volumeSelected =
+      time == std::chrono::system_clock::time_point {} ||
+      std::chrono::floor<std::chrono::seconds>(time) ==
+         std::chrono::floor<std::chrono::seconds>(recordTime);
+   const std::chrono::system_clock::time_point scanTime =
+      volumeSelected ? std::chrono::system_clock::time_point {} : time;
+
+   if (!volumeSelected)
+   {
+      recordTime = time;
+   }
+
+   std::shared_ptr<wsr88d::Ar2vFile> level2File = record->level2_file();
+   const std::chrono::system_clock::time_point endTime =
+      level2File->end_time();
+
+   std::unique_lock lock {p->level2VolumesMutex_};
+
+   Level2VolumeEntry& entry = p->level2Volumes_[dataBlockType];
+
+   // The end time of the volume advances as further cuts are loaded
+   if (entry.index_ != nullptr && entry.file_.lock() == level2File &&
+       entry.scanTime_ == scanTime && entry.endTime_ == endTime)
+   {
+      return {entry.index_, recordTime};
+   }
+
+   boost::timer::cpu_timer timer;
+
+   timer.start();
+   volumeIndex = std::make_shared<const wsr88d::VolumeIndex>(
+      *level2File, dataBlockType, scanTime);
+   timer.stop();
+
+   logger_->debug("Volume index ({} cuts) built in {}",
+                  volumeIndex->cut_count(),
+                  timer.format(6, "%ws"));
+
+   entry = {level2File, scanTime, endTime, volumeIndex};
+
+   return {volumeIndex, recordTime};
+}
+
+std::tuple<std::shared_ptr<const wsr88d::DerivedProducts>,
+           std::chrono::system_clock::time_point>
+RadarProductManager::GetLevel2DerivedProducts(
+   std::chrono::system_clock::time_point time)
+{
+   auto [volumeIndex, foundTime] =
+      GetLevel2Volume(wsr88d::rda::DataBlockType::MomentRef, time);
+
+   if (volumeIndex == nullptr)
+   {
+      return {nullptr, foundTime};
+   }
+
+   std::unique_lock lock {p->derivedProductsMutex_};
+
+   if (p->derivedProducts_ != nullptr &&
+       p->derivedProductsVolume_.lock() == volumeIndex)
+   {
+      return {p->derivedProducts_, foundTime};
+   }
+
+   boost::timer::cpu_timer timer;
+
+   // The height of the radar site is not known, so echo tops are given above
+   // the radar
+   timer.start();
+   auto derivedProducts =
+      std::make_shared<const wsr88d::DerivedProducts>(*volumeIndex);
+   timer.stop();
+
+   logger_->debug("Derived products calculated in {}", timer.format(6, "%ws"));
+
+   p->derivedProductsVolume_ = volumeIndex;
+   p->derivedProducts_       = derivedProducts;
+
+   return {derivedProducts, foundTime};
+}
+
+std::vector<wsr88d::VolumeIndex::PolarCoordinate>
+RadarProductManager::GetCrossSectionPath(const common::Coordinate& start,
+                                         const common::Coordinate& end,
+                                         std::size_t               points) const
+{
+   std::vector<wsr88d::VolumeIndex::PolarCoordinate> path(points);
+
+   if (points == 0u)
+   {
+      return path;
    }
 
-   return {radarData, elevationCut, elevationCuts, time};
+   const ::GeographicLib::Geodesic& geodesic =
+      util::GeographicLib::DefaultGeodesic();
+   const ::GeographicLib::GeodesicLine line = geodesic.InverseLine(
+      start.latitude_, start.longitude_, end.latitude_, end.longitude_);
+
+   const double radarLatitude  = p->radarSite_->latitude();
+   const double radarLongitude = p->radarSite_->longitude();
+   const double interval =
+      (points > 1u) ? line.Distance() / static_cast<double>(points - 1u) : 0.0;
+
+   auto indices = boost::irange<std::size_t>(0u, points);
+
+   std::for_each(
+      std::execution::par_unseq,
+      indices.begin(),
+      indices.end(),
+      [&](std::size_t i)
+      {
+         double latitude;
+         double longitude;
+         line.Position(interval * static_cast<double>(i), latitude, longitude);
+
+         double s12;  // Distance (meters)
+         double azi1; // Azimuth (degrees)
+         double azi2; // Unused
+         geodesic.Inverse(radarLatitude,
+                          radarLongitude,
+                          latitude,
+                          longitude,
+                          s12,
+                          azi1,
+                          azi2);
+
+         path[i] = {azi1, s12};
+      });
+
+   return path;
 }
 
 std::tuple<std::shared_ptr<wsr88d::rpg::Level3Message>,
@@ -7,10 +7,14 @@
 #include <scwx/qt/types/radar_product_record.hpp>
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/derived_products.hpp>
 #include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/wsr88d/volume_index.hpp>
 
+#include <compare>
 #include <memory>
 #include <set>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -31,6 +35,25 @@ class RadarProductManager : public QObject
    Q_OBJECT
 
 public:
+   /**
+    * @brief Placement of a Level 3 raster grid. Raster products sharing the
+    * same grid placement share projected coordinates.
+    */
+   struct RasterGrid
+   {
+      float         latitude_ {0.0f};  // Degrees
+      float         longitude_ {0.0f}; // Degrees
+      float         range_ {0.0f};     // Kilometers
+      std::int16_t  iCoordinateStart_ {0};
+      std::int16_t  jCoordinateStart_ {0};
+      std::uint16_t xResolution_ {0}; // Meters
+      std::uint16_t yResolution_ {0}; // Meters
+      std::uint16_t rows_ {0};
+      std::uint16_t columns_ {0};
+
+      auto operator<=>(const RasterGrid&) const = default;
+   };
+
    explicit RadarProductManager(const std::string& radarId);
    ~RadarProductManager();
 
@@ -41,7 +64,8 @@ public:
     */
    static void DumpRecords();
 
-   const std::vector<float>& coordinates(common::RadialSize radialSize) const;
+   std::shared_ptr<const std::vector<float>>
+   coordinates(common::RadialSize radialSize) const;
    const scwx::util::time_zone*       default_time_zone() const;
    float                              gate_size() const;
    std::string                        radar_id() const;
@@ -49,6 +73,36 @@ public:
 
    void Initialize();
 
+   /**
+    * @brief Gets the projected gate coordinates of a set of radials. Radial
+    * azimuths are quantized to 0.01 degrees, and coordinates are shared by all
+    * requests with the same quantized azimuths, such as successive volumes and
+    * products of the same elevation cut. Recently used coordinates are cached.
+    *
+    * @param [in] azimuths Azimuth of each radial, in degrees
+    * @param [in] rangeBins Number of range bins in each radial
+    *
+    * @return Gate coordinates, stored as latitude and longitude pairs. Each
+    * radial begins at a multiple of common::MAX_DATA_MOMENT_GATES.
+    */
+   std::shared_ptr<const std::vector<float>>
+   GetRadialCoordinates(std::span<const float> azimuths,
+                        std::uint16_t          rangeBins);
+
+   /**
+    * @brief Gets the projected corner coordinates of a Level 3 raster grid.
+    * Coordinates are calculated the first time a raster grid is requested, and
+    * are shared by subsequent requests for the same raster grid. The most
+    * recently used raster grids are cached.
+    *
+    * @param [in] rasterGrid Raster grid placement
+    *
+    * @return (rows + 1) x (columns + 1) corner coordinates, stored as latitude
+    * and longitude pairs in row-major order
+    */
+   std::shared_ptr<const std::vector<float>>
+   GetRasterCoordinates(const RasterGrid& rasterGrid);
+
    /**
     * @brief Enables or disables refresh associated with a unique identifier
     * (UUID) for a given radar product group and product.
@@ -67,6 +121,13 @@ public:
                       bool                      enabled,
                       boost::uuids::uuid uuid = boost::uuids::nil_uuid());
 
+   /**
+    * @brief Gets the level 3 products with refresh enabled.
+    *
+    * @return Radar product names (AWIPS IDs)
+    */
+   std::vector<std::string> GetActiveLevel3Products();
+
    /**
     * @brief Gets a merged list of the volume times for products with refresh
     * enabled. The volume times will be for the previous, current and next day.
@@ -88,7 +149,7 @@ public:
     * @return Level 2 radar data, selected elevation cut, available elevation
     * cuts and selected time
     */
-   std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+   std::tuple<std::shared_ptr<wsr88d::rda::FlatElevationScan>,
               float,
               std::vector<float>,
               std::chrono::system_clock::time_point>
@@ -96,6 +157,52 @@ public:
                  float                                 elevation,
                  std::chrono::system_clock::time_point time = {});
 
+   /**
+    * @brief Get a sampling index over every elevation cut of a level 2 volume,
+    * for a data block type and time. The index is built once per volume, and
+    * is rebuilt only if further cuts of the volume have been loaded.
+    *
+    * @param [in] dataBlockType Data block type
+    * @param [in] time Radar product time
+    *
+    * @return Volume index, or nullptr if no volume was found, and selected time
+    */
+   std::tuple<std::shared_ptr<const wsr88d::VolumeIndex>,
+              std::chrono::system_clock::time_point>
+   GetLevel2Volume(wsr88d::rda::DataBlockType            dataBlockType,
+                   std::chrono::system_clock::time_point time = {});
+
+   /**
+    * @brief Get the products derived from the reflectivity of a level 2 volume
+    * (composite reflectivity, echo tops and vertically integrated liquid). The
+    * products are computed once per volume index, and are shared by each
+    * view of the volume.
+    *
+    * @param [in] time Radar product time
+    *
+    * @return Derived products, or nullptr if no volume was found, and selected
+    * time
+    */
+   std::tuple<std::shared_ptr<const wsr88d::DerivedProducts>,
+              std::chrono::system_clock::time_point>
+   GetLevel2DerivedProducts(std::chrono::system_clock::time_point time = {});
+
+   /**
+    * @brief Gets evenly spaced points along the geodesic between two
+    * coordinates, relative to the radar site, for sampling a vertical
+    * cross-section of a level 2 volume.
+    *
+    * @param [in] start First point of the path
+    * @param [in] end Last point of the path
+    * @param [in] points Number of points along the path
+    *
+    * @return Azimuth and distance of each point from the radar site
+    */
+   std::vector<wsr88d::VolumeIndex::PolarCoordinate>
+   GetCrossSectionPath(const common::Coordinate& start,
+                       const common::Coordinate& end,
+                       std::size_t               points) const;
+
    /**
     * @brief Get level 3 message data for a product and time.
     *
@@ -120,6 +227,25 @@ public:
       std::chrono::system_clock::time_point              time,
       const std::shared_ptr<request::NexradFileRequest>& request = nullptr);
 
+   /**
+    * @brief Loads level 3 data for a set of products over a range of times.
+    * Product files are fetched and decoded concurrently, up to a fixed number
+    * of files in flight. Each record is stored as soon as it has been decoded,
+    * and DataReloaded is emitted for each record as it becomes available.
+    *
+    * Products which are already loaded, or queued by a previous batch, are
+    * not fetched again.
+    *
+    * @param [in] products Radar product names (AWIPS IDs)
+    * @param [in] startTime Start of the time range (inclusive)
+    * @param [in] endTime End of the time range (inclusive)
+    *
+    * @return Number of files queued
+    */
+   std::size_t LoadLevel3Data(const std::vector<std::string>&       products,
+                              std::chrono::system_clock::time_point startTime,
+                              std::chrono::system_clock::time_point endTime);
+
    static void LoadData(
       std::istream&                                      is,
       const std::shared_ptr<request::NexradFileRequest>& request = nullptr);
@@ -141,6 +267,16 @@ public:
 
 signals:
    void DataReloaded(std::shared_ptr<types::RadarProductRecord> record);
+
+   /**
+    * @brief Emitted when a level 2 elevation scan has been loaded, while the
+    * remainder of the volume may still be loading.
+    *
+    * @param [in] record Radar product record containing the elevation scan
+    * @param [in] elevationCut Elevation cut of the loaded elevation scan
+    */
+   void Level2ElevationScanAvailable(
+      std::shared_ptr<types::RadarProductRecord> record, float elevationCut);
    void Level3ProductsChanged();
    void NewDataAvailable(common::RadarProductGroup             group,
                          const std::string&                    product,
@@ -5,6 +5,7 @@
 #include <scwx/util/map.hpp>
 #include <scwx/util/time.hpp>
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 
@@ -67,6 +68,8 @@ public:
    void RadarSweepMonitorReset();
    void RadarSweepMonitorWait(std::unique_lock<std::mutex>& lock);
 
+   void LoadLoop(const std::vector<std::string>& level3Products);
+   void LoadActiveLoop();
    void Pause();
    void Play();
    void
@@ -77,6 +80,7 @@ public:
 
    boost::asio::thread_pool playThreadPool_ {1};
    boost::asio::thread_pool selectThreadPool_ {1};
+   boost::asio::thread_pool loadThreadPool_ {1};
 
    std::size_t                           mapCount_ {0};
    std::string                           radarSite_ {"?"};
@@ -95,9 +99,10 @@ public:
    std::set<std::size_t>   radarSweepsUpdated_ {};
    std::set<std::size_t>   radarSweepsComplete_ {};
 
-   types::AnimationState     animationState_ {types::AnimationState::Pause};
-   boost::asio::steady_timer animationTimer_ {playThreadPool_};
-   std::mutex                animationTimerMutex_ {};
+   std::atomic<types::AnimationState> animationState_ {
+      types::AnimationState::Pause};
+   boost::asio::steady_timer          animationTimer_ {playThreadPool_};
+   std::mutex                         animationTimerMutex_ {};
 
    std::mutex selectTimeMutex_ {};
 };
@@ -110,6 +115,20 @@ void TimelineManager::SetMapCount(std::size_t mapCount)
    p->mapCount_ = mapCount;
 }
 
+types::AnimationState TimelineManager::animation_state() const
+{
+   return p->animationState_;
+}
+
+void TimelineManager::LoadLevel3Loop(const std::string& product)
+{
+   if (p->animationState_ == types::AnimationState::Play ||
+       p->selectedTime_ != std::chrono::system_clock::time_point {})
+   {
+      p->LoadLoop({product});
+   }
+}
+
 void TimelineManager::SetRadarSite(const std::string& radarSite)
 {
    if (p->radarSite_ == radarSite)
@@ -201,6 +220,7 @@ void TimelineManager::AnimationStepBegin()
    logger_->debug("AnimationStepBegin");
 
    p->Pause();
+   p->LoadActiveLoop();
 
    if (p->viewType_ == types::MapTime::Live ||
        p->pinnedTime_ == std::chrono::system_clock::time_point {})
@@ -359,7 +379,7 @@ void TimelineManager::Impl::Pause()
    if (animationState_ != types::AnimationState::Pause)
    {
       animationState_ = types::AnimationState::Pause;
-      Q_EMIT self_->AnimationStateUpdated(animationState_);
+      Q_EMIT self_->AnimationStateUpdated(animationState_.load());
    }
 }
 
@@ -403,6 +423,40 @@ void TimelineManager::Impl::UpdateCacheLimit(
       static_cast<std::size_t>(numVolumeScans * 1.5), numVolumeScans + 5u));
 }
 
+void TimelineManager::Impl::LoadActiveLoop()
+{
+   if (radarSite_ == "?")
+   {
+      return;
+   }
+
+   LoadLoop(manager::RadarProductManager::Instance(radarSite_)
+               ->GetActiveLevel3Products());
+}
+
+void TimelineManager::Impl::LoadLoop(
+   const std::vector<std::string>& level3Products)
+{
+   if (radarSite_ == "?" || level3Products.empty())
+   {
+      return;
+   }
+
+   auto [startTime, endTime] = GetLoopStartAndEndTimes();
+
+   boost::asio::post(
+      loadThreadPool_,
+      [=, radarSite = radarSite_]()
+      {
+         // Files which are already loaded or queued are not loaded again
+         std::size_t filesQueued =
+            manager::RadarProductManager::Instance(radarSite)->LoadLevel3Data(
+               level3Products, startTime, endTime);
+
+         logger_->debug("Loop load queued {} files", filesQueued);
+      });
+}
+
 void TimelineManager::Impl::Play()
 {
    using namespace std::chrono_literals;
@@ -410,7 +464,10 @@ void TimelineManager::Impl::Play()
    if (animationState_ != types::AnimationState::Play)
    {
       animationState_ = types::AnimationState::Play;
-      Q_EMIT self_->AnimationStateUpdated(animationState_);
+      Q_EMIT self_->AnimationStateUpdated(animationState_.load());
+
+      // Load the loop ahead of the animation
+      LoadActiveLoop();
    }
 
    {
@@ -4,6 +4,7 @@
 
 #include <chrono>
 #include <memory>
+#include <string>
 
 #include <QObject>
 
@@ -24,8 +25,19 @@ public:
 
    static std::shared_ptr<TimelineManager> Instance();
 
+   types::AnimationState animation_state() const;
+
    void SetMapCount(std::size_t mapCount);
 
+   /**
+    * @brief Loads a level 3 product over the loop time range, if the timeline
+    * is animating or is not live. Products are loaded concurrently, rather than
+    * as each time is selected.
+    *
+    * @param [in] product Radar product name (AWIPS ID)
+    */
+   void LoadLevel3Loop(const std::string& product);
+
 public slots:
    void SetRadarSite(const std::string& radarSite);
 
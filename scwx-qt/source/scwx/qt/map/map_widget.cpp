@@ -22,10 +22,12 @@
 #include <scwx/qt/util/file.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/tooltip.hpp>
+#include <scwx/qt/view/mosaic_view.hpp>
 #include <scwx/qt/view/overlay_product_view.hpp>
 #include <scwx/qt/view/radar_product_view_factory.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
+#include <scwx/wsr88d/derived_products.hpp>
 
 #include <set>
 
@@ -60,6 +62,8 @@ namespace map
 static const std::string logPrefix_ = "scwx::qt::map::map_widget";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+static constexpr float kElevationCutTolerance_ = 0.05f;
+
 class MapWidgetImpl : public QObject
 {
    Q_OBJECT
@@ -154,6 +158,9 @@ public:
    void HandleHotkeyUpdates();
    void ImGuiCheckFonts();
    void InitializeNewRadarProductView(const std::string& colorPalette);
+   void LoadColorTable(
+      const std::shared_ptr<view::RadarProductView>& radarProductView,
+      const std::string&                             colorPalette);
    void RadarProductManagerConnect();
    void RadarProductManagerDisconnect();
    void RadarProductViewConnect();
@@ -164,6 +171,8 @@ public:
                                std::optional<std::string> type);
    void SetRadarSite(const std::string& radarSite);
    void UpdateLoadedStyle();
+   void UpdateRadarProductViewPalette(const std::string& colorPalette,
+                                      bool               update);
    bool UpdateStoredMapParameters();
 
    std::string FindMapSymbologyLayer();
@@ -225,6 +234,10 @@ public:
    QPointF         lastPos_ {};
    QPointF         lastGlobalPos_ {};
    std::size_t     currentStyleIndex_;
+
+   // Start of a vertical cross-section being dragged on the map
+   std::optional<common::Coordinate> crossSectionStart_ {};
+
    const MapStyle* currentStyle_;
    std::string     initialStyleName_ {};
 
@@ -705,12 +718,33 @@ void MapWidget::SelectRadarProduct(common::RadarProductGroup group,
       productCode = common::GetLevel3ProductCodeByAwipsId(productName);
    }
 
+   // A level 2 product view is reused when selecting a different level 2
+   // product, so the vertices of the sweep may be reused
+   const bool level2ProductChanged =
+      radarProductView != nullptr &&
+      radarProductView->GetRadarProductGroup() ==
+         common::RadarProductGroup::Level2 &&
+      group == common::RadarProductGroup::Level2 &&
+      radarProductView->GetRadarProductName() != productName;
+
+   // A mosaic displays each Level 2 product, and is not replaced when the
+   // product changes
+   const bool mosaicSelected =
+      std::dynamic_pointer_cast<view::MosaicView>(radarProductView) != nullptr;
+
+   // Products derived from the Level 2 volume are displayed by a different
+   // view than products of a single elevation cut
+   const bool level2ViewChanged =
+      level2ProductChanged && !mosaicSelected &&
+      wsr88d::DerivedProducts::IsDerivedProduct(
+         common::GetLevel2Product(radarProductView->GetRadarProductName())) !=
+         wsr88d::DerivedProducts::IsDerivedProduct(
+            common::GetLevel2Product(productName));
+
    if (radarProductView == nullptr ||
        radarProductView->GetRadarProductGroup() != group ||
-       (radarProductView->GetRadarProductGroup() ==
-           common::RadarProductGroup::Level2 &&
-        radarProductView->GetRadarProductName() != productName) ||
-       p->context_->radar_product_code() != productCode)
+       p->context_->radar_product_code() != productCode ||
+       level2ViewChanged)
    {
       p->RadarProductViewDisconnect();
 
@@ -744,6 +778,12 @@ void MapWidget::SelectRadarProduct(common::RadarProductGroup group,
                common::GetLevel3Palette(productCode);
          p->InitializeNewRadarProductView(palette);
       }
+      else if (level2ProductChanged)
+      {
+         p->UpdateRadarProductViewPalette(
+            common::GetLevel2Palette(common::GetLevel2Product(productName)),
+            update);
+      }
       else if (update)
       {
          radarProductView->Update();
@@ -777,6 +817,56 @@ void MapWidget::SelectRadarProduct(
    SelectRadarProduct(group, product, productCode, time);
 }
 
+void MapWidget::SelectRadarMosaic(const std::vector<std::string>& radarIds,
+                                  common::MosaicRule              rule)
+{
+   if (p->radarProductManager_ == nullptr)
+   {
+      logger_->warn("Cannot select mosaic without a radar site");
+      return;
+   }
+
+   // The current radar site is the primary site of the mosaic
+   std::vector<std::shared_ptr<manager::RadarProductManager>>
+      radarProductManagers {p->radarProductManager_};
+   std::set<std::string> selectedIds {p->radarProductManager_->radar_id()};
+
+   for (const std::string& id : radarIds)
+   {
+      if (config::RadarSite::Get(id) == nullptr)
+      {
+         logger_->warn("Unknown radar site: {}", id);
+      }
+      else if (selectedIds.insert(id).second)
+      {
+         radarProductManagers.push_back(
+            manager::RadarProductManager::Instance(id));
+      }
+   }
+
+   logger_->debug("SelectRadarMosaic: {} sites", radarProductManagers.size());
+
+   common::Level2Product product =
+      p->GetLevel2ProductOrDefault(p->context_->radar_product());
+   const std::string productName = common::GetLevel2Name(product);
+
+   p->RadarProductViewDisconnect();
+
+   auto radarProductView =
+      view::MosaicView::Create(product, radarProductManagers, rule);
+   p->context_->set_radar_product_view(radarProductView);
+
+   p->RadarProductViewConnect();
+
+   p->context_->set_radar_product_group(common::RadarProductGroup::Level2);
+   p->context_->set_radar_product(productName);
+   p->context_->set_radar_product_code(0);
+   p->selectedLevel2Product_ = product;
+
+   radarProductView->SelectTime({});
+   p->InitializeNewRadarProductView(common::GetLevel2Palette(product));
+}
+
 void MapWidget::SelectRadarSite(const std::string& id, bool updateCoordinates)
 {
    logger_->debug("Selecting radar site: {}", id);
@@ -807,7 +897,19 @@ void MapWidget::SelectRadarSite(std::shared_ptr<config::RadarSite> radarSite,
       // Select products from new site
       if (radarProductView != nullptr)
       {
-         radarProductView->set_radar_product_manager(p->radarProductManager_);
+         if (std::dynamic_pointer_cast<view::MosaicView>(radarProductView) !=
+             nullptr)
+         {
+            // A mosaic is replaced by a view of the new site
+            p->RadarProductViewDisconnect();
+            p->context_->set_radar_product_view(nullptr);
+         }
+         else
+         {
+            radarProductView->set_radar_product_manager(
+               p->radarProductManager_);
+         }
+
          SelectRadarProduct(radarProductView->GetRadarProductGroup(),
                             radarProductView->GetRadarProductName(),
                             0,
@@ -1291,6 +1393,14 @@ void MapWidget::mousePressEvent(QMouseEvent* ev)
          p->SelectNearestRadarSite(
             coordinate.first, coordinate.second, "wsr88d");
       }
+      else if (ev->buttons() == Qt::MouseButton::LeftButton &&
+               ev->modifiers() == Qt::KeyboardModifier::ControlModifier)
+      {
+         // Begin a vertical cross-section on control-drag
+         auto coordinate = p->map_->coordinateForPixel(p->lastPos_);
+         p->crossSectionStart_ =
+            common::Coordinate {coordinate.first, coordinate.second};
+      }
    }
 
    if (ev->type() == QEvent::Type::MouseButtonDblClick)
@@ -1314,7 +1424,8 @@ void MapWidget::mouseMoveEvent(QMouseEvent* ev)
 
    if (!delta.isNull())
    {
-      if (ev->buttons() == Qt::MouseButton::LeftButton)
+      if (ev->buttons() == Qt::MouseButton::LeftButton &&
+          !p->crossSectionStart_.has_value())
       {
          p->map_->moveBy(delta);
       }
@@ -1329,6 +1440,25 @@ void MapWidget::mouseMoveEvent(QMouseEvent* ev)
    ev->accept();
 }
 
+void MapWidget::mouseReleaseEvent(QMouseEvent* ev)
+{
+   if (ev->button() == Qt::MouseButton::LeftButton &&
+       p->crossSectionStart_.has_value())
+   {
+      auto coordinate = p->map_->coordinateForPixel(ev->position());
+      const common::Coordinate end {coordinate.first, coordinate.second};
+
+      if (!(end == *p->crossSectionStart_))
+      {
+         Q_EMIT CrossSectionRequested(*p->crossSectionStart_, end);
+      }
+
+      p->crossSectionStart_.reset();
+   }
+
+   ev->accept();
+}
+
 void MapWidget::wheelEvent(QWheelEvent* ev)
 {
    if (ev->angleDelta().y() == 0)
@@ -1594,7 +1724,12 @@ void MapWidgetImpl::RadarProductManagerConnect()
                 const std::string&                    product,
                 std::chrono::system_clock::time_point latestTime)
          {
-            if (autoRefreshEnabled_ &&
+            // Sites of a mosaic are refreshed by the mosaic view
+            const bool mosaicSelected =
+               std::dynamic_pointer_cast<view::MosaicView>(
+                  context_->radar_product_view()) != nullptr;
+
+            if (autoRefreshEnabled_ && !mosaicSelected &&
                 context_->radar_product_group() == group &&
                 (group == common::RadarProductGroup::Level2 ||
                  context_->radar_product() == product))
@@ -1604,6 +1739,39 @@ void MapWidgetImpl::RadarProductManagerConnect()
                   std::make_shared<request::NexradFileRequest>(
                      radarProductManager_->radar_id());
 
+               // Level 2 elevation scan callback
+               auto elevationScanConnection =
+                  std::make_shared<QMetaObject::Connection>();
+
+               if (autoUpdateEnabled_ &&
+                   group == common::RadarProductGroup::Level2)
+               {
+                  // Select the new volume as soon as the displayed elevation
+                  // cut is available, while the remainder of the volume loads
+                  *elevationScanConnection = connect(
+                     radarProductManager_.get(),
+                     &manager::RadarProductManager::
+                        Level2ElevationScanAvailable,
+                     this,
+                     [=,
+                      this](std::shared_ptr<types::RadarProductRecord> record,
+                            float elevationCut)
+                     {
+                        auto radarProductView = context_->radar_product_view();
+
+                        if (record->time() == latestTime &&
+                            radarProductView != nullptr &&
+                            context_->radar_product_group() == group &&
+                            std::abs(elevationCut -
+                                     radarProductView->elevation()) <
+                               kElevationCutTolerance_)
+                        {
+                           disconnect(*elevationScanConnection);
+                           widget_->SelectRadarProduct(record);
+                        }
+                     });
+               }
+
                // File request callback
                if (autoUpdateEnabled_)
                {
@@ -1614,6 +1782,8 @@ void MapWidgetImpl::RadarProductManagerConnect()
                      [=,
                       this](std::shared_ptr<request::NexradFileRequest> request)
                      {
+                        disconnect(*elevationScanConnection);
+
                         // Select loaded record
                         auto record = request->radar_product_record();
 
@@ -1673,18 +1843,7 @@ void MapWidgetImpl::InitializeNewRadarProductView(
                      {
                         auto radarProductView = context_->radar_product_view();
 
-                        std::string colorTableFile =
-                           settings::PaletteSettings::Instance()
-                              .palette(colorPalette)
-                              .GetValue();
-                        if (!colorTableFile.empty())
-                        {
-                           std::unique_ptr<std::istream> colorTableStream =
-                              util::OpenFile(colorTableFile);
-                           std::shared_ptr<common::ColorTable> colorTable =
-                              common::ColorTable::Load(*colorTableStream);
-                           radarProductView->LoadColorTable(colorTable);
-                        }
+                        LoadColorTable(radarProductView, colorPalette);
 
                         radarProductView->Initialize();
                      });
@@ -1695,6 +1854,41 @@ void MapWidgetImpl::InitializeNewRadarProductView(
    }
 }
 
+void MapWidgetImpl::UpdateRadarProductViewPalette(
+   const std::string& colorPalette, bool update)
+{
+   // The view applies the color table once the sweep of the selected product
+   // is computed, as the LUT depends on the scale and offset of the product
+   boost::asio::post(threadPool_,
+                     [=, this]()
+                     {
+                        auto radarProductView = context_->radar_product_view();
+
+                        LoadColorTable(radarProductView, colorPalette);
+
+                        if (update)
+                        {
+                           radarProductView->Update();
+                        }
+                     });
+}
+
+void MapWidgetImpl::LoadColorTable(
+   const std::shared_ptr<view::RadarProductView>& radarProductView,
+   const std::string&                              colorPalette)
+{
+   std::string colorTableFile =
+      settings::PaletteSettings::Instance().palette(colorPalette).GetValue();
+   if (!colorTableFile.empty())
+   {
+      std::unique_ptr<std::istream> colorTableStream =
+         util::OpenFile(colorTableFile);
+      std::shared_ptr<common::ColorTable> colorTable =
+         common::ColorTable::Load(*colorTableStream);
+      radarProductView->LoadColorTable(colorTable);
+   }
+}
+
 void MapWidgetImpl::RadarProductViewConnect()
 {
    auto radarProductView = context_->radar_product_view();
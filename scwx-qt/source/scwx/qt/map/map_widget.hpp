@@ -1,6 +1,7 @@
 #pragma once
 
 #include <scwx/common/geographic.hpp>
+#include <scwx/common/mosaic_grid.hpp>
 #include <scwx/common/products.hpp>
 #include <scwx/qt/config/radar_site.hpp>
 #include <scwx/qt/types/map_types.hpp>
@@ -8,6 +9,8 @@
 
 #include <chrono>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <qmaplibre.hpp>
 
@@ -68,6 +71,19 @@ public:
 
    void SelectRadarProduct(std::shared_ptr<types::RadarProductRecord> record);
 
+   /**
+    * @brief Selects a mosaic of the active Level 2 product from the current
+    * radar site and additional radar sites. Each site of the mosaic is
+    * refreshed independently. Selecting a radar site returns to a single site
+    * view.
+    *
+    * @param [in] radarIds IDs of the additional radar sites
+    * @param [in] rule Rule used to combine sites where their coverage overlaps
+    */
+   void SelectRadarMosaic(
+      const std::vector<std::string>& radarIds,
+      common::MosaicRule              rule = common::MosaicRule::NearestRadar);
+
    /**
     * @brief Selects a radar site.
     *
@@ -136,6 +152,7 @@ private:
    void leaveEvent(QEvent* ev) override final;
    void mousePressEvent(QMouseEvent* ev) override final;
    void mouseMoveEvent(QMouseEvent* ev) override final;
+   void mouseReleaseEvent(QMouseEvent* ev) override final;
    void wheelEvent(QWheelEvent* ev) override final;
 
    // QOpenGLWidget implementation.
@@ -150,6 +167,15 @@ private slots:
    void mapChanged(QMapLibre::Map::MapChange);
 
 signals:
+   /**
+    * This signal is emitted when a line is dragged on the map with the control
+    * key held, to request a vertical cross-section of the radar volume.
+    *
+    * @param [in] start First point of the line
+    * @param [in] end Last point of the line
+    */
+   void CrossSectionRequested(common::Coordinate start, common::Coordinate end);
+
    void Level3ProductsChanged();
    void MapParametersChanged(double latitude,
                              double longitude,
@@ -206,34 +206,35 @@ void OverlayProductLayer::Impl::UpdateStormTrackingInformation()
       std::string stormId = "?";
       std::string hoverText {};
 
-      for (std::size_t i = 0; i < psb->number_of_layers(); ++i)
+      // Storm ID packets precede the SCIT packets of each storm, so the
+      // packets are handled in message order
+      auto packetList = sti->packet_index().FindPacketsByCode(
+         {wsr88d::rpg::PacketCode::StormId,
+          wsr88d::rpg::PacketCode::ScitPastData,
+          wsr88d::rpg::PacketCode::ScitForecastData});
+
+      for (auto& packet : packetList)
       {
-         auto packetList = psb->packet_list(static_cast<std::uint16_t>(i));
-         for (auto& packet : packetList)
+         switch (packet->packet_code())
          {
-            switch (packet->packet_code())
-            {
-            case static_cast<std::uint16_t>(wsr88d::rpg::PacketCode::StormId):
-               HandleStormIdPacket(sti, packet, stormId, hoverText);
-               break;
-
-            case static_cast<std::uint16_t>(
-               wsr88d::rpg::PacketCode::ScitPastData):
-            case static_cast<std::uint16_t>(
-               wsr88d::rpg::PacketCode::ScitForecastData):
-               HandleScitDataPacket(sti,
-                                    packet,
-                                    {latitude, longitude},
-                                    stormId,
-                                    hoverText,
-                                    linkedVectors_);
-               break;
-
-            default:
-               logger_->trace("Ignoring packet type: {}",
-                              packet->packet_code());
-               break;
-            }
+         case static_cast<std::uint16_t>(wsr88d::rpg::PacketCode::StormId):
+            HandleStormIdPacket(sti, packet, stormId, hoverText);
+            break;
+
+         case static_cast<std::uint16_t>(wsr88d::rpg::PacketCode::ScitPastData):
+         case static_cast<std::uint16_t>(
+            wsr88d::rpg::PacketCode::ScitForecastData):
+            HandleScitDataPacket(sti,
+                                 packet,
+                                 {latitude, longitude},
+                                 stormId,
+                                 hoverText,
+                                 linkedVectors_);
+            break;
+
+         default:
+            logger_->trace("Ignoring packet type: {}", packet->packet_code());
+            break;
          }
       }
    }
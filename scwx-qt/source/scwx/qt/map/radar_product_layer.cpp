@@ -6,6 +6,7 @@
 #include <scwx/util/logger.hpp>
 
 #include <execution>
+#include <optional>
 
 #if defined(_MSC_VER)
 #   pragma warning(push, 0)
@@ -47,11 +48,14 @@ public:
        uDataMomentOffsetLocation_(GL_INVALID_INDEX),
        uDataMomentScaleLocation_(GL_INVALID_INDEX),
        uCFPEnabledLocation_(GL_INVALID_INDEX),
+       uMaskZeroDataMomentLocation_(GL_INVALID_INDEX),
        vbo_ {GL_INVALID_INDEX},
        vao_ {GL_INVALID_INDEX},
        texture_ {GL_INVALID_INDEX},
        numVertices_ {0},
+       verticesGeneration_ {},
        cfpEnabled_ {false},
+       maskZeroDataMoment_ {false},
        colorTableNeedsUpdate_ {false},
        sweepNeedsUpdate_ {false}
    {
@@ -65,13 +69,18 @@ public:
    GLint                 uDataMomentOffsetLocation_;
    GLint                 uDataMomentScaleLocation_;
    GLint                 uCFPEnabledLocation_;
+   GLint                 uMaskZeroDataMomentLocation_;
    std::array<GLuint, 3> vbo_;
    GLuint                vao_;
    GLuint                texture_;
 
    GLsizeiptr numVertices_;
 
+   // Generation of the vertices in the vertex buffer
+   std::optional<std::uint64_t> verticesGeneration_;
+
    bool cfpEnabled_;
+   bool maskZeroDataMoment_;
 
    bool colorTableNeedsUpdate_;
    bool sweepNeedsUpdate_;
@@ -137,6 +146,13 @@ void RadarProductLayer::Initialize()
       logger_->warn("Could not find uCFPEnabled");
    }
 
+   p->uMaskZeroDataMomentLocation_ =
+      gl.glGetUniformLocation(p->shaderProgram_->id(), "uMaskZeroDataMoment");
+   if (p->uMaskZeroDataMomentLocation_ == -1)
+   {
+      logger_->warn("Could not find uMaskZeroDataMoment");
+   }
+
    p->shaderProgram_->Use();
 
    // Generate a vertex array object
@@ -144,6 +160,7 @@ void RadarProductLayer::Initialize()
 
    // Generate vertex buffer objects
    gl.glGenBuffers(3, p->vbo_.data());
+   p->verticesGeneration_.reset();
 
    // Update radar sweep
    p->sweepNeedsUpdate_ = true;
@@ -181,21 +198,30 @@ void RadarProductLayer::UpdateSweep()
 
    const std::vector<float>& vertices = radarProductView->vertices();
 
+   const std::uint64_t verticesGeneration =
+      radarProductView->vertices_generation();
+
    // Bind a vertex array object
    gl.glBindVertexArray(p->vao_);
 
-   // Buffer vertices
-   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
-   timer.start();
-   gl.glBufferData(GL_ARRAY_BUFFER,
-                   vertices.size() * sizeof(GLfloat),
-                   vertices.data(),
-                   GL_STATIC_DRAW);
-   timer.stop();
-   logger_->debug("Vertices buffered in {}", timer.format(6, "%ws"));
+   // Buffer vertices, unless only the data moments have changed
+   if (p->verticesGeneration_ != verticesGeneration)
+   {
+      gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
+      timer.start();
+      gl.glBufferData(GL_ARRAY_BUFFER,
+                      vertices.size() * sizeof(GLfloat),
+                      vertices.data(),
+                      GL_STATIC_DRAW);
+      timer.stop();
+      logger_->debug("Vertices buffered in {}", timer.format(6, "%ws"));
+
+      gl.glVertexAttribPointer(
+         0, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
+      gl.glEnableVertexAttribArray(0);
 
-   gl.glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
-   gl.glEnableVertexAttribArray(0);
+      p->verticesGeneration_ = verticesGeneration;
+   }
 
    // Buffer data moments
    const GLvoid* data;
@@ -257,7 +283,8 @@ void RadarProductLayer::UpdateSweep()
       gl.glDisableVertexAttribArray(2);
    }
 
-   p->numVertices_ = vertices.size() / 2;
+   p->numVertices_        = vertices.size() / 2;
+   p->maskZeroDataMoment_ = radarProductView->MaskZeroDataMoment();
 }
 
 void RadarProductLayer::Render(
@@ -300,6 +327,8 @@ void RadarProductLayer::Render(
       p->uMVPMatrixLocation_, 1, GL_FALSE, glm::value_ptr(uMVPMatrix));
 
    gl.glUniform1i(p->uCFPEnabledLocation_, p->cfpEnabled_ ? 1 : 0);
+   gl.glUniform1i(p->uMaskZeroDataMomentLocation_,
+                  p->maskZeroDataMoment_ ? 1 : 0);
 
    gl.glActiveTexture(GL_TEXTURE0);
    gl.glBindTexture(GL_TEXTURE_1D, p->texture_);
@@ -318,14 +347,16 @@ void RadarProductLayer::Deinitialize()
    gl.glDeleteVertexArrays(1, &p->vao_);
    gl.glDeleteBuffers(3, p->vbo_.data());
 
-   p->uMVPMatrixLocation_        = GL_INVALID_INDEX;
-   p->uMapScreenCoordLocation_   = GL_INVALID_INDEX;
-   p->uDataMomentOffsetLocation_ = GL_INVALID_INDEX;
-   p->uDataMomentScaleLocation_  = GL_INVALID_INDEX;
-   p->uCFPEnabledLocation_       = GL_INVALID_INDEX;
-   p->vao_                       = GL_INVALID_INDEX;
-   p->vbo_                       = {GL_INVALID_INDEX};
-   p->texture_                   = GL_INVALID_INDEX;
+   p->uMVPMatrixLocation_          = GL_INVALID_INDEX;
+   p->uMapScreenCoordLocation_     = GL_INVALID_INDEX;
+   p->uDataMomentOffsetLocation_   = GL_INVALID_INDEX;
+   p->uDataMomentScaleLocation_    = GL_INVALID_INDEX;
+   p->uCFPEnabledLocation_         = GL_INVALID_INDEX;
+   p->uMaskZeroDataMomentLocation_ = GL_INVALID_INDEX;
+   p->vao_                         = GL_INVALID_INDEX;
+   p->vbo_                         = {GL_INVALID_INDEX};
+   p->texture_                     = GL_INVALID_INDEX;
+   p->verticesGeneration_.reset();
 }
 
 bool RadarProductLayer::RunMousePicking(
@@ -56,12 +56,15 @@ public:
       defaultAlertAction_.SetDefault(defaultDefaultAlertActionValue);
       defaultRadarSite_.SetDefault("KLSX");
       defaultTimeZone_.SetDefault(defaultDefaultTimeZoneValue);
+      fastRadialProjection_.SetDefault(false);
       fontSizes_.SetDefault({16});
       loopDelay_.SetDefault(2500);
       loopSpeed_.SetDefault(5.0);
       loopTime_.SetDefault(30);
       gridWidth_.SetDefault(1);
       gridHeight_.SetDefault(1);
+      lazyMomentDecoding_.SetDefault(true);
+      level2ChunksEnabled_.SetDefault(false);
       mapProvider_.SetDefault(defaultMapProviderValue);
       mapboxApiKey_.SetDefault("?");
       maptilerApiKey_.SetDefault("?");
@@ -134,9 +137,12 @@ public:
    SettingsVariable<std::string> defaultAlertAction_ {"default_alert_action"};
    SettingsVariable<std::string> defaultRadarSite_ {"default_radar_site"};
    SettingsVariable<std::string> defaultTimeZone_ {"default_time_zone"};
+   SettingsVariable<bool> fastRadialProjection_ {"fast_radial_projection"};
    SettingsContainer<std::vector<std::int64_t>> fontSizes_ {"font_sizes"};
    SettingsVariable<std::int64_t>               gridWidth_ {"grid_width"};
    SettingsVariable<std::int64_t>               gridHeight_ {"grid_height"};
+   SettingsVariable<bool> lazyMomentDecoding_ {"lazy_moment_decoding"};
+   SettingsVariable<bool> level2ChunksEnabled_ {"level2_chunks_enabled"};
    SettingsVariable<std::int64_t>               loopDelay_ {"loop_delay"};
    SettingsVariable<double>                     loopSpeed_ {"loop_speed"};
    SettingsVariable<std::int64_t>               loopTime_ {"loop_time"};
@@ -164,9 +170,12 @@ GeneralSettings::GeneralSettings() :
                       &p->defaultAlertAction_,
                       &p->defaultRadarSite_,
                       &p->defaultTimeZone_,
+                      &p->fastRadialProjection_,
                       &p->fontSizes_,
                       &p->gridWidth_,
                       &p->gridHeight_,
+                      &p->lazyMomentDecoding_,
+                      &p->level2ChunksEnabled_,
                       &p->loopDelay_,
                       &p->loopSpeed_,
                       &p->loopTime_,
@@ -221,6 +230,11 @@ SettingsVariable<std::string>& GeneralSettings::default_time_zone() const
    return p->defaultTimeZone_;
 }
 
+SettingsVariable<bool>& GeneralSettings::fast_radial_projection() const
+{
+   return p->fastRadialProjection_;
+}
+
 SettingsContainer<std::vector<std::int64_t>>&
 GeneralSettings::font_sizes() const
 {
@@ -237,6 +251,16 @@ SettingsVariable<std::int64_t>& GeneralSettings::grid_width() const
    return p->gridWidth_;
 }
 
+SettingsVariable<bool>& GeneralSettings::lazy_moment_decoding() const
+{
+   return p->lazyMomentDecoding_;
+}
+
+SettingsVariable<bool>& GeneralSettings::level2_chunks_enabled() const
+{
+   return p->level2ChunksEnabled_;
+}
+
 SettingsVariable<std::int64_t>& GeneralSettings::loop_delay() const
 {
    return p->loopDelay_;
@@ -344,9 +368,12 @@ bool operator==(const GeneralSettings& lhs, const GeneralSettings& rhs)
            lhs.p->defaultAlertAction_ == rhs.p->defaultAlertAction_ &&
            lhs.p->defaultRadarSite_ == rhs.p->defaultRadarSite_ &&
            lhs.p->defaultTimeZone_ == rhs.p->defaultTimeZone_ &&
+           lhs.p->fastRadialProjection_ == rhs.p->fastRadialProjection_ &&
            lhs.p->fontSizes_ == rhs.p->fontSizes_ &&
            lhs.p->gridWidth_ == rhs.p->gridWidth_ &&
            lhs.p->gridHeight_ == rhs.p->gridHeight_ &&
+           lhs.p->lazyMomentDecoding_ == rhs.p->lazyMomentDecoding_ &&
+           lhs.p->level2ChunksEnabled_ == rhs.p->level2ChunksEnabled_ &&
            lhs.p->loopDelay_ == rhs.p->loopDelay_ &&
            lhs.p->loopSpeed_ == rhs.p->loopSpeed_ &&
            lhs.p->loopTime_ == rhs.p->loopTime_ &&
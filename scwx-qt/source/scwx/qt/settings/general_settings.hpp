@@ -31,9 +31,12 @@ public:
    SettingsVariable<std::string>&                default_alert_action() const;
    SettingsVariable<std::string>&                default_radar_site() const;
    SettingsVariable<std::string>&                default_time_zone() const;
+   SettingsVariable<bool>&                       fast_radial_projection() const;
    SettingsContainer<std::vector<std::int64_t>>& font_sizes() const;
    SettingsVariable<std::int64_t>&               grid_height() const;
    SettingsVariable<std::int64_t>&               grid_width() const;
+   SettingsVariable<bool>&                       lazy_moment_decoding() const;
+   SettingsVariable<bool>&                       level2_chunks_enabled() const;
    SettingsVariable<std::int64_t>&               loop_delay() const;
    SettingsVariable<double>&                     loop_speed() const;
    SettingsVariable<std::int64_t>&               loop_time() const;
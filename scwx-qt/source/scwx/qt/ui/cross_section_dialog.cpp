@@ -0,0 +1,207 @@
+#include "cross_section_dialog.hpp"
+#include "ui_cross_section_dialog.h"
+
+#include <scwx/qt/settings/palette_settings.hpp>
+#include <scwx/qt/util/file.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/common/color_table.hpp>
+#include <scwx/common/products.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/time.hpp>
+
+#include <array>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <fmt/format.h>
+#include <QImage>
+#include <QPixmap>
+
+namespace scwx
+{
+namespace qt
+{
+namespace ui
+{
+
+static const std::string logPrefix_ = "scwx::qt::ui::cross_section_dialog";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr std::size_t   kPathPoints_   = 500u;
+static constexpr std::size_t   kHeights_      = 200u;
+static constexpr double        kMaxHeight_    = 20000.0; // Meters
+static constexpr std::uint16_t kRangeFolded_  = 1u;
+static constexpr QRgb          kNoDataColor_  = 0xff000000;
+static constexpr QRgb          kGridColor_    = 0xff404040;
+static constexpr double        kGridInterval_ = 5000.0; // Meters
+
+class CrossSectionDialog::Impl
+{
+public:
+   explicit Impl(CrossSectionDialog* self) : self_ {self} {};
+   ~Impl() { threadPool_.join(); }
+
+   void ComputeCrossSection(
+      std::shared_ptr<manager::RadarProductManager> radarProductManager,
+      std::chrono::system_clock::time_point         time,
+      common::Coordinate                            start,
+      common::Coordinate                            end);
+   std::shared_ptr<common::ColorTable> LoadColorTable();
+
+   CrossSectionDialog* self_;
+
+   boost::asio::thread_pool threadPool_ {1u};
+};
+
+CrossSectionDialog::CrossSectionDialog(QWidget* parent) :
+    QDialog(parent),
+    p {std::make_unique<Impl>(this)},
+    ui(new Ui::CrossSectionDialog)
+{
+   ui->setupUi(this);
+}
+
+CrossSectionDialog::~CrossSectionDialog()
+{
+   delete ui;
+}
+
+void CrossSectionDialog::SelectCrossSection(
+   std::shared_ptr<manager::RadarProductManager> radarProductManager,
+   std::chrono::system_clock::time_point         time,
+   const common::Coordinate&                     start,
+   const common::Coordinate&                     end)
+{
+   ui->descriptionLabel->setText(tr("Loading..."));
+
+   boost::asio::post(p->threadPool_,
+                     [=, this]()
+                     {
+                        p->ComputeCrossSection(
+                           radarProductManager, time, start, end);
+                     });
+}
+
+void CrossSectionDialog::Impl::ComputeCrossSection(
+   std::shared_ptr<manager::RadarProductManager> radarProductManager,
+   std::chrono::system_clock::time_point         time,
+   common::Coordinate                            start,
+   common::Coordinate                            end)
+{
+   auto [volumeIndex, volumeTime] = radarProductManager->GetLevel2Volume(
+      wsr88d::rda::DataBlockType::MomentRef, time);
+
+   if (volumeIndex == nullptr || volumeIndex->cut_count() == 0u)
+   {
+      QMetaObject::invokeMethod(
+         self_,
+         [this]()
+         { self_->ui->descriptionLabel->setText(tr("No volume loaded")); },
+         Qt::QueuedConnection);
+      return;
+   }
+
+   std::vector<wsr88d::VolumeIndex::PolarCoordinate> path =
+      radarProductManager->GetCrossSectionPath(start, end, kPathPoints_);
+
+   std::array<double, kHeights_> heights {};
+   for (std::size_t i = 0; i < kHeights_; ++i)
+   {
+      heights[i] = kMaxHeight_ * (static_cast<double>(i) + 0.5) /
+                   static_cast<double>(kHeights_);
+   }
+
+   std::vector<std::uint16_t> levels =
+      volumeIndex->SampleCrossSection(path, heights);
+
+   std::shared_ptr<common::ColorTable> colorTable = LoadColorTable();
+
+   const float offset = volumeIndex->offset();
+   const float scale  = volumeIndex->scale();
+
+   // Levels are stored with one row per height, in ascending order. The image
+   // is displayed with the highest row at the top.
+   QImage image {static_cast<int>(kPathPoints_),
+                 static_cast<int>(kHeights_),
+                 QImage::Format::Format_ARGB32};
+
+   for (std::size_t row = 0; row < kHeights_; ++row)
+   {
+      const int  y = static_cast<int>(kHeights_ - row - 1u);
+      const bool gridRow =
+         static_cast<int>(heights[row] / kGridInterval_) !=
+         static_cast<int>((heights[row] - kMaxHeight_ / kHeights_) /
+                          kGridInterval_);
+
+      for (std::size_t column = 0; column < kPathPoints_; ++column)
+      {
+         const std::uint16_t level = levels[row * kPathPoints_ + column];
+         QRgb                color = gridRow ? kGridColor_ : kNoDataColor_;
+
+         if (level != 0u && colorTable != nullptr)
+         {
+            boost::gil::rgba8_pixel_t pixel =
+               (level == kRangeFolded_) ?
+                  colorTable->rf_color() :
+                  colorTable->Color((level - offset) / scale);
+
+            if (pixel[3] != 0u)
+            {
+               color = qRgb(pixel[0], pixel[1], pixel[2]);
+            }
+         }
+
+         image.setPixel(static_cast<int>(column), y, color);
+      }
+   }
+
+   const units::length::meters<double> length =
+      util::GeographicLib::GetDistance(
+         start.latitude_, start.longitude_, end.latitude_, end.longitude_);
+
+   const QString description = QString::fromStdString(
+      fmt::format("{} {}, {:.1f} km, 0-{:.0f} km height",
+                  radarProductManager->radar_id(),
+                  scwx::util::TimeString(volumeTime),
+                  length.value() / 1000.0,
+                  kMaxHeight_ / 1000.0));
+
+   QMetaObject::invokeMethod(
+      self_,
+      [this, image, description]()
+      {
+         self_->ui->crossSectionLabel->setPixmap(QPixmap::fromImage(image));
+         self_->ui->descriptionLabel->setText(description);
+      },
+      Qt::QueuedConnection);
+}
+
+std::shared_ptr<common::ColorTable> CrossSectionDialog::Impl::LoadColorTable()
+{
+   const std::string colorPalette =
+      common::GetLevel2Palette(common::Level2Product::Reflectivity);
+   const std::string colorTableFile =
+      settings::PaletteSettings::Instance().palette(colorPalette).GetValue();
+
+   if (colorTableFile.empty())
+   {
+      return nullptr;
+   }
+
+   std::unique_ptr<std::istream> colorTableStream =
+      util::OpenFile(colorTableFile);
+   std::shared_ptr<common::ColorTable> colorTable =
+      common::ColorTable::Load(*colorTableStream);
+
+   if (!colorTable->IsValid())
+   {
+      logger_->warn("Invalid color table: {}", colorTableFile);
+      return nullptr;
+   }
+
+   return colorTable;
+}
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
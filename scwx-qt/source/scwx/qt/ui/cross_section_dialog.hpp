@@ -0,0 +1,58 @@
+#pragma once
+
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/common/geographic.hpp>
+
+#include <chrono>
+#include <memory>
+
+#include <QDialog>
+
+namespace Ui
+{
+class CrossSectionDialog;
+}
+
+namespace scwx
+{
+namespace qt
+{
+namespace ui
+{
+
+class CrossSectionDialog : public QDialog
+{
+   Q_OBJECT
+
+private:
+   Q_DISABLE_COPY(CrossSectionDialog)
+
+public:
+   explicit CrossSectionDialog(QWidget* parent = nullptr);
+   ~CrossSectionDialog();
+
+   /**
+    * @brief Selects a vertical cross-section of the reflectivity of a level 2
+    * volume, along the geodesic between two coordinates. The cross-section is
+    * sampled in the background, and displayed when complete.
+    *
+    * @param [in] radarProductManager Radar product manager of the radar site
+    * @param [in] time Radar product time. Default is the latest available.
+    * @param [in] start First point of the cross-section
+    * @param [in] end Last point of the cross-section
+    */
+   void SelectCrossSection(
+      std::shared_ptr<manager::RadarProductManager> radarProductManager,
+      std::chrono::system_clock::time_point         time,
+      const common::Coordinate&                     start,
+      const common::Coordinate&                     end);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl>   p;
+   Ui::CrossSectionDialog* ui;
+};
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
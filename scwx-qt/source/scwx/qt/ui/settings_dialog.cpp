@@ -123,6 +123,9 @@ public:
           &nmeaSource_,
           &warningsProvider_,
           &antiAliasingEnabled_,
+          &fastRadialProjection_,
+          &lazyMomentDecoding_,
+          &level2ChunksEnabled_,
           &showMapAttribution_,
           &showMapCenter_,
           &showMapLogo_,
@@ -229,6 +232,9 @@ public:
    settings::SettingsInterface<std::string>  theme_ {};
    settings::SettingsInterface<std::string>  warningsProvider_ {};
    settings::SettingsInterface<bool>         antiAliasingEnabled_ {};
+   settings::SettingsInterface<bool>         fastRadialProjection_ {};
+   settings::SettingsInterface<bool>         lazyMomentDecoding_ {};
+   settings::SettingsInterface<bool>         level2ChunksEnabled_ {};
    settings::SettingsInterface<bool>         showMapAttribution_ {};
    settings::SettingsInterface<bool>         showMapCenter_ {};
    settings::SettingsInterface<bool>         showMapLogo_ {};
@@ -630,6 +636,19 @@ void SettingsDialogImpl::SetupGeneralTab()
       generalSettings.anti_aliasing_enabled());
    antiAliasingEnabled_.SetEditWidget(self_->ui->antiAliasingEnabledCheckBox);
 
+   fastRadialProjection_.SetSettingsVariable(
+      generalSettings.fast_radial_projection());
+   fastRadialProjection_.SetEditWidget(
+      self_->ui->fastRadialProjectionCheckBox);
+
+   lazyMomentDecoding_.SetSettingsVariable(
+      generalSettings.lazy_moment_decoding());
+   lazyMomentDecoding_.SetEditWidget(self_->ui->lazyMomentDecodingCheckBox);
+
+   level2ChunksEnabled_.SetSettingsVariable(
+      generalSettings.level2_chunks_enabled());
+   level2ChunksEnabled_.SetEditWidget(self_->ui->level2ChunksEnabledCheckBox);
+
    showMapAttribution_.SetSettingsVariable(
       generalSettings.show_map_attribution());
    showMapAttribution_.SetEditWidget(self_->ui->showMapAttributionCheckBox);
@@ -1,6 +1,8 @@
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <atomic>
+#include <cmath>
 #include <numbers>
 
 #include <GeographicLib/Gnomonic.hpp>
@@ -19,6 +21,24 @@ namespace GeographicLib
 static const std::string logPrefix_ = "scwx::qt::util::geographic_lib";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+static std::atomic<ProjectionMode> projectionMode_ {ProjectionMode::Exact};
+
+static constexpr double kDegreesToRadians_ = std::numbers::pi / 180.0;
+static constexpr double kRadiansToDegrees_ = 180.0 / std::numbers::pi;
+
+static void GetRadialCoordinatesExact(double           latitude,
+                                      double           longitude,
+                                      double           angle,
+                                      double           startDistance,
+                                      double           interval,
+                                      std::span<float> coordinates);
+static void GetRadialCoordinatesFast(double           latitude,
+                                     double           longitude,
+                                     double           angle,
+                                     double           startDistance,
+                                     double           interval,
+                                     std::span<float> coordinates);
+
 const ::GeographicLib::Geodesic& DefaultGeodesic()
 {
    static const ::GeographicLib::Geodesic geodesic_ {
@@ -137,6 +157,162 @@ GetDistance(double lat1, double lon1, double lat2, double lon2)
    return units::length::meters<double> {distance};
 }
 
+ProjectionMode GetProjectionMode()
+{
+   return projectionMode_;
+}
+
+void GetRadialCoordinates(const common::Coordinate&     center,
+                          units::angle::degrees<double> angle,
+                          units::length::meters<double> startDistance,
+                          units::length::meters<double> interval,
+                          std::span<float>              coordinates,
+                          ProjectionMode                mode)
+{
+   if (mode == ProjectionMode::Exact)
+   {
+      GetRadialCoordinatesExact(center.latitude_,
+                                center.longitude_,
+                                angle.value(),
+                                startDistance.value(),
+                                interval.value(),
+                                coordinates);
+   }
+   else
+   {
+      GetRadialCoordinatesFast(center.latitude_,
+                               center.longitude_,
+                               angle.value(),
+                               startDistance.value(),
+                               interval.value(),
+                               coordinates);
+   }
+}
+
+static void GetRadialCoordinatesExact(double           latitude,
+                                      double           longitude,
+                                      double           angle,
+                                      double           startDistance,
+                                      double           interval,
+                                      std::span<float> coordinates)
+{
+   const ::GeographicLib::Geodesic& geodesic = DefaultGeodesic();
+
+   const std::size_t numPoints = coordinates.size() / 2;
+
+   for (std::size_t i = 0; i < numPoints; ++i)
+   {
+      double latitude2;
+      double longitude2;
+
+      geodesic.Direct(latitude,
+                      longitude,
+                      angle,
+                      startDistance + interval * static_cast<double>(i),
+                      latitude2,
+                      longitude2);
+
+      coordinates[i * 2]     = static_cast<float>(latitude2);
+      coordinates[i * 2 + 1] = static_cast<float>(longitude2);
+   }
+}
+
+static void GetRadialCoordinatesFast(double           latitude,
+                                     double           longitude,
+                                     double           angle,
+                                     double           startDistance,
+                                     double           interval,
+                                     std::span<float> coordinates)
+{
+   // Vincenty's solution of the direct problem on the ellipsoid, limited to a
+   // single iteration of the angular distance on the auxiliary sphere. At
+   // radar ranges, the correction to the angular distance is small enough
+   // that its sine and cosine are replaced by their leading series terms.
+   static const double a = ::GeographicLib::Constants::WGS84_a();
+   static const double f = ::GeographicLib::Constants::WGS84_f();
+   static const double b = a * (1.0 - f);
+
+   // Terms which are constant along the radial
+   const double alpha1    = angle * kDegreesToRadians_;
+   const double sinAlpha1 = std::sin(alpha1);
+   const double cosAlpha1 = std::cos(alpha1);
+
+   const double tanU1 = (1.0 - f) * std::tan(latitude * kDegreesToRadians_);
+   const double cosU1 = 1.0 / std::sqrt(1.0 + tanU1 * tanU1);
+   const double sinU1 = tanU1 * cosU1;
+
+   const double sigma1     = std::atan2(tanU1, cosAlpha1);
+   const double sin2Sigma1 = std::sin(2.0 * sigma1);
+   const double cos2Sigma1 = std::cos(2.0 * sigma1);
+
+   const double sinAlpha  = cosU1 * sinAlpha1;
+   const double cos2Alpha = 1.0 - sinAlpha * sinAlpha;
+
+   const double u2 = cos2Alpha * (a * a - b * b) / (b * b);
+   const double A =
+      1.0 + u2 / 16384.0 * (4096.0 + u2 * (-768.0 + u2 * (320.0 - 175.0 * u2)));
+   const double B =
+      u2 / 1024.0 * (256.0 + u2 * (-128.0 + u2 * (74.0 - 47.0 * u2)));
+   const double C = f / 16.0 * cos2Alpha * (4.0 + f * (4.0 - 3.0 * cos2Alpha));
+
+   const double sigmaStart    = startDistance / (b * A);
+   const double sigmaInterval = interval / (b * A);
+
+   const std::size_t numPoints = coordinates.size() / 2;
+
+   // Each point is independent of the others, allowing the loop to be
+   // vectorized
+   for (std::size_t i = 0; i < numPoints; ++i)
+   {
+      const double sigma0 =
+         sigmaStart + sigmaInterval * static_cast<double>(i);
+      const double sinSigma0 = std::sin(sigma0);
+      const double cosSigma0 = std::cos(sigma0);
+
+      // cos(2 sigma_m), where 2 sigma_m = 2 sigma1 + sigma
+      const double cos2SigmaM0 =
+         cos2Sigma1 * cosSigma0 - sin2Sigma1 * sinSigma0;
+
+      const double deltaSigma =
+         B * sinSigma0 *
+         (cos2SigmaM0 +
+          B / 4.0 *
+             (cosSigma0 * (-1.0 + 2.0 * cos2SigmaM0 * cos2SigmaM0) -
+              B / 6.0 * cos2SigmaM0 * (-3.0 + 4.0 * sinSigma0 * sinSigma0) *
+                 (-3.0 + 4.0 * cos2SigmaM0 * cos2SigmaM0)));
+
+      const double sigma         = sigma0 + deltaSigma;
+      const double sinDeltaSigma = deltaSigma;
+      const double cosDeltaSigma = 1.0 - 0.5 * deltaSigma * deltaSigma;
+      const double sinSigma =
+         sinSigma0 * cosDeltaSigma + cosSigma0 * sinDeltaSigma;
+      const double cosSigma =
+         cosSigma0 * cosDeltaSigma - sinSigma0 * sinDeltaSigma;
+      const double cos2SigmaM = cos2Sigma1 * cosSigma - sin2Sigma1 * sinSigma;
+
+      const double x = sinU1 * sinSigma - cosU1 * cosSigma * cosAlpha1;
+      const double phi2 =
+         std::atan2(sinU1 * cosSigma + cosU1 * sinSigma * cosAlpha1,
+                    (1.0 - f) * std::sqrt(sinAlpha * sinAlpha + x * x));
+      const double lambda =
+         std::atan2(sinSigma * sinAlpha1,
+                    cosU1 * cosSigma - sinU1 * sinSigma * cosAlpha1);
+      const double series =
+         cos2SigmaM + C * cosSigma * (-1.0 + 2.0 * cos2SigmaM * cos2SigmaM);
+      const double L =
+         lambda - (1.0 - C) * f * sinAlpha * (sigma + C * sinSigma * series);
+
+      coordinates[i * 2]     = static_cast<float>(phi2 * kRadiansToDegrees_);
+      coordinates[i * 2 + 1] = static_cast<float>(
+         std::remainder(longitude + L * kRadiansToDegrees_, 360.0));
+   }
+}
+
+void SetProjectionMode(ProjectionMode mode)
+{
+   projectionMode_ = mode;
+}
+
 } // namespace GeographicLib
 } // namespace util
 } // namespace qt
@@ -2,6 +2,7 @@
 
 #include <scwx/common/geographic.hpp>
 
+#include <span>
 #include <vector>
 
 #include <GeographicLib/Geodesic.hpp>
@@ -17,6 +18,18 @@ namespace util
 namespace GeographicLib
 {
 
+/**
+ * Projection mode used when projecting radar sweeps to geographic coordinates.
+ * Exact projections solve the direct geodesic problem using GeographicLib. Fast
+ * projections use a truncated ellipsoidal series, which is within 2 meters of
+ * the exact geodesic at radar ranges (460 km).
+ */
+enum class ProjectionMode
+{
+   Exact,
+   Fast
+};
+
 /**
  * Get the default geodesic for the WGS84 ellipsoid.
  *
@@ -90,6 +103,40 @@ common::Coordinate GetCoordinate(const common::Coordinate& center,
 units::length::meters<double>
 GetDistance(double lat1, double lon1, double lat2, double lon2);
 
+/**
+ * Get the projection mode used for radar sweeps.
+ *
+ * @return projection mode
+ */
+ProjectionMode GetProjectionMode();
+
+/**
+ * Get the coordinates of evenly spaced points along a radial.
+ *
+ * @param [in] center The center coordinate from which the radial originates
+ * @param [in] angle The azimuth of the radial
+ * @param [in] startDistance The distance from the center coordinate to the
+ * first point
+ * @param [in] interval The distance between successive points
+ * @param [out] coordinates Latitude and longitude of each point, stored in
+ * pairs. The number of points is half the size of the span.
+ * @param [in] mode The projection mode
+ */
+void GetRadialCoordinates(const common::Coordinate&     center,
+                          units::angle::degrees<double> angle,
+                          units::length::meters<double> startDistance,
+                          units::length::meters<double> interval,
+                          std::span<float>              coordinates,
+                          ProjectionMode mode = GetProjectionMode());
+
+/**
+ * Set the projection mode used for radar sweeps. The default mode is exact.
+ * Sweeps which have already been projected are not affected.
+ *
+ * @param [in] mode The projection mode
+ */
+void SetProjectionMode(ProjectionMode mode);
+
 } // namespace GeographicLib
 } // namespace util
 } // namespace qt
@@ -0,0 +1,762 @@
+#include <scwx/qt/view/level2_derived_view.hpp>
+#include <scwx/qt/settings/unit_settings.hpp>
+#include <scwx/qt/types/unit_types.hpp>
+#include <scwx/common/constants.hpp>
+#include <scwx/util/azimuth_lookup.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/wsr88d/derived_products.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <unordered_map>
+
+#include <boost/range/irange.hpp>
+#include <boost/timer/timer.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string logPrefix_ = "scwx::qt::view::level2_derived_view";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr std::uint32_t VALUES_PER_VERTEX = 2u;
+
+static const std::unordered_map<common::Level2Product, std::string>
+   productUnits_ {
+      {common::Level2Product::CompositeReflectivity, "dBZ"},
+      {common::Level2Product::EchoTops, "kft"},
+      {common::Level2Product::VerticallyIntegratedLiquid, "kg/m\302\262"}};
+
+class Level2DerivedView::Impl
+{
+public:
+   explicit Impl(Level2DerivedView* self, common::Level2Product product) :
+       self_ {self}, product_ {product}
+   {
+      auto& unitSettings = settings::UnitSettings::Instance();
+
+      otherUnitsCallbackUuid_ =
+         unitSettings.other_units().RegisterValueChangedCallback(
+            [this](const std::string& value) { UpdateOtherUnits(value); });
+
+      UpdateOtherUnits(unitSettings.other_units().GetValue());
+   }
+   ~Impl()
+   {
+      auto& unitSettings = settings::UnitSettings::Instance();
+
+      unitSettings.other_units().UnregisterValueChangedCallback(
+         otherUnitsCallbackUuid_);
+
+      threadPool_.join();
+   };
+
+   void ComputeVertices(
+      const std::shared_ptr<const std::vector<float>>& coordinatesPtr);
+   void ComputeDataMoments();
+   void UpdateOtherUnits(const std::string& name);
+
+   Level2DerivedView* self_;
+
+   boost::asio::thread_pool threadPool_ {1u};
+
+   common::Level2Product product_;
+   common::Level2Product sweepProduct_ {common::Level2Product::Unknown};
+
+   std::shared_ptr<const wsr88d::DerivedProducts> derivedProducts_ {nullptr};
+
+   // Finds the radial of the derived products containing an azimuth
+   std::shared_ptr<const scwx::util::AzimuthLookup> azimuthLookup_ {};
+
+   // Coordinates and gate layout from which the vertices were computed. Every
+   // radial shares the same gate layout, so the vertices are reused until the
+   // coordinates or the layout change.
+   std::shared_ptr<const std::vector<float>> coordinates_ {};
+   std::size_t                               gates_ {0u};
+   double                                    firstGateRange_ {0.0};
+   double                                    gateInterval_ {0.0};
+   std::size_t                               binsPerRadial_ {0u};
+   std::size_t                               firstBinVertices_ {0u};
+   std::size_t                               radialVertices_ {0u};
+
+   std::vector<float>        vertices_ {};
+   std::vector<std::uint8_t> dataMoments8_ {};
+
+   float         range_ {0.0f};
+   std::uint16_t vcp_ {0u};
+
+   std::chrono::system_clock::time_point sweepTime_ {};
+
+   std::shared_ptr<common::ColorTable>    colorTable_ {};
+   std::vector<boost::gil::rgba8_pixel_t> colorTableLut_ {};
+   std::uint16_t                          colorTableMin_ {2u};
+   std::uint16_t                          colorTableMax_ {254u};
+
+   std::shared_ptr<common::ColorTable> savedColorTable_ {nullptr};
+   float                               savedScale_ {0.0f};
+   float                               savedOffset_ {0.0f};
+
+   boost::uuids::uuid otherUnitsCallbackUuid_ {};
+   types::OtherUnits  otherUnits_ {types::OtherUnits::Unknown};
+};
+
+Level2DerivedView::Level2DerivedView(
+   common::Level2Product                         product,
+   std::shared_ptr<manager::RadarProductManager> radarProductManager) :
+    RadarProductView(radarProductManager),
+    p(std::make_unique<Impl>(this, product))
+{
+   ConnectRadarProductManager();
+}
+
+Level2DerivedView::~Level2DerivedView()
+{
+   std::unique_lock sweepLock {sweep_mutex()};
+}
+
+static bool
+IsTimeInVolume(const std::shared_ptr<types::RadarProductRecord>& record,
+               std::chrono::system_clock::time_point             time)
+{
+   const auto volumeTime =
+      std::chrono::floor<std::chrono::seconds>(record->time());
+
+   if (time == volumeTime)
+   {
+      return true;
+   }
+
+   // Repeated cuts (e.g., SAILS) are selected by a time within the volume
+   auto level2File = record->level2_file();
+
+   return level2File != nullptr && time > volumeTime &&
+          time <= level2File->end_time();
+}
+
+void Level2DerivedView::ConnectRadarProductManager()
+{
+   connect(radar_product_manager().get(),
+           &manager::RadarProductManager::DataReloaded,
+           this,
+           [this](std::shared_ptr<types::RadarProductRecord> record)
+           {
+              if (record->radar_product_group() ==
+                     common::RadarProductGroup::Level2 &&
+                  IsTimeInVolume(record, selected_time()))
+              {
+                 // If the data associated with the currently selected time is
+                 // reloaded, update the view
+                 Update();
+              }
+           });
+   connect(radar_product_manager().get(),
+           &manager::RadarProductManager::Level2ElevationScanAvailable,
+           this,
+           [this](std::shared_ptr<types::RadarProductRecord> record,
+                  [[maybe_unused]] float elevationCut)
+           {
+              // Every elevation cut contributes to the derived products, so
+              // the view is updated as each cut of the volume becomes available
+              if (selected_time() == std::chrono::system_clock::time_point {} ||
+                  IsTimeInVolume(record, selected_time()))
+              {
+                 Update();
+              }
+           });
+}
+
+void Level2DerivedView::DisconnectRadarProductManager()
+{
+   disconnect(radar_product_manager().get(),
+              &manager::RadarProductManager::DataReloaded,
+              this,
+              nullptr);
+   disconnect(radar_product_manager().get(),
+              &manager::RadarProductManager::Level2ElevationScanAvailable,
+              this,
+              nullptr);
+}
+
+boost::asio::thread_pool& Level2DerivedView::thread_pool()
+{
+   return p->threadPool_;
+}
+
+std::shared_ptr<common::ColorTable> Level2DerivedView::color_table() const
+{
+   return p->colorTable_;
+}
+
+const std::vector<boost::gil::rgba8_pixel_t>&
+Level2DerivedView::color_table_lut() const
+{
+   if (p->colorTableLut_.size() == 0)
+   {
+      return RadarProductView::color_table_lut();
+   }
+   else
+   {
+      return p->colorTableLut_;
+   }
+}
+
+std::uint16_t Level2DerivedView::color_table_min() const
+{
+   if (p->colorTableLut_.size() == 0)
+   {
+      return RadarProductView::color_table_min();
+   }
+   else
+   {
+      return p->colorTableMin_;
+   }
+}
+
+std::uint16_t Level2DerivedView::color_table_max() const
+{
+   if (p->colorTableLut_.size() == 0)
+   {
+      return RadarProductView::color_table_max();
+   }
+   else
+   {
+      return p->colorTableMax_;
+   }
+}
+
+float Level2DerivedView::range() const
+{
+   return p->range_;
+}
+
+std::chrono::system_clock::time_point Level2DerivedView::sweep_time() const
+{
+   return p->sweepTime_;
+}
+
+float Level2DerivedView::unit_scale() const
+{
+   return 1.0f;
+}
+
+std::string Level2DerivedView::units() const
+{
+   if (p->otherUnits_ == types::OtherUnits::Default)
+   {
+      auto it = productUnits_.find(p->product_);
+      if (it != productUnits_.cend())
+      {
+         return it->second;
+      }
+   }
+
+   return {};
+}
+
+std::uint16_t Level2DerivedView::vcp() const
+{
+   return p->vcp_;
+}
+
+const std::vector<float>& Level2DerivedView::vertices() const
+{
+   return p->vertices_;
+}
+
+common::RadarProductGroup Level2DerivedView::GetRadarProductGroup() const
+{
+   return common::RadarProductGroup::Level2;
+}
+
+std::string Level2DerivedView::GetRadarProductName() const
+{
+   return common::GetLevel2Name(p->product_);
+}
+
+std::tuple<const void*, std::size_t, std::size_t>
+Level2DerivedView::GetMomentData() const
+{
+   const void* data          = p->dataMoments8_.data();
+   std::size_t dataSize      = p->dataMoments8_.size() * sizeof(std::uint8_t);
+   std::size_t componentSize = 1;
+
+   return std::tie(data, dataSize, componentSize);
+}
+
+bool Level2DerivedView::MaskZeroDataMoment() const
+{
+   // Vertices are stored for every bin, and bins without data are stored with
+   // a data moment of 0, so the vertices can be reused by other products
+   return true;
+}
+
+void Level2DerivedView::LoadColorTable(
+   std::shared_ptr<common::ColorTable> colorTable)
+{
+   std::unique_lock sweepLock {sweep_mutex()};
+
+   p->colorTable_ = colorTable;
+   UpdateColorTableLut();
+}
+
+void Level2DerivedView::SelectProduct(const std::string& productName)
+{
+   common::Level2Product product = common::GetLevel2Product(productName);
+
+   if (!wsr88d::DerivedProducts::IsDerivedProduct(product))
+   {
+      logger_->warn("Product is not derived: \"{}\"", productName);
+      return;
+   }
+
+   std::unique_lock sweepLock {sweep_mutex()};
+
+   p->product_ = product;
+}
+
+void Level2DerivedView::Impl::UpdateOtherUnits(const std::string& name)
+{
+   otherUnits_ = types::GetOtherUnitsFromName(name);
+}
+
+void Level2DerivedView::UpdateColorTableLut()
+{
+   if (p->derivedProducts_ == nullptr || //
+       p->colorTable_ == nullptr ||      //
+       !p->colorTable_->IsValid())
+   {
+      // Nothing to update
+      return;
+   }
+
+   const float offset = p->derivedProducts_->offset(p->sweepProduct_);
+   const float scale  = p->derivedProducts_->scale(p->sweepProduct_);
+
+   if (p->savedColorTable_ == p->colorTable_ && //
+       p->savedOffset_ == offset &&             //
+       p->savedScale_ == scale)
+   {
+      // The color table LUT does not need updated
+      return;
+   }
+
+   // Derived products are stored as 8-bit levels, where level 0 has no data
+   constexpr std::uint16_t rangeMin = 1u;
+   constexpr std::uint16_t rangeMax = 255u;
+
+   boost::integer_range<std::uint16_t> dataRange =
+      boost::irange<std::uint16_t>(rangeMin, rangeMax + 1);
+
+   std::vector<boost::gil::rgba8_pixel_t>& lut = p->colorTableLut_;
+   lut.resize(rangeMax - rangeMin + 1);
+   lut.shrink_to_fit();
+
+   std::for_each(std::execution::par_unseq,
+                 dataRange.begin(),
+                 dataRange.end(),
+                 [&](std::uint16_t i)
+                 {
+                    float f                     = (i - offset) / scale;
+                    lut[i - *dataRange.begin()] = p->colorTable_->Color(f);
+                 });
+
+   p->colorTableMin_ = rangeMin;
+   p->colorTableMax_ = rangeMax;
+
+   p->savedColorTable_ = p->colorTable_;
+   p->savedOffset_     = offset;
+   p->savedScale_      = scale;
+
+   Q_EMIT ColorTableLutUpdated();
+}
+
+void Level2DerivedView::ComputeSweep()
+{
+   logger_->debug("ComputeSweep()");
+
+   boost::timer::cpu_timer timer;
+
+   std::scoped_lock sweepLock(sweep_mutex());
+
+   std::shared_ptr<manager::RadarProductManager> radarProductManager =
+      radar_product_manager();
+
+   std::shared_ptr<const wsr88d::DerivedProducts> derivedProducts;
+   std::chrono::system_clock::time_point requestedTime {selected_time()};
+   std::chrono::system_clock::time_point foundTime;
+   std::tie(derivedProducts, foundTime) =
+      radarProductManager->GetLevel2DerivedProducts(requestedTime);
+
+   // If a different time was found than what was requested, update it
+   if (requestedTime != foundTime)
+   {
+      SelectTime(foundTime);
+   }
+
+   if (derivedProducts == nullptr)
+   {
+      Q_EMIT SweepNotComputed(types::NoUpdateReason::NotLoaded);
+      return;
+   }
+   if (derivedProducts == p->derivedProducts_ &&
+       p->product_ == p->sweepProduct_)
+   {
+      Q_EMIT SweepNotComputed(types::NoUpdateReason::NoChange);
+      return;
+   }
+
+   auto elevationScan = derivedProducts->elevation_scan();
+
+   if (elevationScan == nullptr || derivedProducts->gates() == 0u)
+   {
+      logger_->warn("No derived products for {}",
+                    common::GetLevel2Name(p->product_));
+      Q_EMIT SweepNotComputed(types::NoUpdateReason::InvalidData);
+      return;
+   }
+
+   p->derivedProducts_ = derivedProducts;
+   p->sweepProduct_    = p->product_;
+   p->azimuthLookup_   = std::make_shared<const scwx::util::AzimuthLookup>(
+      derivedProducts->azimuths());
+
+   p->range_ = static_cast<float>(
+      (derivedProducts->first_gate_range() +
+       derivedProducts->gate_interval() * (derivedProducts->gates() - 0.5)) /
+      1000.0);
+   p->sweepTime_ = elevationScan->start_time();
+   p->vcp_       = elevationScan->volume_coverage_pattern_number();
+
+   // Coordinates are shared with views of the lowest elevation cut
+   std::shared_ptr<const std::vector<float>> coordinatesPtr =
+      radarProductManager->GetRadialCoordinates(derivedProducts->azimuths(),
+                                                common::MAX_DATA_MOMENT_GATES);
+
+   // The vertices are reused if the coordinates and gate layout are unchanged,
+   // such as when selecting a different derived product, or when a cut is added
+   // to the volume. Only the data moments are refilled.
+   const bool geometryChanged =
+      p->coordinates_ != coordinatesPtr ||
+      p->gates_ != derivedProducts->gates() ||
+      p->firstGateRange_ != derivedProducts->first_gate_range() ||
+      p->gateInterval_ != derivedProducts->gate_interval();
+
+   timer.start();
+
+   if (geometryChanged)
+   {
+      p->ComputeVertices(coordinatesPtr);
+   }
+
+   p->ComputeDataMoments();
+
+   timer.stop();
+   logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
+
+   if (geometryChanged)
+   {
+      UpdateVerticesGeneration();
+   }
+
+   UpdateColorTableLut();
+
+   Q_EMIT SweepComputed();
+}
+
+void Level2DerivedView::Impl::ComputeVertices(
+   const std::shared_ptr<const std::vector<float>>& coordinatesPtr)
+{
+   std::shared_ptr<manager::RadarProductManager> radarProductManager =
+      self_->radar_product_manager();
+
+   const std::vector<float>& coordinates = *coordinatesPtr;
+
+   auto        radarSite = radarProductManager->radar_site();
+   const float latitude  = static_cast<float>(radarSite->latitude());
+   const float longitude = static_cast<float>(radarSite->longitude());
+
+   gates_          = derivedProducts_->gates();
+   firstGateRange_ = derivedProducts_->first_gate_range();
+   gateInterval_   = derivedProducts_->gate_interval();
+   coordinates_    = coordinatesPtr;
+
+   const std::size_t radials = derivedProducts_->radial_count();
+
+   // Compute gate size (number of base 250m gates per bin)
+   const std::int32_t gateSizeMeters =
+      static_cast<std::int32_t>(radarProductManager->gate_size());
+
+   // Compute gate interval
+   const std::int32_t dataMomentInterval =
+      static_cast<std::int32_t>(std::lround(gateInterval_));
+   const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
+   const std::int32_t dataMomentRange     = std::max<std::int32_t>(
+      static_cast<std::int32_t>(std::lround(firstGateRange_)),
+      dataMomentIntervalH);
+
+   const std::int32_t gateSize =
+      std::max<std::int32_t>(1, dataMomentInterval / gateSizeMeters);
+
+   // Compute gate range [startGate, endGate)
+   const std::int32_t startGate =
+      (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
+   const std::int32_t endGate = std::min<std::int32_t>(
+      startGate + static_cast<std::int32_t>(gates_) * gateSize,
+      static_cast<std::int32_t>(common::MAX_DATA_MOMENT_GATES));
+
+   // Every radial shares the same gate layout, so each radial stores the same
+   // number of vertices, and may be stored independently
+   std::size_t binsPerRadial  = 0u;
+   std::size_t radialVertices = 0u;
+   for (std::int32_t gate = startGate; gate + gateSize <= endGate;
+        gate += gateSize)
+   {
+      ++binsPerRadial;
+      radialVertices += (gate > 0) ? 6 : 3;
+   }
+
+   // The first bin is a triangle from the radar site if it begins at the radar
+   binsPerRadial_    = binsPerRadial;
+   firstBinVertices_ = (startGate > 0) ? 6u : 3u;
+   radialVertices_   = radialVertices;
+
+   vertices_.resize(radials * radialVertices * VALUES_PER_VERTEX);
+   vertices_.shrink_to_fit();
+
+   auto radialRange =
+      boost::irange<std::uint16_t>(0u, static_cast<std::uint16_t>(radials));
+
+   std::for_each(
+      std::execution::par_unseq,
+      radialRange.begin(),
+      radialRange.end(),
+      [&](std::uint16_t radial)
+      {
+         std::size_t vIndex = radial * radialVertices * VALUES_PER_VERTEX;
+
+         for (std::int32_t gate = startGate; gate + gateSize <= endGate;
+              gate += gateSize)
+         {
+            if (gate > 0)
+            {
+               const std::uint16_t baseCoord = gate - 1;
+
+               std::size_t offset1 =
+                  (radial * common::MAX_DATA_MOMENT_GATES + baseCoord) * 2;
+               std::size_t offset2 = offset1 + gateSize * 2;
+               std::size_t offset3 = (((radial + 1) % radials) *
+                                         common::MAX_DATA_MOMENT_GATES +
+                                      baseCoord) *
+                                     2;
+               std::size_t offset4 = offset3 + gateSize * 2;
+
+               vertices_[vIndex++] = coordinates[offset1];
+               vertices_[vIndex++] = coordinates[offset1 + 1];
+
+               vertices_[vIndex++] = coordinates[offset2];
+               vertices_[vIndex++] = coordinates[offset2 + 1];
+
+               vertices_[vIndex++] = coordinates[offset3];
+               vertices_[vIndex++] = coordinates[offset3 + 1];
+
+               vertices_[vIndex++] = coordinates[offset3];
+               vertices_[vIndex++] = coordinates[offset3 + 1];
+
+               vertices_[vIndex++] = coordinates[offset4];
+               vertices_[vIndex++] = coordinates[offset4 + 1];
+
+               vertices_[vIndex++] = coordinates[offset2];
+               vertices_[vIndex++] = coordinates[offset2 + 1];
+            }
+            else
+            {
+               const std::uint16_t baseCoord = gate;
+
+               std::size_t offset1 =
+                  (radial * common::MAX_DATA_MOMENT_GATES + baseCoord) * 2;
+               std::size_t offset2 = (((radial + 1) % radials) *
+                                         common::MAX_DATA_MOMENT_GATES +
+                                      baseCoord) *
+                                     2;
+
+               vertices_[vIndex++] = latitude;
+               vertices_[vIndex++] = longitude;
+
+               vertices_[vIndex++] = coordinates[offset1];
+               vertices_[vIndex++] = coordinates[offset1 + 1];
+
+               vertices_[vIndex++] = coordinates[offset2];
+               vertices_[vIndex++] = coordinates[offset2 + 1];
+            }
+         }
+      });
+}
+
+void Level2DerivedView::Impl::ComputeDataMoments()
+{
+   const std::span<const std::uint8_t> levels =
+      derivedProducts_->levels(sweepProduct_);
+
+   const std::size_t radials = derivedProducts_->radial_count();
+
+   dataMoments8_.resize(radials * radialVertices_);
+   dataMoments8_.shrink_to_fit();
+
+   auto radialRange =
+      boost::irange<std::uint16_t>(0u, static_cast<std::uint16_t>(radials));
+
+   std::for_each(std::execution::par_unseq,
+                 radialRange.begin(),
+                 radialRange.end(),
+                 [&](std::uint16_t radial)
+                 {
+                    std::size_t mIndex = radial * radialVertices_;
+
+                    const std::uint8_t* radialLevels =
+                       levels.data() + radial * gates_;
+
+                    for (std::size_t i = 0; i < binsPerRadial_; ++i)
+                    {
+                       const std::size_t vertexCount =
+                          (i == 0u) ? firstBinVertices_ : 6u;
+
+                       std::fill_n(dataMoments8_.begin() + mIndex,
+                                   vertexCount,
+                                   radialLevels[i]);
+                       mIndex += vertexCount;
+                    }
+                 });
+}
+
+std::optional<std::uint16_t>
+Level2DerivedView::GetBinLevel(const common::Coordinate& coordinate) const
+{
+   return SampleBins({&coordinate, 1u}).front();
+}
+
+std::vector<std::optional<std::uint16_t>> Level2DerivedView::SampleBins(
+   std::span<const common::Coordinate> coordinates) const
+{
+   const auto points = GetPolarCoordinates(coordinates);
+
+   std::unique_lock sweepLock {sweep_mutex()};
+
+   return SamplePolarBins(points);
+}
+
+std::vector<std::optional<std::uint16_t>> Level2DerivedView::SamplePolarBins(
+   std::span<const wsr88d::VolumeIndex::PolarCoordinate> points) const
+{
+   // Must be called with the sweep mutex locked
+   std::vector<std::optional<std::uint16_t>> levels(points.size());
+
+   auto derivedProducts = p->derivedProducts_;
+   auto azimuthLookup   = p->azimuthLookup_;
+   auto product         = p->sweepProduct_;
+
+   if (derivedProducts == nullptr || azimuthLookup == nullptr)
+   {
+      return levels;
+   }
+
+   const std::span<const std::uint8_t> productLevels =
+      derivedProducts->levels(product);
+   const std::size_t gates = derivedProducts->gates();
+
+   if (productLevels.empty() ||
+       azimuthLookup->radial_count() != derivedProducts->radial_count())
+   {
+      return levels;
+   }
+
+   // Each gate is centered on its range
+   const double gateInterval = derivedProducts->gate_interval();
+   const double startRange =
+      derivedProducts->first_gate_range() - gateInterval * 0.5;
+
+   auto sampleBin = [&](const wsr88d::VolumeIndex::PolarCoordinate& point)
+      -> std::optional<std::uint16_t>
+   {
+      if (std::isnan(point.azimuth_))
+      {
+         // If a problem occurred with the geodesic inverse calculation
+         return std::nullopt;
+      }
+
+      std::optional<std::size_t> radial =
+         azimuthLookup->FindRadial(point.azimuth_);
+
+      if (!radial.has_value())
+      {
+         return std::nullopt;
+      }
+
+      const double gate =
+         std::floor((point.distance_ - startRange) / gateInterval);
+
+      if (gate < 0.0 || gate >= static_cast<double>(gates))
+      {
+         // Coordinate is beyond radar range
+         return std::nullopt;
+      }
+
+      const std::uint8_t level =
+         productLevels[*radial * gates + static_cast<std::size_t>(gate)];
+
+      if (level == 0u)
+      {
+         return std::nullopt;
+      }
+
+      return level;
+   };
+
+   std::transform(std::execution::par_unseq,
+                  points.begin(),
+                  points.end(),
+                  levels.begin(),
+                  sampleBin);
+
+   return levels;
+}
+
+std::optional<wsr88d::DataLevelCode>
+Level2DerivedView::GetDataLevelCode([[maybe_unused]] std::uint16_t level) const
+{
+   // Range folded bins are excluded from derived products, and no other data
+   // level codes are used
+   return std::nullopt;
+}
+
+std::optional<float> Level2DerivedView::GetDataValue(std::uint16_t level) const
+{
+   std::unique_lock sweepLock {sweep_mutex()};
+
+   auto derivedProducts = p->derivedProducts_;
+
+   if (derivedProducts == nullptr || level < 2u)
+   {
+      return std::nullopt;
+   }
+
+   const float offset = derivedProducts->offset(p->sweepProduct_);
+   const float scale  = derivedProducts->scale(p->sweepProduct_);
+
+   return (level - offset) / scale;
+}
+
+std::shared_ptr<Level2DerivedView> Level2DerivedView::Create(
+   common::Level2Product                         product,
+   std::shared_ptr<manager::RadarProductManager> radarProductManager)
+{
+   return std::make_shared<Level2DerivedView>(product, radarProductManager);
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
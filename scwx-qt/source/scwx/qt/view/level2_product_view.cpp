@@ -1,13 +1,20 @@
 #include <scwx/qt/view/level2_product_view.hpp>
+#include <scwx/qt/manager/timeline_manager.hpp>
 #include <scwx/qt/settings/unit_settings.hpp>
 #include <scwx/qt/types/unit_types.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/characters.hpp>
 #include <scwx/common/constants.hpp>
+#include <scwx/util/azimuth_lookup.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <execution>
+#include <numeric>
+
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
 
@@ -21,14 +28,12 @@ namespace view
 static const std::string logPrefix_ = "scwx::qt::view::level2_product_view";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
-static constexpr std::uint32_t kMaxRadialGates_ =
-   common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
-static constexpr std::uint32_t kMaxCoordinates_ = kMaxRadialGates_ * 2u;
-
 static constexpr uint16_t RANGE_FOLDED      = 1u;
-static constexpr uint32_t VERTICES_PER_BIN  = 6u;
 static constexpr uint32_t VALUES_PER_VERTEX = 2u;
 
+// Memory budget for sweeps precomputed for adjacent elevation cuts
+static constexpr std::size_t kPrecomputeMemoryBudget_ = 256u * 1024u * 1024u;
+
 static const std::unordered_map<common::Level2Product,
                                 wsr88d::rda::DataBlockType>
    blockTypes_ {
@@ -62,7 +67,7 @@ public:
        product_ {product},
        selectedElevation_ {0.0f},
        elevationScan_ {nullptr},
-       momentDataBlock0_ {nullptr},
+       momentData_ {nullptr},
        latitude_ {},
        longitude_ {},
        elevationCut_ {},
@@ -80,8 +85,6 @@ public:
    {
       auto& unitSettings = settings::UnitSettings::Instance();
 
-      coordinates_.resize(kMaxCoordinates_);
-
       SetProduct(product);
 
       otherUnitsCallbackUuid_ =
@@ -104,10 +107,57 @@ public:
          speedUnitsCallbackUuid_);
 
       threadPool_.join();
+
+      CancelPrecompute();
+      precomputeThreadPool_.join();
+   };
+
+   struct SweepBuffers
+   {
+      std::shared_ptr<wsr88d::rda::FlatElevationScan> elevationScan_ {};
+      wsr88d::rda::DataBlockType                      dataBlockType_ {
+         wsr88d::rda::DataBlockType::Unknown};
+
+      // Coordinates and gate layout from which the vertices were computed. A
+      // sweep with the same coordinates and gate layout reuses the vertices.
+      std::shared_ptr<const std::vector<float>> coordinates_ {};
+      std::vector<wsr88d::rda::FlatElevationScan::MomentData::RadialInfo>
+                               layout_ {};
+      std::vector<std::size_t> radialOffsets_ {};
+
+      std::vector<float>    vertices_ {};
+      std::vector<uint8_t>  dataMoments8_ {};
+      std::vector<uint16_t> dataMoments16_ {};
+      std::vector<uint8_t>  cfpMoments_ {};
+
+      std::size_t memory_usage() const
+      {
+         return vertices_.size() * sizeof(float) + dataMoments8_.size() +
+                dataMoments16_.size() * sizeof(uint16_t) + cfpMoments_.size();
+      }
    };
 
-   void
-   ComputeCoordinates(std::shared_ptr<wsr88d::rda::ElevationScan> radarData);
+   std::shared_ptr<const std::vector<float>> ComputeCoordinates(
+      const std::shared_ptr<wsr88d::rda::FlatElevationScan>& radarData);
+   template<class ExecutionPolicy>
+   bool ComputeSweepBuffers(
+      ExecutionPolicy&&                                      policy,
+      SweepBuffers&                                          buffers,
+      const std::shared_ptr<wsr88d::rda::FlatElevationScan>& radarData,
+      wsr88d::rda::DataBlockType                             dataBlockType,
+      std::optional<std::uint64_t> generation = std::nullopt);
+
+   void        ApplySelection();
+   void        CancelPrecompute();
+   std::size_t PrecomputedMemoryUsage() const;
+   void PrecomputeAdjacentCuts(std::chrono::system_clock::time_point time);
+   void PrecomputeSweeps(std::uint64_t                         generation,
+                         wsr88d::rda::DataBlockType            dataBlockType,
+                         const std::vector<float>&             elevationCuts,
+                         std::chrono::system_clock::time_point time);
+   bool TakePrecomputedSweep(
+      const std::shared_ptr<wsr88d::rda::FlatElevationScan>& radarData,
+      wsr88d::rda::DataBlockType                             dataBlockType);
 
    void SetProduct(const std::string& productName);
    void SetProduct(common::Level2Product product);
@@ -118,20 +168,42 @@ public:
 
    boost::asio::thread_pool threadPool_ {1u};
 
+   // Adjacent elevation cuts are precomputed on a separate worker, so they
+   // never delay the computation of the selected sweep
+   boost::asio::thread_pool   precomputeThreadPool_ {1u};
+   std::mutex                 precomputeMutex_ {};
+   std::atomic<std::uint64_t> precomputeGeneration_ {0u};
+   std::vector<SweepBuffers>  precomputedSweeps_ {};
+
    common::Level2Product      product_;
    wsr88d::rda::DataBlockType dataBlockType_;
 
+   // Product and color table selections are recorded without waiting for a
+   // sweep computation in progress, and are applied with the sweep mutex
+   // locked. The selection mutex also guards writes to the product and color
+   // table, which are read by the UI.
+   mutable std::mutex                                 selectionMutex_ {};
+   std::optional<common::Level2Product>               pendingProduct_ {};
+   std::optional<std::shared_ptr<common::ColorTable>> pendingColorTable_ {};
+
    float selectedElevation_;
 
-   std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan_;
-   std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
-      momentDataBlock0_;
+   std::shared_ptr<wsr88d::rda::FlatElevationScan> elevationScan_;
+   std::shared_ptr<const wsr88d::rda::FlatElevationScan::MomentData>
+                              momentData_;
+   wsr88d::rda::DataBlockType sweepDataBlockType_ {
+      wsr88d::rda::DataBlockType::Unknown};
+
+   // Finds the radial of the elevation scan containing an azimuth
+   std::shared_ptr<const scwx::util::AzimuthLookup> azimuthLookup_ {};
 
-   std::vector<float>    coordinates_ {};
-   std::vector<float>    vertices_ {};
-   std::vector<uint8_t>  dataMoments8_ {};
-   std::vector<uint16_t> dataMoments16_ {};
-   std::vector<uint8_t>  cfpMoments_ {};
+   // The moment data, azimuth lookup and product of the computed sweep are
+   // also written under the sample mutex. Bins are sampled from a copy, so
+   // sampling never waits for a sweep computation in progress.
+   mutable std::mutex    sampleMutex_ {};
+   common::Level2Product sweepProduct_ {};
+
+   SweepBuffers sweep_ {};
 
    float                    latitude_;
    float                    longitude_;
@@ -171,6 +243,39 @@ Level2ProductView::~Level2ProductView()
    std::unique_lock sweepLock {sweep_mutex()};
 }
 
+static std::vector<float>
+GetAzimuths(const wsr88d::rda::FlatElevationScan& radarData)
+{
+   const auto radialHeaders = radarData.radials();
+
+   std::vector<float> azimuths(radialHeaders.size());
+   std::transform(radialHeaders.begin(),
+                  radialHeaders.end(),
+                  azimuths.begin(),
+                  [](const auto& header) { return header.azimuthAngle_; });
+
+   return azimuths;
+}
+
+static bool
+IsTimeInVolume(const std::shared_ptr<types::RadarProductRecord>& record,
+               std::chrono::system_clock::time_point             time)
+{
+   const auto volumeTime =
+      std::chrono::floor<std::chrono::seconds>(record->time());
+
+   if (time == volumeTime)
+   {
+      return true;
+   }
+
+   // Repeated cuts (e.g., SAILS) are selected by a time within the volume
+   auto level2File = record->level2_file();
+
+   return level2File != nullptr && time > volumeTime &&
+          time <= level2File->end_time();
+}
+
 void Level2ProductView::ConnectRadarProductManager()
 {
    connect(radar_product_manager().get(),
@@ -180,14 +285,33 @@ void Level2ProductView::ConnectRadarProductManager()
            {
               if (record->radar_product_group() ==
                      common::RadarProductGroup::Level2 &&
-                  std::chrono::floor<std::chrono::seconds>(record->time()) ==
-                     selected_time())
+                  IsTimeInVolume(record, selected_time()))
               {
                  // If the data associated with the currently selected time is
                  // reloaded, update the view
                  Update();
               }
            });
+   connect(radar_product_manager().get(),
+           &manager::RadarProductManager::Level2ElevationScanAvailable,
+           this,
+           [this](std::shared_ptr<types::RadarProductRecord> record,
+                  float                                      elevationCut)
+           {
+              const bool timeSelected =
+                 selected_time() == std::chrono::system_clock::time_point {} ||
+                 IsTimeInVolume(record, selected_time());
+
+              // Elevation scans become available progressively while a volume
+              // is loading. Update the view when the loaded elevation cut is at
+              // least as near to the selected elevation as the displayed cut.
+              if (timeSelected &&
+                  std::abs(elevationCut - p->selectedElevation_) <=
+                     std::abs(elevation() - p->selectedElevation_))
+              {
+                 Update();
+              }
+           });
 }
 
 void Level2ProductView::DisconnectRadarProductManager()
@@ -196,6 +320,10 @@ void Level2ProductView::DisconnectRadarProductManager()
               &manager::RadarProductManager::DataReloaded,
               this,
               nullptr);
+   disconnect(radar_product_manager().get(),
+              &manager::RadarProductManager::Level2ElevationScanAvailable,
+              this,
+              nullptr);
 }
 
 boost::asio::thread_pool& Level2ProductView::thread_pool()
@@ -205,7 +333,9 @@ boost::asio::thread_pool& Level2ProductView::thread_pool()
 
 std::shared_ptr<common::ColorTable> Level2ProductView::color_table() const
 {
-   return p->colorTable_;
+   std::unique_lock selectionLock {p->selectionMutex_};
+
+   return p->pendingColorTable_.value_or(p->colorTable_);
 }
 
 const std::vector<boost::gil::rgba8_pixel_t>&
@@ -306,7 +436,7 @@ uint16_t Level2ProductView::vcp() const
 
 const std::vector<float>& Level2ProductView::vertices() const
 {
-   return p->vertices_;
+   return p->sweep_.vertices_;
 }
 
 common::RadarProductGroup Level2ProductView::GetRadarProductGroup() const
@@ -316,7 +446,9 @@ common::RadarProductGroup Level2ProductView::GetRadarProductGroup() const
 
 std::string Level2ProductView::GetRadarProductName() const
 {
-   return common::GetLevel2Name(p->product_);
+   std::unique_lock selectionLock {p->selectionMutex_};
+
+   return common::GetLevel2Name(p->pendingProduct_.value_or(p->product_));
 }
 
 std::vector<float> Level2ProductView::GetElevationCuts() const
@@ -330,16 +462,16 @@ std::tuple<const void*, size_t, size_t> Level2ProductView::GetMomentData() const
    size_t      dataSize;
    size_t      componentSize;
 
-   if (p->dataMoments8_.size() > 0)
+   if (p->sweep_.dataMoments8_.size() > 0)
    {
-      data          = p->dataMoments8_.data();
-      dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
+      data          = p->sweep_.dataMoments8_.data();
+      dataSize      = p->sweep_.dataMoments8_.size() * sizeof(uint8_t);
       componentSize = 1;
    }
    else
    {
-      data          = p->dataMoments16_.data();
-      dataSize      = p->dataMoments16_.size() * sizeof(uint16_t);
+      data          = p->sweep_.dataMoments16_.data();
+      dataSize      = p->sweep_.dataMoments16_.size() * sizeof(uint16_t);
       componentSize = 2;
    }
 
@@ -353,20 +485,40 @@ Level2ProductView::GetCfpMomentData() const
    size_t      dataSize      = 0;
    size_t      componentSize = 1;
 
-   if (p->cfpMoments_.size() > 0)
+   if (p->sweep_.cfpMoments_.size() > 0)
    {
-      data     = p->cfpMoments_.data();
-      dataSize = p->cfpMoments_.size() * sizeof(uint8_t);
+      data     = p->sweep_.cfpMoments_.data();
+      dataSize = p->sweep_.cfpMoments_.size() * sizeof(uint8_t);
    }
 
    return std::tie(data, dataSize, componentSize);
 }
 
+bool Level2ProductView::MaskZeroDataMoment() const
+{
+   // Bins below threshold are stored with a data moment of 0, so the vertices
+   // can be reused by other data moments
+   return true;
+}
+
 void Level2ProductView::LoadColorTable(
    std::shared_ptr<common::ColorTable> colorTable)
 {
-   p->colorTable_ = colorTable;
-   UpdateColorTableLut();
+   {
+      std::unique_lock selectionLock {p->selectionMutex_};
+      p->pendingColorTable_ = colorTable;
+   }
+
+   // The color table is applied on the sweep thread, after any sweep in
+   // progress, so the caller does not wait for the sweep mutex
+   boost::asio::post(p->threadPool_,
+                     [this]()
+                     {
+                        std::unique_lock sweepLock {sweep_mutex()};
+
+                        p->ApplySelection();
+                        UpdateColorTableLut();
+                     });
 }
 
 void Level2ProductView::SelectElevation(float elevation)
@@ -376,7 +528,28 @@ void Level2ProductView::SelectElevation(float elevation)
 
 void Level2ProductView::SelectProduct(const std::string& productName)
 {
-   p->SetProduct(productName);
+   // The product is applied when the next sweep is computed
+   std::unique_lock selectionLock {p->selectionMutex_};
+
+   p->pendingProduct_ = common::GetLevel2Product(productName);
+}
+
+void Level2ProductViewImpl::ApplySelection()
+{
+   // Must be called with the sweep mutex locked
+   std::unique_lock selectionLock {selectionMutex_};
+
+   if (pendingProduct_.has_value())
+   {
+      SetProduct(*pendingProduct_);
+      pendingProduct_.reset();
+   }
+
+   if (pendingColorTable_.has_value())
+   {
+      colorTable_ = std::move(*pendingColorTable_);
+      pendingColorTable_.reset();
+   }
 }
 
 void Level2ProductViewImpl::SetProduct(const std::string& productName)
@@ -386,6 +559,9 @@ void Level2ProductViewImpl::SetProduct(const std::string& productName)
 
 void Level2ProductViewImpl::SetProduct(common::Level2Product product)
 {
+   // Sweeps precomputed for the previous product are no longer needed
+   CancelPrecompute();
+
    product_ = product;
 
    auto it = blockTypes_.find(product);
@@ -413,16 +589,24 @@ void Level2ProductViewImpl::UpdateSpeedUnits(const std::string& name)
 
 void Level2ProductView::UpdateColorTableLut()
 {
-   if (p->momentDataBlock0_ == nullptr || //
-       p->colorTable_ == nullptr ||       //
+   // Must be called with the sweep mutex locked
+   if (p->momentData_ == nullptr ||   //
+       p->colorTable_ == nullptr || //
        !p->colorTable_->IsValid())
    {
       // Nothing to update
       return;
    }
 
-   float offset = p->momentDataBlock0_->offset();
-   float scale  = p->momentDataBlock0_->scale();
+   if (p->sweepDataBlockType_ != p->dataBlockType_)
+   {
+      // The scale and offset of the selected product are not known until its
+      // sweep is computed. The LUT is updated with the sweep.
+      return;
+   }
+
+   float offset = p->momentData_->offset();
+   float scale  = p->momentData_->scale();
 
    if (p->savedColorTable_ == p->colorTable_ && //
        p->savedOffset_ == offset &&             //
@@ -501,20 +685,22 @@ void Level2ProductView::ComputeSweep()
 
    boost::timer::cpu_timer timer;
 
+   std::scoped_lock sweepLock(sweep_mutex());
+
+   p->ApplySelection();
+
    if (p->dataBlockType_ == wsr88d::rda::DataBlockType::Unknown)
    {
       Q_EMIT SweepNotComputed(types::NoUpdateReason::InvalidProduct);
       return;
    }
 
-   std::scoped_lock sweepLock(sweep_mutex());
-
    std::shared_ptr<manager::RadarProductManager> radarProductManager =
       radar_product_manager();
 
-   std::shared_ptr<wsr88d::rda::ElevationScan> radarData;
-   std::chrono::system_clock::time_point       requestedTime {selected_time()};
-   std::chrono::system_clock::time_point       foundTime;
+   std::shared_ptr<wsr88d::rda::FlatElevationScan> radarData;
+   std::chrono::system_clock::time_point requestedTime {selected_time()};
+   std::chrono::system_clock::time_point foundTime;
    std::tie(radarData, p->elevationCut_, p->elevationCuts_, foundTime) =
       radarProductManager->GetLevel2Data(
          p->dataBlockType_, p->selectedElevation_, requestedTime);
@@ -530,22 +716,27 @@ void Level2ProductView::ComputeSweep()
       Q_EMIT SweepNotComputed(types::NoUpdateReason::NotLoaded);
       return;
    }
-   if (radarData == p->elevationScan_)
+   if (radarData == p->elevationScan_ &&
+       p->dataBlockType_ == p->sweepDataBlockType_)
    {
       Q_EMIT SweepNotComputed(types::NoUpdateReason::NoChange);
       return;
    }
 
-   const size_t radials = radarData->size();
+   auto momentData0   = radarData->moment_data(p->dataBlockType_);
+   auto azimuthLookup = std::make_shared<const scwx::util::AzimuthLookup>(
+      GetAzimuths(*radarData));
 
-   p->ComputeCoordinates(radarData);
+   p->elevationScan_      = radarData;
+   p->sweepDataBlockType_ = p->dataBlockType_;
 
-   const std::vector<float>& coordinates = p->coordinates_;
+   {
+      std::unique_lock sampleLock {p->sampleMutex_};
 
-   auto& radarData0     = (*radarData)[0];
-   auto  momentData0    = radarData0->moment_data_block(p->dataBlockType_);
-   p->elevationScan_    = radarData;
-   p->momentDataBlock0_ = momentData0;
+      p->momentData_    = momentData0;
+      p->azimuthLookup_ = std::move(azimuthLookup);
+      p->sweepProduct_  = p->product_;
+   }
 
    if (momentData0 == nullptr)
    {
@@ -555,7 +746,7 @@ void Level2ProductView::ComputeSweep()
       return;
    }
 
-   const uint32_t gates = momentData0->number_of_data_moment_gates();
+   const uint32_t gates = momentData0->gates();
 
    auto radarSite = radarProductManager->radar_site();
    p->latitude_   = radarSite->latitude();
@@ -563,52 +754,97 @@ void Level2ProductView::ComputeSweep()
    p->range_ =
       momentData0->data_moment_range() +
       momentData0->data_moment_range_sample_interval() * (gates - 0.5f);
-   p->sweepTime_ = scwx::util::TimePoint(radarData0->modified_julian_date(),
-                                         radarData0->collection_time());
-   p->vcp_       = radarData0->volume_coverage_pattern_number();
+   p->sweepTime_ = radarData->start_time();
+   p->vcp_       = radarData->volume_coverage_pattern_number();
 
-   // Calculate vertices
+   // Calculate vertices, unless the sweep was already precomputed
    timer.start();
 
-   // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
-   vertices.clear();
-   vertices.resize(radials * gates * VERTICES_PER_BIN * VALUES_PER_VERTEX);
-
-   // Setup data moment vector
-   std::vector<uint8_t>&  dataMoments8  = p->dataMoments8_;
-   std::vector<uint16_t>& dataMoments16 = p->dataMoments16_;
-   std::vector<uint8_t>&  cfpMoments    = p->cfpMoments_;
-   size_t                 mIndex        = 0;
+   bool verticesComputed = true;
 
-   if (momentData0->data_word_size() == 8)
+   if (p->TakePrecomputedSweep(radarData, p->sweepDataBlockType_))
    {
-      dataMoments16.resize(0);
-      dataMoments16.shrink_to_fit();
-
-      dataMoments8.resize(radials * gates * VERTICES_PER_BIN);
+      logger_->debug("Using precomputed sweep");
    }
    else
    {
-      dataMoments8.resize(0);
-      dataMoments8.shrink_to_fit();
+      verticesComputed = p->ComputeSweepBuffers(std::execution::par_unseq,
+                                                p->sweep_,
+                                                radarData,
+                                                p->sweepDataBlockType_);
+   }
+
+   timer.stop();
+   logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
 
-      dataMoments16.resize(radials * gates * VERTICES_PER_BIN);
+   if (verticesComputed)
+   {
+      UpdateVerticesGeneration();
    }
 
-   if (p->dataBlockType_ == wsr88d::rda::DataBlockType::MomentRef &&
-       radarData0->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp) !=
-          nullptr)
+   UpdateColorTableLut();
+
+   Q_EMIT SweepComputed();
+
+   // Each frame of an animation selects a different volume, so adjacent cuts
+   // are not precomputed while animating
+   if (manager::TimelineManager::Instance()->animation_state() ==
+       types::AnimationState::Play)
    {
-      cfpMoments.resize(radials * gates * VERTICES_PER_BIN);
+      p->CancelPrecompute();
    }
    else
    {
-      cfpMoments.resize(0);
-      cfpMoments.shrink_to_fit();
+      p->PrecomputeAdjacentCuts(selected_time());
+   }
+}
+
+template<class ExecutionPolicy>
+bool Level2ProductViewImpl::ComputeSweepBuffers(
+   ExecutionPolicy&&                                      policy,
+   SweepBuffers&                                          buffers,
+   const std::shared_ptr<wsr88d::rda::FlatElevationScan>& radarData,
+   wsr88d::rda::DataBlockType                             dataBlockType,
+   std::optional<std::uint64_t>                           generation)
+{
+   // A precomputed sweep is abandoned once superseded by a newer generation.
+   // The partially computed buffers are discarded by the caller.
+   auto cancelled = [&]()
+   {
+      return generation.has_value() && *generation != precomputeGeneration_;
+   };
+
+   std::shared_ptr<manager::RadarProductManager> radarProductManager =
+      self_->radar_product_manager();
+
+   const size_t radials = radarData->radial_count();
+
+   auto           momentData0 = radarData->moment_data(dataBlockType);
+   const uint32_t gates       = momentData0->gates();
+
+   std::shared_ptr<const std::vector<float>> coordinatesPtr =
+      ComputeCoordinates(radarData);
+
+   const std::vector<float>& coordinates = *coordinatesPtr;
+
+   // Clutter filter power removed is displayed alongside reflectivity
+   std::shared_ptr<const wsr88d::rda::FlatElevationScan::MomentData>
+      cfpMomentData = nullptr;
+   if (dataBlockType == wsr88d::rda::DataBlockType::MomentRef)
+   {
+      cfpMomentData =
+         radarData->moment_data(wsr88d::rda::DataBlockType::MomentCfp);
    }
 
+   auto        radarSite = radarProductManager->radar_site();
+   const float latitude  = static_cast<float>(radarSite->latitude());
+   const float longitude = static_cast<float>(radarSite->longitude());
+
+   std::vector<float>&    vertices      = buffers.vertices_;
+   std::vector<uint8_t>&  dataMoments8  = buffers.dataMoments8_;
+   std::vector<uint16_t>& dataMoments16 = buffers.dataMoments16_;
+   std::vector<uint8_t>&  cfpMoments    = buffers.cfpMoments_;
+
    // Compute threshold at which to display an individual bin (minimum of 2)
    const std::uint16_t snrThreshold =
       std::max<std::int16_t>(2, momentData0->snr_threshold_raw());
@@ -616,28 +852,66 @@ void Level2ProductView::ComputeSweep()
    // Start radial is always 0, as coordinates are calculated for each sweep
    constexpr std::uint16_t startRadial = 0u;
 
-   for (auto& radialPair : *radarData)
+   // Radial headers and data moments are stored contiguously, in radial order
+   const auto radialHeaders = radarData->radials();
+   const auto momentRadials = momentData0->radials();
+
+   // Compute gate size (number of base 250m gates per bin)
+   const std::int32_t gateSizeMeters =
+      static_cast<std::int32_t>(radarProductManager->gate_size());
+
+   // The vertices of the previous sweep are reused if the coordinates and gate
+   // layout are unchanged, such as when selecting a different data moment of
+   // the same elevation scan. Only the data moments are refilled.
+   const bool geometryChanged =
+      buffers.coordinates_ != coordinatesPtr ||
+      !std::equal(momentRadials.begin(),
+                  momentRadials.end(),
+                  buffers.layout_.cbegin(),
+                  buffers.layout_.cend(),
+                  [](const auto& a, const auto& b)
+                  {
+                     return a.dataMomentRange_ == b.dataMomentRange_ &&
+                            a.dataMomentRangeSampleInterval_ ==
+                               b.dataMomentRangeSampleInterval_ &&
+                            a.numberOfDataMomentGates_ ==
+                               b.numberOfDataMomentGates_;
+                  });
+
+   // Counts the vertices of the bins of a radial. Vertices are stored for each
+   // bin with data, so the count depends only on the gate layout. Bins below
+   // threshold are masked by storing a data moment of 0. If storeMoments is
+   // set, the data moments of the radial are stored, and if storeVertices is
+   // set, the vertices of the radial are stored, beginning at vertex mIndex.
+   auto processRadial = [&](std::uint16_t radial,
+                            std::size_t   mIndex,
+                            bool          storeMoments,
+                            bool          storeVertices) -> std::size_t
    {
-      std::uint16_t radial     = radialPair.first;
-      auto&         radialData = radialPair.second;
-      auto momentData = radialData->moment_data_block(p->dataBlockType_);
+      const std::size_t startIndex = mIndex;
+      std::size_t       vIndex     = mIndex * VALUES_PER_VERTEX;
 
-      if (momentData0->data_word_size() != momentData->data_word_size())
+      if (cancelled())
       {
-         logger_->warn("Radial {} has different word size", radial);
-         continue;
+         return 0u;
+      }
+
+      const auto& momentRadial = momentRadials[radial];
+
+      if (!radialHeaders[radial].valid_ ||
+          momentRadial.numberOfDataMomentGates_ == 0)
+      {
+         // Missing radial, or radial without data moments
+         return 0u;
       }
 
       // Compute gate interval
       const std::int32_t dataMomentInterval =
-         momentData->data_moment_range_sample_interval_raw();
+         momentRadial.dataMomentRangeSampleInterval_;
       const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
       const std::int32_t dataMomentRange     = std::max<std::int32_t>(
-         momentData->data_moment_range_raw(), dataMomentIntervalH);
+         momentRadial.dataMomentRange_, dataMomentIntervalH);
 
-      // Compute gate size (number of base 250m gates per bin)
-      const std::int32_t gateSizeMeters =
-         static_cast<std::int32_t>(radarProductManager->gate_size());
       const std::int32_t gateSize =
          std::max<std::int32_t>(1, dataMomentInterval / gateSizeMeters);
 
@@ -645,7 +919,7 @@ void Level2ProductView::ComputeSweep()
       const std::int32_t startGate =
          (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
       const std::int32_t numberOfDataMomentGates =
-         std::min<std::int32_t>(momentData->number_of_data_moment_gates(),
+         std::min<std::int32_t>(momentRadial.numberOfDataMomentGates_,
                                 static_cast<std::int32_t>(gates));
       const std::int32_t endGate = std::min<std::int32_t>(
          startGate + numberOfDataMomentGates * gateSize,
@@ -654,23 +928,25 @@ void Level2ProductView::ComputeSweep()
       const std::uint8_t*  dataMomentsArray8  = nullptr;
       const std::uint16_t* dataMomentsArray16 = nullptr;
       const std::uint8_t*  cfpMomentsArray    = nullptr;
+      std::int32_t         cfpGates           = 0;
 
-      if (momentData->data_word_size() == 8)
+      if (momentData0->data_word_size() == 8)
       {
-         dataMomentsArray8 =
-            reinterpret_cast<const std::uint8_t*>(momentData->data_moments());
+         dataMomentsArray8 = reinterpret_cast<const std::uint8_t*>(
+            momentData0->data_moments(radial));
       }
       else
       {
-         dataMomentsArray16 =
-            reinterpret_cast<const std::uint16_t*>(momentData->data_moments());
+         dataMomentsArray16 = reinterpret_cast<const std::uint16_t*>(
+            momentData0->data_moments(radial));
       }
 
-      if (cfpMoments.size() > 0)
+      if (cfpMomentData != nullptr)
       {
          cfpMomentsArray = reinterpret_cast<const std::uint8_t*>(
-            radialData->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp)
-               ->data_moments());
+            cfpMomentData->data_moments(radial));
+         cfpGates =
+            cfpMomentData->radials()[radial].numberOfDataMomentGates_;
       }
 
       for (std::int32_t gate = startGate, i = 0; gate + gateSize <= endGate;
@@ -681,39 +957,45 @@ void Level2ProductView::ComputeSweep()
             continue;
          }
 
-         std::size_t vertexCount = (gate > 0) ? 6 : 3;
+         const std::size_t vertexCount = (gate > 0) ? 6 : 3;
 
-         // Store data moment value
-         if (dataMomentsArray8 != nullptr)
+         if (storeMoments)
          {
-            std::uint8_t dataValue = dataMomentsArray8[i];
+            std::uint16_t dataValue = (dataMomentsArray8 != nullptr) ?
+                                         dataMomentsArray8[i] :
+                                         dataMomentsArray16[i];
             if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
             {
-               continue;
+               dataValue = 0u;
             }
 
-            for (std::size_t m = 0; m < vertexCount; m++)
+            // Store data moment value
+            if (dataMomentsArray8 != nullptr)
             {
-               dataMoments8[mIndex++] = dataMomentsArray8[i];
+               std::fill_n(dataMoments8.begin() + mIndex,
+                           vertexCount,
+                           static_cast<std::uint8_t>(dataValue));
 
                if (cfpMomentsArray != nullptr)
                {
-                  cfpMoments[mIndex - 1] = cfpMomentsArray[i];
+                  std::fill_n(cfpMoments.begin() + mIndex,
+                              vertexCount,
+                              (i < cfpGates) ? cfpMomentsArray[i] :
+                                               std::uint8_t {0u});
                }
             }
-         }
-         else
-         {
-            std::uint16_t dataValue = dataMomentsArray16[i];
-            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+            else
             {
-               continue;
+               std::fill_n(
+                  dataMoments16.begin() + mIndex, vertexCount, dataValue);
             }
+         }
 
-            for (std::size_t m = 0; m < vertexCount; m++)
-            {
-               dataMoments16[mIndex++] = dataMomentsArray16[i];
-            }
+         mIndex += vertexCount;
+
+         if (!storeVertices)
+         {
+            continue;
          }
 
          // Store vertices
@@ -749,8 +1031,6 @@ void Level2ProductView::ComputeSweep()
 
             vertices[vIndex++] = coordinates[offset2];
             vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertexCount = 6;
          }
          else
          {
@@ -765,253 +1045,483 @@ void Level2ProductView::ComputeSweep()
                                    baseCoord) *
                                   2;
 
-            vertices[vIndex++] = p->latitude_;
-            vertices[vIndex++] = p->longitude_;
+            vertices[vIndex++] = latitude;
+            vertices[vIndex++] = longitude;
 
             vertices[vIndex++] = coordinates[offset1];
             vertices[vIndex++] = coordinates[offset1 + 1];
 
             vertices[vIndex++] = coordinates[offset2];
             vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertexCount = 3;
          }
       }
+
+      return mIndex - startIndex;
+   };
+
+   std::vector<std::size_t>& radialOffsets = buffers.radialOffsets_;
+   auto                      radialRange =
+      boost::irange<std::uint16_t>(0u, static_cast<std::uint16_t>(radials));
+
+   if (geometryChanged)
+   {
+      // First pass: count the vertices of each radial. The prefix sum of the
+      // counts gives the offset at which each radial is stored.
+      radialOffsets.assign(radials + 1u, 0u);
+
+      std::for_each(policy,
+                    radialRange.begin(),
+                    radialRange.end(),
+                    [&](std::uint16_t radial)
+                    {
+                       radialOffsets[radial + 1u] =
+                          processRadial(radial, 0u, false, false);
+                    });
+
+      std::inclusive_scan(
+         radialOffsets.cbegin(), radialOffsets.cend(), radialOffsets.begin());
+   }
+
+   if (cancelled())
+   {
+      return false;
+   }
+
+   const std::size_t vertexCount = radialOffsets[radials];
+
+   // Setup vertex and data moment vectors
+   if (geometryChanged)
+   {
+      vertices.resize(vertexCount * VALUES_PER_VERTEX);
+      vertices.shrink_to_fit();
    }
-   vertices.resize(vIndex);
-   vertices.shrink_to_fit();
 
    if (momentData0->data_word_size() == 8)
    {
-      dataMoments8.resize(mIndex);
+      dataMoments16.resize(0);
+      dataMoments16.shrink_to_fit();
+
+      dataMoments8.resize(vertexCount);
       dataMoments8.shrink_to_fit();
    }
    else
    {
-      dataMoments16.resize(mIndex);
+      dataMoments8.resize(0);
+      dataMoments8.shrink_to_fit();
+
+      dataMoments16.resize(vertexCount);
       dataMoments16.shrink_to_fit();
    }
 
-   if (cfpMoments.size() > 0)
+   cfpMoments.resize((cfpMomentData != nullptr) ? vertexCount : 0u);
+   cfpMoments.shrink_to_fit();
+
+   // Second pass: store each radial, in parallel unless a sequential policy
+   // was given
+   std::for_each(policy,
+                 radialRange.begin(),
+                 radialRange.end(),
+                 [&](std::uint16_t radial)
+                 {
+                    processRadial(
+                       radial, radialOffsets[radial], true, geometryChanged);
+                 });
+
+   if (cancelled())
    {
-      cfpMoments.resize(mIndex);
-      cfpMoments.shrink_to_fit();
+      return false;
    }
 
-   timer.stop();
-   logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
+   buffers.elevationScan_ = radarData;
+   buffers.dataBlockType_ = dataBlockType;
 
-   UpdateColorTableLut();
+   if (geometryChanged)
+   {
+      buffers.coordinates_ = std::move(coordinatesPtr);
+      buffers.layout_.assign(momentRadials.begin(), momentRadials.end());
+   }
 
-   Q_EMIT SweepComputed();
+   return geometryChanged;
 }
 
-void Level2ProductViewImpl::ComputeCoordinates(
-   std::shared_ptr<wsr88d::rda::ElevationScan> radarData)
+void Level2ProductViewImpl::CancelPrecompute()
 {
-   logger_->debug("ComputeCoordinates()");
+   std::unique_lock lock {precomputeMutex_};
 
-   boost::timer::cpu_timer timer;
+   ++precomputeGeneration_;
+   precomputedSweeps_.clear();
+}
 
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
+std::size_t Level2ProductViewImpl::PrecomputedMemoryUsage() const
+{
+   // Must be called with the precompute mutex locked
+   std::size_t memoryUsage = 0u;
 
-   auto         radarProductManager = self_->radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const float  gateSize            = radarProductManager->gate_size();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
+   for (auto& sweep : precomputedSweeps_)
+   {
+      memoryUsage += sweep.memory_usage();
+   }
 
-   // Calculate azimuth coordinates
-   timer.start();
+   return memoryUsage;
+}
 
-   auto& radarData0  = (*radarData)[0];
-   auto  momentData0 = radarData0->moment_data_block(dataBlockType_);
+void Level2ProductViewImpl::PrecomputeAdjacentCuts(
+   std::chrono::system_clock::time_point time)
+{
+   // Must be called with the sweep mutex locked. Scheduling new work supersedes
+   // any precomputation in progress.
+   const std::uint64_t generation = ++precomputeGeneration_;
 
-   const std::uint16_t numRadials =
-      static_cast<std::uint16_t>(radarData->size());
-   const std::uint16_t numRangeBins =
-      std::max(momentData0->number_of_data_moment_gates() + 1u,
-               common::MAX_DATA_MOMENT_GATES);
+   std::vector<float> adjacentCuts {};
 
-   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-   auto gates   = boost::irange<std::uint32_t>(0u, numRangeBins);
+   auto it = std::min_element(elevationCuts_.cbegin(),
+                              elevationCuts_.cend(),
+                              [this](float a, float b)
+                              {
+                                 return std::abs(a - elevationCut_) <
+                                        std::abs(b - elevationCut_);
+                              });
 
-   std::for_each(std::execution::par_unseq,
-                 radials.begin(),
-                 radials.end(),
-                 [&](std::uint32_t radial)
-                 {
-                    const units::degrees<float> angle =
-                       (*radarData)[radial]->azimuth_angle();
-
-                    std::for_each(std::execution::par_unseq,
-                                  gates.begin(),
-                                  gates.end(),
-                                  [&](std::uint32_t gate)
-                                  {
-                                     const std::uint32_t radialGate =
-                                        radial * common::MAX_DATA_MOMENT_GATES +
-                                        gate;
-                                     const float range = (gate + 1) * gateSize;
-                                     const std::size_t offset = radialGate * 2;
-
-                                     double latitude;
-                                     double longitude;
-
-                                     geodesic.Direct(radarLatitude,
-                                                     radarLongitude,
-                                                     angle.value(),
-                                                     range,
-                                                     latitude,
-                                                     longitude);
-
-                                     coordinates_[offset]     = latitude;
-                                     coordinates_[offset + 1] = longitude;
-                                  });
-                 });
-   timer.stop();
-   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+   if (it != elevationCuts_.cend())
+   {
+      if (it != elevationCuts_.cbegin())
+      {
+         adjacentCuts.push_back(*std::prev(it));
+      }
+      if (std::next(it) != elevationCuts_.cend())
+      {
+         adjacentCuts.push_back(*std::next(it));
+      }
+   }
+
+   boost::asio::post(
+      precomputeThreadPool_,
+      [=, this, dataBlockType = sweepDataBlockType_]()
+      { PrecomputeSweeps(generation, dataBlockType, adjacentCuts, time); });
 }
 
-std::optional<std::uint16_t>
-Level2ProductView::GetBinLevel(const common::Coordinate& coordinate) const
+void Level2ProductViewImpl::PrecomputeSweeps(
+   std::uint64_t                         generation,
+   wsr88d::rda::DataBlockType            dataBlockType,
+   const std::vector<float>&             elevationCuts,
+   std::chrono::system_clock::time_point time)
 {
-   auto radarData     = p->elevationScan_;
-   auto dataBlockType = p->dataBlockType_;
+   std::shared_ptr<manager::RadarProductManager> radarProductManager =
+      self_->radar_product_manager();
 
-   if (radarData == nullptr)
+   // Find the elevation scans of the adjacent cuts in the selected volume
+   std::vector<std::shared_ptr<wsr88d::rda::FlatElevationScan>> radarData {};
+
+   for (float elevationCut : elevationCuts)
    {
-      return std::nullopt;
+      if (generation != precomputeGeneration_)
+      {
+         return;
+      }
+
+      auto elevationScan = std::get<0>(radarProductManager->GetLevel2Data(
+         dataBlockType, elevationCut, time));
+
+      if (elevationScan != nullptr)
+      {
+         radarData.push_back(std::move(elevationScan));
+      }
    }
 
-   auto         radarProductManager = radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
-
-   // Determine distance and azimuth of coordinate relative to radar location
-   double s12;  // Distance (meters)
-   double azi1; // Azimuth (degrees)
-   double azi2; // Unused
-   util::GeographicLib::DefaultGeodesic().Inverse(radarLatitude,
-                                                  radarLongitude,
-                                                  coordinate.latitude_,
-                                                  coordinate.longitude_,
-                                                  s12,
-                                                  azi1,
-                                                  azi2);
-
-   if (std::isnan(azi1))
+   auto isAdjacent = [&](const SweepBuffers& sweep)
    {
-      // If a problem occurred with the geodesic inverse calculation
-      return std::nullopt;
-   }
+      return sweep.dataBlockType_ == dataBlockType &&
+             std::find(radarData.cbegin(),
+                       radarData.cend(),
+                       sweep.elevationScan_) != radarData.cend();
+   };
 
-   // Azimuth is returned as [-180, 180) from the geodesic inverse, we need a
-   // range of [0, 360)
-   while (azi1 < 0.0)
+   // Discard sweeps which are no longer adjacent to the selected sweep
    {
-      azi1 += 360.0;
+      std::unique_lock lock {precomputeMutex_};
+
+      if (generation != precomputeGeneration_)
+      {
+         return;
+      }
+
+      std::erase_if(precomputedSweeps_,
+                    [&](const SweepBuffers& sweep)
+                    { return !isAdjacent(sweep); });
    }
 
-   // Find Radial
-   const std::uint16_t numRadials =
-      static_cast<std::uint16_t>(radarData->size());
-   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
+   for (auto& elevationScan : radarData)
+   {
+      auto momentData = elevationScan->moment_data(dataBlockType);
 
-   auto radial = std::find_if( //
-      std::execution::par_unseq,
-      radials.begin(),
-      radials.end(),
-      [&](std::uint32_t i)
+      if (momentData == nullptr)
       {
-         bool                        found = false;
-         const units::degrees<float> startAngle =
-            (*radarData)[i]->azimuth_angle();
-         const units::degrees<float> nextAngle =
-            (*radarData)[(i + 1) % numRadials]->azimuth_angle();
+         continue;
+      }
+
+      // Each bin has at most 6 vertices, and each vertex has a coordinate, a
+      // data moment and, for reflectivity, a clutter filter power removed value
+      const std::size_t bytesPerVertex =
+         VALUES_PER_VERTEX * sizeof(float) +
+         ((momentData->data_word_size() == 8) ? 1u : 2u) +
+         ((dataBlockType == wsr88d::rda::DataBlockType::MomentRef) ? 1u : 0u);
 
-         if (startAngle < nextAngle)
+      std::size_t bins = 0u;
+      for (auto& radial : momentData->radials())
+      {
+         bins += radial.numberOfDataMomentGates_;
+      }
+
+      const std::size_t estimatedMemoryUsage = bins * 6u * bytesPerVertex;
+
+      {
+         std::unique_lock lock {precomputeMutex_};
+
+         if (generation != precomputeGeneration_)
          {
-            if (startAngle.value() <= azi1 && azi1 < nextAngle.value())
+            return;
+         }
+
+         const bool computed = std::any_of(
+            precomputedSweeps_.cbegin(),
+            precomputedSweeps_.cend(),
+            [&](const SweepBuffers& sweep)
             {
-               found = true;
-            }
+               return sweep.elevationScan_ == elevationScan &&
+                      sweep.dataBlockType_ == dataBlockType;
+            });
+
+         if (computed)
+         {
+            continue;
          }
-         else
+         if (PrecomputedMemoryUsage() + estimatedMemoryUsage >
+             kPrecomputeMemoryBudget_)
          {
-            // If the bin crosses 0/360 degrees, special handling is needed
-            if (startAngle.value() <= azi1 || azi1 < nextAngle.value())
-            {
-               found = true;
-            }
+            logger_->debug("Precompute memory budget exceeded");
+            continue;
          }
+      }
 
-         return found;
-      });
+      // The sweep is computed sequentially, so precomputation stays on its
+      // single worker instead of occupying every core
+      SweepBuffers sweep {};
+      ComputeSweepBuffers(std::execution::seq,
+                          sweep,
+                          elevationScan,
+                          dataBlockType,
+                          generation);
 
-   if (radial == radials.end())
+      std::unique_lock lock {precomputeMutex_};
+
+      if (generation != precomputeGeneration_)
+      {
+         return;
+      }
+
+      // The estimate may differ from the computed sweep, so the budget is
+      // checked again before the sweep is stored
+      if (PrecomputedMemoryUsage() + sweep.memory_usage() >
+          kPrecomputeMemoryBudget_)
+      {
+         logger_->debug("Precompute memory budget exceeded");
+         continue;
+      }
+
+      precomputedSweeps_.push_back(std::move(sweep));
+   }
+}
+
+bool Level2ProductViewImpl::TakePrecomputedSweep(
+   const std::shared_ptr<wsr88d::rda::FlatElevationScan>& radarData,
+   wsr88d::rda::DataBlockType                             dataBlockType)
+{
+   // Must be called with the sweep mutex locked
+   std::unique_lock lock {precomputeMutex_};
+
+   auto it = std::find_if(precomputedSweeps_.begin(),
+                          precomputedSweeps_.end(),
+                          [&](const SweepBuffers& sweep)
+                          {
+                             return sweep.elevationScan_ == radarData &&
+                                    sweep.dataBlockType_ == dataBlockType;
+                          });
+
+   if (it == precomputedSweeps_.end())
    {
-      // No radial was found (not likely to happen without a gap in data)
-      return std::nullopt;
+      return false;
    }
 
-   // Compute gate interval
-   auto momentData = (*radarData)[*radial]->moment_data_block(dataBlockType);
-   const std::int32_t dataMomentInterval =
-      momentData->data_moment_range_sample_interval_raw();
-   const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
-   const std::int32_t dataMomentRange     = std::max<std::int32_t>(
-      momentData->data_moment_range_raw(), dataMomentIntervalH);
+   // Swap the buffers, keeping the previous sweep, which is likely adjacent
+   std::swap(*it, sweep_);
 
-   // Compute gate size (number of base 250m gates per bin)
-   const std::int32_t gateSizeMeters =
-      static_cast<std::int32_t>(radarProductManager->gate_size());
+   // The previous sweep is only kept if it is within the memory budget
+   if (it->elevationScan_ == nullptr ||
+       PrecomputedMemoryUsage() > kPrecomputeMemoryBudget_)
+   {
+      precomputedSweeps_.erase(it);
+   }
+
+   return true;
+}
+
+std::shared_ptr<const std::vector<float>>
+Level2ProductViewImpl::ComputeCoordinates(
+   const std::shared_ptr<wsr88d::rda::FlatElevationScan>& radarData)
+{
+   logger_->debug("ComputeCoordinates()");
+
+   const std::vector<float> azimuths = GetAzimuths(*radarData);
 
-   // Compute gate range [startGate, endGate)
-   const std::int32_t startGate =
-      (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
-   const std::int32_t numberOfDataMomentGates =
-      momentData->number_of_data_moment_gates();
+   // Coordinates are shared with other views of the same radar site and
+   // elevation cut, and are only calculated if they are not already cached
+   return self_->radar_product_manager()->GetRadialCoordinates(
+      azimuths, common::MAX_DATA_MOMENT_GATES);
+}
+
+std::optional<std::uint16_t>
+Level2ProductView::GetBinLevel(const common::Coordinate& coordinate) const
+{
+   return SampleBins({&coordinate, 1u}).front();
+}
+
+std::vector<std::optional<std::uint16_t>> Level2ProductView::SampleBins(
+   std::span<const common::Coordinate> coordinates) const
+{
+   const auto points = GetPolarCoordinates(coordinates);
+
+   return SamplePolarBins(points);
+}
 
-   const std::int32_t gate = s12 / dataMomentInterval - startGate;
+std::vector<std::optional<std::uint16_t>> Level2ProductView::SamplePolarBins(
+   std::span<const wsr88d::VolumeIndex::PolarCoordinate> points) const
+{
+   std::vector<std::optional<std::uint16_t>> levels(points.size());
+
+   // The moment data of the computed sweep is sampled, which may differ from
+   // the selected product until the sweep of the selected product is computed.
+   // The sweep mutex is not required, as the moment data is copied under the
+   // sample mutex.
+   std::shared_ptr<const wsr88d::rda::FlatElevationScan::MomentData>
+                                                    momentData;
+   std::shared_ptr<const scwx::util::AzimuthLookup> azimuthLookup;
 
-   if (gate < 0 || gate > numberOfDataMomentGates ||
-       gate > static_cast<std::int32_t>(common::MAX_DATA_MOMENT_GATES))
    {
-      // Coordinate is beyond radar range
-      return std::nullopt;
+      std::unique_lock sampleLock {p->sampleMutex_};
+
+      momentData    = p->momentData_;
+      azimuthLookup = p->azimuthLookup_;
+   }
+
+   if (momentData == nullptr || azimuthLookup == nullptr ||
+       azimuthLookup->radial_count() != momentData->radials().size())
+   {
+      return levels;
    }
 
+   auto radarProductManager = radar_product_manager();
+
+   // Compute gate size (number of base 250m gates per bin)
+   const std::int32_t gateSizeMeters =
+      static_cast<std::int32_t>(radarProductManager->gate_size());
+
    // Compute threshold at which to display an individual bin (minimum of 2)
    const std::uint16_t snrThreshold =
       std::max<std::int16_t>(2, momentData->snr_threshold_raw());
-   std::uint16_t level;
 
-   if (momentData->data_word_size() == 8)
-   {
-      level =
-         reinterpret_cast<const uint8_t*>(momentData->data_moments())[gate];
-   }
-   else
+   auto sampleBin = [&](const wsr88d::VolumeIndex::PolarCoordinate& point)
+      -> std::optional<std::uint16_t>
    {
-      level =
-         reinterpret_cast<const uint16_t*>(momentData->data_moments())[gate];
-   }
+      const double s12  = point.distance_; // Distance (meters)
+      const double azi1 = point.azimuth_;  // Azimuth (degrees)
 
-   if (level < snrThreshold && level != RANGE_FOLDED)
-   {
-      return std::nullopt;
-   }
+      if (std::isnan(azi1))
+      {
+         // If a problem occurred with the geodesic inverse calculation
+         return std::nullopt;
+      }
+
+      // Find radial from the azimuth lookup table. Azimuth is returned as
+      // [-180, 180) from the geodesic inverse, and is wrapped by the lookup.
+      std::optional<std::size_t> radial = azimuthLookup->FindRadial(azi1);
+
+      if (!radial.has_value())
+      {
+         // No radial was found (not likely to happen without a gap in data)
+         return std::nullopt;
+      }
 
-   return level;
+      const auto& momentRadial = momentData->radials()[*radial];
+
+      if (momentRadial.numberOfDataMomentGates_ == 0)
+      {
+         // Missing radial, or radial without data moments
+         return std::nullopt;
+      }
+
+      // Compute gate interval
+      const std::int32_t dataMomentInterval =
+         momentRadial.dataMomentRangeSampleInterval_;
+      const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
+      const std::int32_t dataMomentRange     = std::max<std::int32_t>(
+         momentRadial.dataMomentRange_, dataMomentIntervalH);
+
+      // Compute gate range [startGate, endGate)
+      const std::int32_t startGate =
+         (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
+      const std::int32_t numberOfDataMomentGates =
+         momentRadial.numberOfDataMomentGates_;
+
+      const std::int32_t gate = s12 / dataMomentInterval - startGate;
+
+      if (gate < 0 || gate >= numberOfDataMomentGates ||
+          gate > static_cast<std::int32_t>(common::MAX_DATA_MOMENT_GATES))
+      {
+         // Coordinate is beyond radar range
+         return std::nullopt;
+      }
+
+      std::uint16_t level;
+
+      if (momentData->data_word_size() == 8)
+      {
+         level = reinterpret_cast<const uint8_t*>(
+            momentData->data_moments(*radial))[gate];
+      }
+      else
+      {
+         level = reinterpret_cast<const uint16_t*>(
+            momentData->data_moments(*radial))[gate];
+      }
+
+      if (level < snrThreshold && level != RANGE_FOLDED)
+      {
+         return std::nullopt;
+      }
+
+      return level;
+   };
+
+   std::transform(std::execution::par_unseq,
+                  points.begin(),
+                  points.end(),
+                  levels.begin(),
+                  sampleBin);
+
+   return levels;
 }
 
 std::optional<wsr88d::DataLevelCode>
 Level2ProductView::GetDataLevelCode(std::uint16_t level) const
 {
-   switch (p->product_)
+   std::unique_lock sampleLock {p->sampleMutex_};
+
+   if (p->momentData_ == nullptr)
+   {
+      return std::nullopt;
+   }
+
+   switch (p->sweepProduct_)
    {
    case common::Level2Product::Reflectivity:
    case common::Level2Product::Velocity:
@@ -1054,11 +1564,18 @@ Level2ProductView::GetDataLevelCode(std::uint16_t level) const
 
 std::optional<float> Level2ProductView::GetDataValue(std::uint16_t level) const
 {
-   const float   offset    = p->momentDataBlock0_->offset();
-   const float   scale     = p->momentDataBlock0_->scale();
+   std::unique_lock sampleLock {p->sampleMutex_};
+
+   if (p->momentData_ == nullptr)
+   {
+      return std::nullopt;
+   }
+
+   const float   offset    = p->momentData_->offset();
+   const float   scale     = p->momentData_->scale();
    std::uint16_t threshold = std::numeric_limits<std::uint16_t>::max();
 
-   switch (p->product_)
+   switch (p->sweepProduct_)
    {
    case common::Level2Product::Reflectivity:
    case common::Level2Product::Velocity:
@@ -54,9 +54,15 @@ public:
 
    std::optional<std::uint16_t>
    GetBinLevel(const common::Coordinate& coordinate) const override;
+   std::vector<std::optional<std::uint16_t>>
+   SampleBins(std::span<const common::Coordinate> coordinates) const override;
+   std::vector<std::optional<std::uint16_t>> SamplePolarBins(
+      std::span<const wsr88d::VolumeIndex::PolarCoordinate> points)
+      const override;
    std::optional<wsr88d::DataLevelCode>
                         GetDataLevelCode(std::uint16_t level) const override;
    std::optional<float> GetDataValue(std::uint16_t level) const override;
+   bool                 MaskZeroDataMoment() const override;
 
    static std::shared_ptr<Level2ProductView>
    Create(common::Level2Product                         product,
@@ -1,12 +1,17 @@
 #include <scwx/qt/view/level3_radial_view.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/constants.hpp>
+#include <scwx/util/azimuth_lookup.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/rpg/digital_radial_data_array_packet.hpp>
 #include <scwx/wsr88d/rpg/radial_data_packet.hpp>
 
+#include <algorithm>
+#include <execution>
+#include <numeric>
+
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
 
@@ -20,14 +25,22 @@ namespace view
 static const std::string logPrefix_ = "scwx::qt::view::level3_radial_view";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
-static constexpr std::uint32_t kMaxRadialGates_ =
-   common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
-static constexpr std::uint32_t kMaxCoordinates_ = kMaxRadialGates_ * 2u;
-
 static constexpr std::uint16_t RANGE_FOLDED      = 1u;
-static constexpr std::uint32_t VERTICES_PER_BIN  = 6u;
 static constexpr std::uint32_t VALUES_PER_VERTEX = 2u;
 
+static std::shared_ptr<const scwx::util::AzimuthLookup>
+CreateAzimuthLookup(const wsr88d::rpg::GenericRadialDataPacket& radialData)
+{
+   std::vector<float> startAngles(radialData.number_of_radials());
+
+   for (std::uint16_t i = 0; i < startAngles.size(); ++i)
+   {
+      startAngles[i] = radialData.start_angle(i);
+   }
+
+   return std::make_shared<const scwx::util::AzimuthLookup>(startAngles);
+}
+
 class Level3RadialView::Impl
 {
 public:
@@ -39,7 +52,6 @@ public:
        vcp_ {},
        sweepTime_ {}
    {
-      coordinates_.resize(kMaxCoordinates_);
    }
    ~Impl() { threadPool_.join(); };
 
@@ -50,11 +62,12 @@ public:
 
    boost::asio::thread_pool threadPool_ {1u};
 
-   std::vector<float>        coordinates_ {};
-   std::vector<float>        vertices_ {};
-   std::vector<std::uint8_t> dataMoments8_ {};
+   std::shared_ptr<const std::vector<float>> coordinates_ {};
+   std::vector<float>                        vertices_ {};
+   std::vector<std::uint8_t>                 dataMoments8_ {};
 
    std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket> lastRadialData_ {};
+   std::shared_ptr<const scwx::util::AzimuthLookup>      azimuthLookup_ {};
 
    float         latitude_;
    float         longitude_;
@@ -187,48 +200,21 @@ void Level3RadialView::ComputeSweep()
 
    // A message with radial data should either have a Digital Radial Data
    // Array Packet, or a Radial Data Array Packet
-   std::shared_ptr<wsr88d::rpg::DigitalRadialDataArrayPacket>
-                                                  digitalDataPacket = nullptr;
-   std::shared_ptr<wsr88d::rpg::RadialDataPacket> radialDataPacket  = nullptr;
    std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket> radialData = nullptr;
 
-   for (uint16_t layer = 0; layer < numberOfLayers; layer++)
-   {
-      std::vector<std::shared_ptr<wsr88d::rpg::Packet>> packetList =
-         symbologyBlock->packet_list(layer);
-
-      for (auto it = packetList.begin(); it != packetList.end(); it++)
-      {
-         // Prefer Digital Radial Data to Radial Data
-         digitalDataPacket = std::dynamic_pointer_cast<
-            wsr88d::rpg::DigitalRadialDataArrayPacket>(*it);
-
-         if (digitalDataPacket != nullptr)
-         {
-            break;
-         }
-
-         // Otherwise, check for Radial Data
-         if (radialDataPacket == nullptr)
-         {
-            radialDataPacket =
-               std::dynamic_pointer_cast<wsr88d::rpg::RadialDataPacket>(*it);
-         }
-      }
-
-      if (digitalDataPacket != nullptr)
-      {
-         break;
-      }
-   }
+   // Prefer Digital Radial Data to Radial Data
+   auto digitalDataPackets =
+      gpm->FindPackets<wsr88d::rpg::DigitalRadialDataArrayPacket>();
 
-   if (digitalDataPacket != nullptr)
+   if (!digitalDataPackets.empty())
    {
-      radialData = digitalDataPacket;
+      radialData = digitalDataPackets.front();
    }
-   else if (radialDataPacket != nullptr)
+   else if (auto radialDataPackets =
+               gpm->FindPackets<wsr88d::rpg::RadialDataPacket>();
+            !radialDataPackets.empty())
    {
-      radialData = radialDataPacket;
+      radialData = radialDataPackets.front();
    }
    else
    {
@@ -238,6 +224,7 @@ void Level3RadialView::ComputeSweep()
    }
 
    p->lastRadialData_ = radialData;
+   p->azimuthLookup_  = CreateAzimuthLookup(*radialData);
 
    // Valid number of radials is 1-720
    size_t radials = radialData->number_of_radials();
@@ -262,10 +249,18 @@ void Level3RadialView::ComputeSweep()
       radialSize = common::RadialSize::NonStandard;
    }
 
-   const std::vector<float>& coordinates =
+   if (radialSize == common::RadialSize::NonStandard)
+   {
+      p->ComputeCoordinates(radialData);
+   }
+
+   // Hold a reference to the coordinates, which are replaced if the projection
+   // mode changes
+   const std::shared_ptr<const std::vector<float>> coordinatesPtr =
       (radialSize == common::RadialSize::NonStandard) ?
          p->coordinates_ :
          radarProductManager->coordinates(radialSize);
+   const std::vector<float>& coordinates = *coordinatesPtr;
 
    // There should be a positive number of range bins in radial data
    const uint16_t gates = radialData->number_of_range_bins();
@@ -287,17 +282,8 @@ void Level3RadialView::ComputeSweep()
    // Calculate vertices
    timer.start();
 
-   // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
-   vertices.clear();
-   vertices.resize(radials * gates * VERTICES_PER_BIN * VALUES_PER_VERTEX);
-
-   // Setup data moment vector
+   std::vector<float>&   vertices     = p->vertices_;
    std::vector<uint8_t>& dataMoments8 = p->dataMoments8_;
-   size_t                mIndex       = 0;
-
-   dataMoments8.resize(radials * gates * VERTICES_PER_BIN);
 
    // Compute threshold at which to display an individual bin
    const uint16_t snrThreshold = descriptionBlock->threshold();
@@ -306,7 +292,6 @@ void Level3RadialView::ComputeSweep()
    std::uint16_t startRadial;
    if (radialSize == common::RadialSize::NonStandard)
    {
-      p->ComputeCoordinates(radialData);
       startRadial = 0;
    }
    else
@@ -316,30 +301,36 @@ void Level3RadialView::ComputeSweep()
       startRadial = std::lroundf(startAngle * radialMultiplier);
    }
 
-   for (uint16_t radial = 0; radial < radialData->number_of_radials(); radial++)
+   // Compute gate interval
+   const uint16_t dataMomentInterval = descriptionBlock->x_resolution_raw();
+
+   // Compute gate size (number of base gates per bin)
+   const uint16_t gateSize = std::max<uint16_t>(
+      1,
+      dataMomentInterval /
+         static_cast<uint16_t>(radarProductManager->gate_size()));
+
+   // Compute gate range [startGate, endGate)
+   const uint16_t startGate = 0;
+   const uint16_t endGate   = std::min<uint16_t>(startGate + gates * gateSize,
+                                                 common::MAX_DATA_MOMENT_GATES);
+
+   // Counts the vertices of the displayed bins of a radial. If store is set,
+   // the vertices and data moments of the radial are also stored, beginning at
+   // vertex mIndex.
+   auto processRadial =
+      [&](std::uint16_t radial, std::size_t mIndex, bool store) -> std::size_t
    {
-      const auto dataMomentsArray8 = radialData->level(radial);
-
-      // Compute gate interval
-      const uint16_t dataMomentInterval = descriptionBlock->x_resolution_raw();
-
-      // Compute gate size (number of base gates per bin)
-      const uint16_t gateSize = std::max<uint16_t>(
-         1,
-         dataMomentInterval /
-            static_cast<uint16_t>(radarProductManager->gate_size()));
+      const std::size_t startIndex = mIndex;
+      std::size_t       vIndex     = mIndex * VALUES_PER_VERTEX;
 
-      // Compute gate range [startGate, endGate)
-      const uint16_t startGate = 0;
-      const uint16_t endGate   = std::min<uint16_t>(
-         startGate + gates * gateSize, common::MAX_DATA_MOMENT_GATES);
+      const auto dataMomentsArray8 = radialData->level(radial);
 
       for (uint16_t gate = startGate, i = 0; gate + gateSize <= endGate;
            gate += gateSize, ++i)
       {
-         size_t vertexCount = (gate > 0) ? 6 : 3;
+         const size_t vertexCount = (gate > 0) ? 6 : 3;
 
-         // Store data moment value
          uint8_t dataValue =
             (i < dataMomentsArray8.size()) ? dataMomentsArray8[i] : 0;
          if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
@@ -347,11 +338,16 @@ void Level3RadialView::ComputeSweep()
             continue;
          }
 
-         for (size_t m = 0; m < vertexCount; m++)
+         if (!store)
          {
-            dataMoments8[mIndex++] = dataValue;
+            mIndex += vertexCount;
+            continue;
          }
 
+         // Store data moment value
+         std::fill_n(dataMoments8.begin() + mIndex, vertexCount, dataValue);
+         mIndex += vertexCount;
+
          // Store vertices
          if (gate > 0)
          {
@@ -385,8 +381,6 @@ void Level3RadialView::ComputeSweep()
 
             vertices[vIndex++] = coordinates[offset2];
             vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertexCount = 6;
          }
          else
          {
@@ -409,20 +403,50 @@ void Level3RadialView::ComputeSweep()
 
             vertices[vIndex++] = coordinates[offset2];
             vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertexCount = 3;
          }
       }
-   }
-   vertices.resize(vIndex);
+
+      return mIndex - startIndex;
+   };
+
+   // First pass: count the vertices of each radial. The prefix sum of the
+   // counts gives the offset at which each radial is stored.
+   std::vector<std::size_t> radialOffsets(radials + 1u, 0u);
+   auto                     radialRange =
+      boost::irange<std::uint16_t>(0u, static_cast<std::uint16_t>(radials));
+
+   std::for_each(std::execution::par_unseq,
+                 radialRange.begin(),
+                 radialRange.end(),
+                 [&](std::uint16_t radial)
+                 {
+                    radialOffsets[radial + 1u] =
+                       processRadial(radial, 0u, false);
+                 });
+
+   std::inclusive_scan(
+      radialOffsets.cbegin(), radialOffsets.cend(), radialOffsets.begin());
+
+   const std::size_t vertexCount = radialOffsets[radials];
+
+   // Setup vertex and data moment vectors
+   vertices.resize(vertexCount * VALUES_PER_VERTEX);
    vertices.shrink_to_fit();
 
-   dataMoments8.resize(mIndex);
+   dataMoments8.resize(vertexCount);
    dataMoments8.shrink_to_fit();
 
+   // Second pass: store each radial in parallel
+   std::for_each(std::execution::par_unseq,
+                 radialRange.begin(),
+                 radialRange.end(),
+                 [&](std::uint16_t radial)
+                 { processRadial(radial, radialOffsets[radial], true); });
+
    timer.stop();
    logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
 
+   UpdateVerticesGeneration();
    UpdateColorTableLut();
 
    Q_EMIT SweepComputed();
@@ -433,83 +457,52 @@ void Level3RadialView::Impl::ComputeCoordinates(
 {
    logger_->debug("ComputeCoordinates()");
 
-   boost::timer::cpu_timer timer;
-
-   const GeographicLib::Geodesic& geodesic(
-      util::GeographicLib::DefaultGeodesic());
-
-   auto         radarProductManager = self_->radar_product_manager();
-   auto         radarSite           = radarProductManager->radar_site();
-   const float  gateSize            = radarProductManager->gate_size();
-   const double radarLatitude       = radarSite->latitude();
-   const double radarLongitude      = radarSite->longitude();
-
-   // Calculate azimuth coordinates
-   timer.start();
-
-   const std::uint16_t numRadials   = radialData->number_of_radials();
-   const std::uint16_t numRangeBins = radialData->number_of_range_bins();
+   const std::uint16_t numRadials = radialData->number_of_radials();
 
-   auto radials = boost::irange<std::uint32_t>(0u, numRadials);
-   auto gates   = boost::irange<std::uint32_t>(0u, numRangeBins);
+   std::vector<float> azimuths(numRadials);
+   for (std::uint16_t radial = 0; radial < numRadials; ++radial)
+   {
+      azimuths[radial] = radialData->start_angle(radial);
+   }
 
-   std::for_each(std::execution::par_unseq,
-                 radials.begin(),
-                 radials.end(),
-                 [&](std::uint32_t radial)
-                 {
-                    const float angle = radialData->start_angle(radial);
-
-                    std::for_each(std::execution::par_unseq,
-                                  gates.begin(),
-                                  gates.end(),
-                                  [&](std::uint32_t gate)
-                                  {
-                                     const std::uint32_t radialGate =
-                                        radial * common::MAX_DATA_MOMENT_GATES +
-                                        gate;
-                                     const float range = (gate + 1) * gateSize;
-                                     const std::size_t offset = radialGate * 2;
-
-                                     double latitude;
-                                     double longitude;
-
-                                     geodesic.Direct(radarLatitude,
-                                                     radarLongitude,
-                                                     angle,
-                                                     range,
-                                                     latitude,
-                                                     longitude);
-
-                                     coordinates_[offset]     = latitude;
-                                     coordinates_[offset + 1] = longitude;
-                                  });
-                 });
-   timer.stop();
-   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+   // Coordinates are shared with other views of the same radar site and
+   // radial azimuths, and are only calculated if they are not already cached
+   coordinates_ = self_->radar_product_manager()->GetRadialCoordinates(
+      azimuths, radialData->number_of_range_bins());
 }
 
 std::optional<std::uint16_t>
 Level3RadialView::GetBinLevel(const common::Coordinate& coordinate) const
 {
+   return SampleBins({&coordinate, 1u}).front();
+}
+
+std::vector<std::optional<std::uint16_t>> Level3RadialView::SampleBins(
+   std::span<const common::Coordinate> coordinates) const
+{
+   std::vector<std::optional<std::uint16_t>> levels(coordinates.size());
+
    auto gpm = graphic_product_message();
    if (gpm == nullptr)
    {
-      return std::nullopt;
+      return levels;
    }
 
    std::shared_ptr<wsr88d::rpg::ProductDescriptionBlock> descriptionBlock =
       gpm->description_block();
    if (descriptionBlock == nullptr)
    {
-      return std::nullopt;
+      return levels;
    }
 
    std::shared_ptr<wsr88d::rpg::GenericRadialDataPacket> radialData =
       p->lastRadialData_;
-   if (radialData == nullptr)
+   std::shared_ptr<const scwx::util::AzimuthLookup> azimuthLookup =
+      p->azimuthLookup_;
+   if (radialData == nullptr || azimuthLookup == nullptr ||
+       azimuthLookup->radial_count() != radialData->number_of_radials())
    {
-      return std::nullopt;
+      return levels;
    }
 
    auto         radarProductManager = radar_product_manager();
@@ -517,92 +510,83 @@ Level3RadialView::GetBinLevel(const common::Coordinate& coordinate) const
    const double radarLatitude       = radarSite->latitude();
    const double radarLongitude      = radarSite->longitude();
 
-   // Determine distance and azimuth of coordinate relative to radar location
-   double s12;  // Distance (meters)
-   double azi1; // Azimuth (degrees)
-   double azi2; // Unused
-   util::GeographicLib::DefaultGeodesic().Inverse(radarLatitude,
-                                                  radarLongitude,
-                                                  coordinate.latitude_,
-                                                  coordinate.longitude_,
-                                                  s12,
-                                                  azi1,
-                                                  azi2);
-
-   if (std::isnan(azi1))
-   {
-      // If a problem occurred with the geodesic inverse calculation
-      return std::nullopt;
-   }
-
-   // Azimuth is returned as [-180, 180) from the geodesic inverse, we need a
-   // range of [0, 360)
-   while (azi1 < 0.0)
-   {
-      azi1 += 360.0;
-   }
-
    // Compute gate interval
    const std::uint16_t gates = radialData->number_of_range_bins();
    const std::uint16_t dataMomentInterval =
       descriptionBlock->x_resolution_raw();
-   std::uint16_t gate = s12 / dataMomentInterval;
 
-   if (gate >= gates)
+   // Compute threshold at which to display an individual bin
+   const std::uint16_t snrThreshold = descriptionBlock->threshold();
+
+   const ::GeographicLib::Geodesic& geodesic =
+      util::GeographicLib::DefaultGeodesic();
+
+   auto sampleBin =
+      [&](const common::Coordinate& coordinate) -> std::optional<std::uint16_t>
    {
-      // Coordinate is beyond radar range
-      return std::nullopt;
-   }
+      // Determine distance and azimuth of coordinate relative to radar
+      // location
+      double s12;  // Distance (meters)
+      double azi1; // Azimuth (degrees)
+      double azi2; // Unused
+      geodesic.Inverse(radarLatitude,
+                       radarLongitude,
+                       coordinate.latitude_,
+                       coordinate.longitude_,
+                       s12,
+                       azi1,
+                       azi2);
+
+      if (std::isnan(azi1))
+      {
+         // If a problem occurred with the geodesic inverse calculation
+         return std::nullopt;
+      }
 
-   // Find Radial
-   const std::uint16_t numRadials = radialData->number_of_radials();
-   auto                radials = boost::irange<std::uint32_t>(0u, numRadials);
+      std::uint16_t gate = s12 / dataMomentInterval;
 
-   auto radial = std::find_if( //
-      std::execution::par_unseq,
-      radials.begin(),
-      radials.end(),
-      [&](std::uint32_t i)
+      if (gate >= gates)
       {
-         bool   found      = false;
-         double startAngle = radialData->start_angle(i);
-         double nextAngle  = radialData->start_angle((i + 1) % numRadials);
+         // Coordinate is beyond radar range
+         return std::nullopt;
+      }
 
-         if (startAngle < nextAngle)
-         {
-            if (startAngle <= azi1 && azi1 < nextAngle)
-            {
-               found = true;
-            }
-         }
-         else
-         {
-            // If the bin crosses 0/360 degrees, special handling is needed
-            if (startAngle <= azi1 || azi1 < nextAngle)
-            {
-               found = true;
-            }
-         }
+      // Find radial from the azimuth lookup table. Azimuth is returned as
+      // [-180, 180) from the geodesic inverse, and is wrapped by the lookup.
+      std::optional<std::size_t> radial = azimuthLookup->FindRadial(azi1);
 
-         return found;
-      });
+      if (!radial.has_value())
+      {
+         // No radial was found (not likely to happen without a gap in data)
+         return std::nullopt;
+      }
 
-   if (radial == radials.end())
-   {
-      // No radial was found (not likely to happen without a gap in data)
-      return std::nullopt;
-   }
+      const auto levels =
+         radialData->level(static_cast<std::uint16_t>(*radial));
 
-   // Compute threshold at which to display an individual bin
-   const std::uint16_t snrThreshold = descriptionBlock->threshold();
-   const std::uint8_t  level        = radialData->level(*radial).at(gate);
+      if (gate >= levels.size())
+      {
+         // Gate is beyond the range of the radial
+         return std::nullopt;
+      }
 
-   if (level < snrThreshold && level != RANGE_FOLDED)
-   {
-      return std::nullopt;
-   }
+      const std::uint8_t level = levels[gate];
+
+      if (level < snrThreshold && level != RANGE_FOLDED)
+      {
+         return std::nullopt;
+      }
+
+      return level;
+   };
+
+   std::transform(std::execution::par_unseq,
+                  coordinates.begin(),
+                  coordinates.end(),
+                  levels.begin(),
+                  sampleBin);
 
-   return level;
+   return levels;
 }
 
 std::shared_ptr<Level3RadialView> Level3RadialView::Create(
@@ -33,6 +33,8 @@ public:
 
    std::optional<std::uint16_t>
    GetBinLevel(const common::Coordinate& coordinate) const override;
+   std::vector<std::optional<std::uint16_t>>
+   SampleBins(std::span<const common::Coordinate> coordinates) const override;
 
    static std::shared_ptr<Level3RadialView>
    Create(const std::string&                            product,
@@ -6,6 +6,10 @@
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/rpg/raster_data_packet.hpp>
 
+#include <algorithm>
+#include <execution>
+#include <numeric>
+
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
 #include <units/angle.h>
@@ -21,7 +25,6 @@ static const std::string logPrefix_ = "scwx::qt::view::level3_raster_view";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
 static constexpr uint16_t RANGE_FOLDED      = 1u;
-static constexpr uint32_t VERTICES_PER_BIN  = 6u;
 static constexpr uint32_t VALUES_PER_VERTEX = 2u;
 
 class Level3RasterViewImpl
@@ -172,26 +175,10 @@ void Level3RasterView::ComputeSweep()
    // A message with raster data should have a Raster Data Packet
    std::shared_ptr<wsr88d::rpg::RasterDataPacket> rasterData = nullptr;
 
-   for (uint16_t layer = 0; layer < numberOfLayers; layer++)
+   auto rasterDataPackets = gpm->FindPackets<wsr88d::rpg::RasterDataPacket>();
+   if (!rasterDataPackets.empty())
    {
-      std::vector<std::shared_ptr<wsr88d::rpg::Packet>> packetList =
-         symbologyBlock->packet_list(layer);
-
-      for (auto it = packetList.begin(); it != packetList.end(); it++)
-      {
-         rasterData =
-            std::dynamic_pointer_cast<wsr88d::rpg::RasterDataPacket>(*it);
-
-         if (rasterData != nullptr)
-         {
-            break;
-         }
-      }
-
-      if (rasterData != nullptr)
-      {
-         break;
-      }
+      rasterData = rasterDataPackets.front();
    }
 
    if (rasterData == nullptr)
@@ -226,98 +213,63 @@ void Level3RasterView::ComputeSweep()
                             descriptionBlock->volume_scan_start_time() * 1000);
    p->vcp_ = descriptionBlock->volume_coverage_pattern();
 
-   const GeographicLib::Geodesic& geodesic =
-      util::GeographicLib::DefaultGeodesic();
-
-   const uint16_t xResolution = descriptionBlock->x_resolution_raw();
-   const uint16_t yResolution = descriptionBlock->y_resolution_raw();
-   double         iCoordinate =
-      (-rasterData->i_coordinate_start() - 1.0 - p->range_) * 1000.0;
-   double jCoordinate =
-      (rasterData->j_coordinate_start() + 1.0 + p->range_) * 1000.0;
-
-   size_t numCoordinates =
-      static_cast<size_t>(rows + 1) * static_cast<size_t>(maxColumns + 1);
-   auto coordinateRange =
-      boost::irange<uint32_t>(0, static_cast<uint32_t>(numCoordinates));
-
-   std::vector<float> coordinates;
-   coordinates.resize(numCoordinates * 2);
-
-   // Calculate coordinates
-   timer.start();
-
-   std::for_each(
-      std::execution::par_unseq,
-      coordinateRange.begin(),
-      coordinateRange.end(),
-      [&](uint32_t index)
-      {
-         // For each row or column, there is one additional coordinate. Each bin
-         // is bounded by 4 coordinates.
-         const uint32_t col = index % (rows + 1);
-         const uint32_t row = index / (rows + 1);
-
-         const double i = iCoordinate + xResolution * col;
-         const double j = jCoordinate - yResolution * row;
-
-         // Calculate polar coordinates based on i and j
-         const double angle  = std::atan2(i, j) * 180.0 / M_PI;
-         const double range  = std::sqrt(i * i + j * j);
-         const size_t offset = static_cast<size_t>(index) * 2;
-
-         double latitude;
-         double longitude;
-
-         geodesic.Direct(
-            p->latitude_, p->longitude_, angle, range, latitude, longitude);
-
-         coordinates[offset]     = latitude;
-         coordinates[offset + 1] = longitude;
-      });
-
-   timer.stop();
-   logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+   // Retrieve the projected grid coordinates, which are shared by products
+   // with the same grid placement
+   manager::RadarProductManager::RasterGrid rasterGrid {};
+   rasterGrid.latitude_         = p->latitude_;
+   rasterGrid.longitude_        = p->longitude_;
+   rasterGrid.range_            = p->range_;
+   rasterGrid.iCoordinateStart_ = rasterData->i_coordinate_start();
+   rasterGrid.jCoordinateStart_ = rasterData->j_coordinate_start();
+   rasterGrid.xResolution_      = descriptionBlock->x_resolution_raw();
+   rasterGrid.yResolution_      = descriptionBlock->y_resolution_raw();
+   rasterGrid.rows_             = rows;
+   rasterGrid.columns_          = static_cast<std::uint16_t>(maxColumns);
+
+   const std::shared_ptr<const std::vector<float>> coordinatesPtr =
+      radarProductManager->GetRasterCoordinates(rasterGrid);
+   const std::vector<float>& coordinates = *coordinatesPtr;
 
    // Calculate vertices
    timer.start();
 
-   // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
-   vertices.clear();
-   vertices.resize(rows * maxColumns * VERTICES_PER_BIN * VALUES_PER_VERTEX);
-
-   // Setup data moment vector
+   std::vector<float>&   vertices     = p->vertices_;
    std::vector<uint8_t>& dataMoments8 = p->dataMoments8_;
-   size_t                mIndex       = 0;
-
-   dataMoments8.resize(rows * maxColumns * VERTICES_PER_BIN);
 
    // Compute threshold at which to display an individual bin
    const uint16_t snrThreshold = descriptionBlock->threshold();
 
-   for (size_t row = 0; row < rasterData->number_of_rows(); ++row)
+   // Counts the vertices of the displayed bins of a row. If store is set, the
+   // vertices and data moments of the row are also stored, beginning at vertex
+   // mIndex.
+   auto processRow =
+      [&](std::uint16_t row, std::size_t mIndex, bool store) -> std::size_t
    {
-      const auto dataMomentsArray8 =
-         rasterData->level(static_cast<uint16_t>(row));
+      constexpr size_t vertexCount = 6;
+
+      const std::size_t startIndex = mIndex;
+      std::size_t       vIndex     = mIndex * VALUES_PER_VERTEX;
+
+      const auto dataMomentsArray8 = rasterData->level(row);
 
       for (size_t bin = 0; bin < dataMomentsArray8.size(); ++bin)
       {
-         constexpr size_t vertexCount = 6;
-
-         // Store data moment value
          uint8_t dataValue = dataMomentsArray8[bin];
          if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
          {
             continue;
          }
 
-         for (size_t m = 0; m < vertexCount; m++)
+         if (!store)
          {
-            dataMoments8[mIndex++] = dataValue;
+            mIndex += vertexCount;
+            continue;
          }
 
+         // Store data moment value
+         std::fill_n(dataMoments8.begin() + mIndex, vertexCount, dataValue);
+         mIndex += vertexCount;
+
          // Store vertices
          size_t offset1 = (row * (maxColumns + 1) + bin) * 2;
          size_t offset2 = offset1 + 2;
@@ -342,16 +294,44 @@ void Level3RasterView::ComputeSweep()
          vertices[vIndex++] = coordinates[offset2];
          vertices[vIndex++] = coordinates[offset2 + 1];
       }
-   }
-   vertices.resize(vIndex);
+
+      return mIndex - startIndex;
+   };
+
+   // First pass: count the vertices of each row. The prefix sum of the counts
+   // gives the offset at which each row is stored.
+   std::vector<std::size_t> rowOffsets(rows + 1u, 0u);
+   auto                     rowRange = boost::irange<std::uint16_t>(0u, rows);
+
+   std::for_each(std::execution::par_unseq,
+                 rowRange.begin(),
+                 rowRange.end(),
+                 [&](std::uint16_t row)
+                 { rowOffsets[row + 1u] = processRow(row, 0u, false); });
+
+   std::inclusive_scan(
+      rowOffsets.cbegin(), rowOffsets.cend(), rowOffsets.begin());
+
+   const std::size_t vertexCount = rowOffsets[rows];
+
+   // Setup vertex and data moment vectors
+   vertices.resize(vertexCount * VALUES_PER_VERTEX);
    vertices.shrink_to_fit();
 
-   dataMoments8.resize(mIndex);
+   dataMoments8.resize(vertexCount);
    dataMoments8.shrink_to_fit();
 
+   // Second pass: store each row in parallel
+   std::for_each(std::execution::par_unseq,
+                 rowRange.begin(),
+                 rowRange.end(),
+                 [&](std::uint16_t row)
+                 { processRow(row, rowOffsets[row], true); });
+
    timer.stop();
    logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
 
+   UpdateVerticesGeneration();
    UpdateColorTableLut();
 
    Q_EMIT SweepComputed();
@@ -421,15 +401,15 @@ Level3RasterView::GetBinLevel(const common::Coordinate& coordinate) const
    std::uint32_t col = static_cast<std::uint32_t>(i / xResolution);
    std::uint32_t row = static_cast<std::uint32_t>(j / yResolution);
 
-   if (row > rasterData->number_of_rows())
+   if (row >= rasterData->number_of_rows())
    {
       // Coordinate is beyond radar range (latitude)
       return std::nullopt;
    }
 
-   auto& momentData = rasterData->level(static_cast<std::uint16_t>(row));
+   auto momentData = rasterData->level(static_cast<std::uint16_t>(row));
 
-   if (col > momentData.size())
+   if (col >= momentData.size())
    {
       // Coordinate is beyond radar range (longitude)
       return std::nullopt;
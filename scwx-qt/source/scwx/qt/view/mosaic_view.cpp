@@ -0,0 +1,693 @@
+#include <scwx/qt/view/mosaic_view.hpp>
+#include <scwx/qt/view/radar_product_view_factory.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/wsr88d/derived_products.hpp>
+
+#include <algorithm>
+#include <execution>
+
+#include <boost/algorithm/string/join.hpp>
+#include <boost/asio.hpp>
+#include <boost/timer/timer.hpp>
+#include <boost/uuid/random_generator.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string logPrefix_ = "scwx::qt::view::mosaic_view";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr std::size_t kVerticesPerCell_ = 6u;
+
+// Number of site volumes which may be downloaded and decoded at once
+static constexpr std::size_t kLoadThreadCount_ = 4u;
+
+class MosaicView::Impl
+{
+public:
+   struct Site
+   {
+      std::shared_ptr<manager::RadarProductManager> radarProductManager_ {};
+      std::shared_ptr<RadarProductView>             view_ {};
+
+      // Cells within range of the site, relative to the site. Points are
+      // calculated once, so sampling a sweep requires no geodesic calculations.
+      std::vector<wsr88d::VolumeIndex::PolarCoordinate> points_ {};
+   };
+
+   explicit Impl(MosaicView*           self,
+                 common::Level2Product product,
+                 common::MosaicRule    rule,
+                 double                resolution) :
+       self_ {self}, product_ {product}, rule_ {rule}, resolution_ {resolution}
+   {
+   }
+   ~Impl()
+   {
+      loadThreadPool_.join();
+      threadPool_.join();
+   }
+
+   void BuildGrid();
+   void ComputeSite(std::size_t site);
+   void ConnectSiteView(std::size_t site);
+   void CreateSiteView(std::size_t site);
+   void LoadLatestData(std::size_t                           site,
+                       std::chrono::system_clock::time_point latestTime);
+   void SiteSweepNotComputed(std::size_t site);
+
+   std::shared_ptr<RadarProductView> reference_view() const;
+
+   MosaicView* self_;
+
+   boost::asio::thread_pool threadPool_ {1u};
+
+   // Site volumes are loaded on a separate pool, so a slow download does not
+   // delay compositing the sweeps of the other sites
+   boost::asio::thread_pool loadThreadPool_ {kLoadThreadCount_};
+
+   common::Level2Product product_;
+   common::MosaicRule    rule_;
+   double                resolution_;
+
+   boost::uuids::uuid uuid_ {boost::uuids::random_generator()()};
+
+   std::vector<Site>                   sites_ {};
+   std::unique_ptr<common::MosaicGrid> grid_ {};
+
+   std::vector<float>         vertices_ {};
+   std::vector<std::uint16_t> dataMoments16_ {};
+
+   // The first site with a computed sweep provides the color table and data
+   // level conversions, which are shared by all sites of the same product
+   std::shared_ptr<RadarProductView> referenceView_ {};
+
+   std::shared_ptr<common::ColorTable> colorTable_ {};
+
+   // Number of sites which have not completed the most recent update
+   std::size_t pendingSites_ {0u};
+   bool        sweepComputed_ {false};
+
+   std::chrono::system_clock::time_point sweepTime_ {};
+};
+
+MosaicView::MosaicView(
+   common::Level2Product product,
+   const std::vector<std::shared_ptr<manager::RadarProductManager>>&
+                      radarProductManagers,
+   common::MosaicRule rule,
+   double             resolution) :
+    RadarProductView(radarProductManagers.empty() ?
+                        nullptr :
+                        radarProductManagers.front()),
+    p(std::make_unique<Impl>(this, product, rule, resolution))
+{
+   p->sites_.resize(radarProductManagers.size());
+
+   for (std::size_t site = 0; site < p->sites_.size(); ++site)
+   {
+      p->sites_[site].radarProductManager_ = radarProductManagers[site];
+      p->CreateSiteView(site);
+   }
+
+   ConnectRadarProductManager();
+}
+
+MosaicView::~MosaicView()
+{
+   DisconnectRadarProductManager();
+
+   std::unique_lock sweepLock {sweep_mutex()};
+}
+
+void MosaicView::ConnectRadarProductManager()
+{
+   // Each site is refreshed independently, so only the site which delivered a
+   // new volume is updated
+   for (std::size_t site = 0; site < p->sites_.size(); ++site)
+   {
+      auto& radarProductManager = p->sites_[site].radarProductManager_;
+
+      radarProductManager->EnableRefresh(common::RadarProductGroup::Level2,
+                                         common::GetLevel2Name(p->product_),
+                                         true,
+                                         p->uuid_);
+
+      connect(radarProductManager.get(),
+              &manager::RadarProductManager::NewDataAvailable,
+              this,
+              [this, site](common::RadarProductGroup group,
+                           const std::string&,
+                           std::chrono::system_clock::time_point latestTime)
+              {
+                 const bool liveTimeSelected =
+                    selected_time() == std::chrono::system_clock::time_point {};
+
+                 if (group == common::RadarProductGroup::Level2 &&
+                     liveTimeSelected)
+                 {
+                    p->LoadLatestData(site, latestTime);
+                 }
+              });
+   }
+}
+
+void MosaicView::DisconnectRadarProductManager()
+{
+   for (auto& site : p->sites_)
+   {
+      site.radarProductManager_->EnableRefresh(
+         common::RadarProductGroup::Level2,
+         common::GetLevel2Name(p->product_),
+         false,
+         p->uuid_);
+
+      disconnect(site.radarProductManager_.get(),
+                 &manager::RadarProductManager::NewDataAvailable,
+                 this,
+                 nullptr);
+   }
+}
+
+void MosaicView::Impl::CreateSiteView(std::size_t site)
+{
+   auto view = RadarProductViewFactory::Create(
+      product_, sites_[site].radarProductManager_);
+
+   if (colorTable_ != nullptr)
+   {
+      view->LoadColorTable(colorTable_);
+   }
+
+   sites_[site].view_ = view;
+
+   ConnectSiteView(site);
+}
+
+void MosaicView::Impl::ConnectSiteView(std::size_t site)
+{
+   RadarProductView* view = sites_[site].view_.get();
+
+   // Sweeps are computed by each site in parallel, and sampled onto the grid
+   // by the mosaic thread pool
+   QObject::connect(view,
+                    &RadarProductView::SweepComputed,
+                    self_,
+                    [this, site]()
+                    {
+                       boost::asio::post(threadPool_,
+                                         [this, site]() { ComputeSite(site); });
+                    });
+   QObject::connect(view,
+                    &RadarProductView::SweepNotComputed,
+                    self_,
+                    [this, site](types::NoUpdateReason)
+                    {
+                       boost::asio::post(threadPool_,
+                                         [this, site]()
+                                         { SiteSweepNotComputed(site); });
+                    });
+}
+
+void MosaicView::Impl::LoadLatestData(
+   std::size_t site, std::chrono::system_clock::time_point latestTime)
+{
+   // Must be called from the thread owning the site views
+   std::shared_ptr<RadarProductView> view;
+
+   {
+      std::unique_lock sweepLock {self_->sweep_mutex()};
+      view = sites_[site].view_;
+   }
+
+   // Select the latest volume. The site view is updated as the elevation cuts
+   // of the volume are loaded, and the mosaic is updated with each site sweep.
+   view->SelectTime({});
+
+   auto radarProductManager = sites_[site].radarProductManager_;
+   boost::asio::post(loadThreadPool_,
+                     [radarProductManager, latestTime]()
+                     { radarProductManager->LoadLevel2Data(latestTime); });
+}
+
+void MosaicView::Impl::BuildGrid()
+{
+   // Must be called with the sweep mutex locked
+   boost::timer::cpu_timer timer;
+
+   std::vector<common::Coordinate> siteCoordinates {};
+   for (const Site& site : sites_)
+   {
+      auto radarSite = site.radarProductManager_->radar_site();
+      siteCoordinates.emplace_back(radarSite->latitude(),
+                                   radarSite->longitude());
+   }
+
+   timer.start();
+
+   grid_ = std::make_unique<common::MosaicGrid>(
+      siteCoordinates, kRange_, resolution_, rule_);
+
+   vertices_ = grid_->GetVertices();
+   dataMoments16_.assign(grid_->cell_count() * kVerticesPerCell_, 0u);
+
+   const ::GeographicLib::Geodesic& geodesic =
+      util::GeographicLib::DefaultGeodesic();
+
+   // Determine the location of each cell relative to each site
+   for (std::size_t site = 0; site < sites_.size(); ++site)
+   {
+      const auto   siteCells = grid_->site_cells(site);
+      const double latitude  = siteCoordinates[site].latitude_;
+      const double longitude = siteCoordinates[site].longitude_;
+      auto&        points    = sites_[site].points_;
+
+      points.resize(siteCells.size());
+
+      std::transform(std::execution::par_unseq,
+                     siteCells.begin(),
+                     siteCells.end(),
+                     points.begin(),
+                     [&](std::uint32_t cell)
+                     {
+                        const common::Coordinate center =
+                           grid_->cell_center(cell);
+
+                        double s12;  // Distance (meters)
+                        double azi1; // Azimuth (degrees)
+                        double azi2; // Unused
+                        geodesic.Inverse(latitude,
+                                         longitude,
+                                         center.latitude_,
+                                         center.longitude_,
+                                         s12,
+                                         azi1,
+                                         azi2);
+
+                        return wsr88d::VolumeIndex::PolarCoordinate {azi1, s12};
+                     });
+   }
+
+   timer.stop();
+   logger_->debug("Mosaic grid of {} cells calculated in {}",
+                  grid_->cell_count(),
+                  timer.format(6, "%ws"));
+
+   self_->UpdateVerticesGeneration();
+}
+
+void MosaicView::Impl::ComputeSite(std::size_t site)
+{
+   logger_->trace("ComputeSite({})", site);
+
+   boost::timer::cpu_timer timer;
+
+   std::shared_ptr<RadarProductView> view;
+
+   {
+      std::unique_lock sweepLock {self_->sweep_mutex()};
+
+      if (grid_ == nullptr)
+      {
+         return;
+      }
+
+      view = sites_[site].view_;
+   }
+
+   // Sample the sweep of the site at each cell within range
+   std::vector<std::optional<std::uint16_t>> samples {};
+
+   {
+      std::unique_lock siteLock {view->sweep_mutex()};
+      samples = view->SamplePolarBins(sites_[site].points_);
+   }
+
+   std::vector<std::uint16_t> levels(samples.size());
+   std::transform(std::execution::par_unseq,
+                  samples.cbegin(),
+                  samples.cend(),
+                  levels.begin(),
+                  [](const std::optional<std::uint16_t>& level)
+                  { return level.value_or(0u); });
+
+   std::unique_lock sweepLock {self_->sweep_mutex()};
+
+   if (view != sites_[site].view_)
+   {
+      // The product was changed while the site was sampled
+      return;
+   }
+
+   grid_->UpdateSite(site, levels);
+
+   // Only the data moments of the cells covered by the site are updated
+   const auto siteCells  = grid_->site_cells(site);
+   const auto gridLevels = grid_->levels();
+
+   std::for_each(std::execution::par_unseq,
+                 siteCells.begin(),
+                 siteCells.end(),
+                 [&](std::uint32_t cell)
+                 {
+                    std::fill_n(dataMoments16_.begin() +
+                                   cell * kVerticesPerCell_,
+                                kVerticesPerCell_,
+                                gridLevels[cell]);
+                 });
+
+   if (referenceView_ == nullptr)
+   {
+      referenceView_ = view;
+   }
+
+   sweepTime_ = std::max(sweepTime_, view->sweep_time());
+
+   timer.stop();
+   logger_->debug("Site {} sampled in {}",
+                  sites_[site].radarProductManager_->radar_id(),
+                  timer.format(6, "%ws"));
+
+   if (pendingSites_ > 0u)
+   {
+      --pendingSites_;
+   }
+   sweepComputed_ = true;
+
+   self_->UpdateColorTableLut();
+
+   Q_EMIT self_->SweepComputed();
+}
+
+void MosaicView::Impl::SiteSweepNotComputed(std::size_t site)
+{
+   logger_->trace("SiteSweepNotComputed({})", site);
+
+   std::unique_lock sweepLock {self_->sweep_mutex()};
+
+   if (pendingSites_ == 0u)
+   {
+      return;
+   }
+
+   // If no site has changed once every site has completed the update, the
+   // mosaic is unchanged
+   if (--pendingSites_ == 0u && !sweepComputed_)
+   {
+      Q_EMIT self_->SweepNotComputed(types::NoUpdateReason::NoChange);
+   }
+}
+
+std::shared_ptr<RadarProductView> MosaicView::Impl::reference_view() const
+{
+   if (referenceView_ != nullptr)
+   {
+      return referenceView_;
+   }
+   else if (!sites_.empty())
+   {
+      return sites_.front().view_;
+   }
+
+   return nullptr;
+}
+
+boost::asio::thread_pool& MosaicView::thread_pool()
+{
+   return p->threadPool_;
+}
+
+std::shared_ptr<common::ColorTable> MosaicView::color_table() const
+{
+   return p->colorTable_;
+}
+
+const std::vector<boost::gil::rgba8_pixel_t>&
+MosaicView::color_table_lut() const
+{
+   auto view = p->reference_view();
+   return (view != nullptr) ? view->color_table_lut() :
+                              RadarProductView::color_table_lut();
+}
+
+std::uint16_t MosaicView::color_table_min() const
+{
+   auto view = p->reference_view();
+   return (view != nullptr) ? view->color_table_min() :
+                              RadarProductView::color_table_min();
+}
+
+std::uint16_t MosaicView::color_table_max() const
+{
+   auto view = p->reference_view();
+   return (view != nullptr) ? view->color_table_max() :
+                              RadarProductView::color_table_max();
+}
+
+float MosaicView::elevation() const
+{
+   return p->sites_.empty() ? 0.0f : p->sites_.front().view_->elevation();
+}
+
+float MosaicView::range() const
+{
+   return p->sites_.empty() ? 0.0f : p->sites_.front().view_->range();
+}
+
+std::chrono::system_clock::time_point MosaicView::sweep_time() const
+{
+   return p->sweepTime_;
+}
+
+float MosaicView::unit_scale() const
+{
+   auto view = p->reference_view();
+   return (view != nullptr) ? view->unit_scale() : 1.0f;
+}
+
+std::string MosaicView::units() const
+{
+   auto view = p->reference_view();
+   return (view != nullptr) ? view->units() : std::string {};
+}
+
+std::uint16_t MosaicView::vcp() const
+{
+   return p->sites_.empty() ? 0u : p->sites_.front().view_->vcp();
+}
+
+const std::vector<float>& MosaicView::vertices() const
+{
+   return p->vertices_;
+}
+
+std::vector<std::string> MosaicView::radar_ids() const
+{
+   std::vector<std::string> radarIds {};
+
+   for (const auto& site : p->sites_)
+   {
+      radarIds.push_back(site.radarProductManager_->radar_id());
+   }
+
+   return radarIds;
+}
+
+common::MosaicRule MosaicView::rule() const
+{
+   return p->rule_;
+}
+
+void MosaicView::LoadColorTable(std::shared_ptr<common::ColorTable> colorTable)
+{
+   p->colorTable_ = colorTable;
+
+   for (auto& site : p->sites_)
+   {
+      site.view_->LoadColorTable(colorTable);
+   }
+
+   UpdateColorTableLut();
+}
+
+void MosaicView::SelectElevation(float elevation)
+{
+   for (auto& site : p->sites_)
+   {
+      site.view_->SelectElevation(elevation);
+   }
+}
+
+void MosaicView::SelectProduct(const std::string& productName)
+{
+   common::Level2Product product = common::GetLevel2Product(productName);
+
+   if (product == common::Level2Product::Unknown)
+   {
+      logger_->warn("Unknown Level 2 radar product: {}", productName);
+      return;
+   }
+
+   DisconnectRadarProductManager();
+
+   std::unique_lock sweepLock {sweep_mutex()};
+
+   const bool viewChanged =
+      wsr88d::DerivedProducts::IsDerivedProduct(p->product_) !=
+      wsr88d::DerivedProducts::IsDerivedProduct(product);
+
+   p->product_       = product;
+   p->referenceView_ = nullptr;
+
+   for (std::size_t site = 0; site < p->sites_.size(); ++site)
+   {
+      if (viewChanged)
+      {
+         // Products derived from the volume are displayed by a different view
+         disconnect(p->sites_[site].view_.get(), nullptr, this, nullptr);
+         p->CreateSiteView(site);
+      }
+      else
+      {
+         p->sites_[site].view_->SelectProduct(productName);
+      }
+
+      // Levels of the previous product are not displayed with the new product
+      if (p->grid_ != nullptr)
+      {
+         p->grid_->ClearSite(site);
+      }
+   }
+
+   std::fill(p->dataMoments16_.begin(), p->dataMoments16_.end(), 0u);
+
+   sweepLock.unlock();
+
+   ConnectRadarProductManager();
+}
+
+common::RadarProductGroup MosaicView::GetRadarProductGroup() const
+{
+   return common::RadarProductGroup::Level2;
+}
+
+std::string MosaicView::GetRadarProductName() const
+{
+   return common::GetLevel2Name(p->product_);
+}
+
+std::vector<float> MosaicView::GetElevationCuts() const
+{
+   return p->sites_.empty() ? std::vector<float> {} :
+                              p->sites_.front().view_->GetElevationCuts();
+}
+
+std::tuple<const void*, std::size_t, std::size_t>
+MosaicView::GetMomentData() const
+{
+   const void* data     = p->dataMoments16_.data();
+   std::size_t dataSize = p->dataMoments16_.size() * sizeof(std::uint16_t);
+   std::size_t componentSize = 2;
+
+   return std::tie(data, dataSize, componentSize);
+}
+
+std::optional<std::uint16_t>
+MosaicView::GetBinLevel(const common::Coordinate& coordinate) const
+{
+   std::unique_lock sweepLock {sweep_mutex()};
+
+   if (p->grid_ == nullptr)
+   {
+      return std::nullopt;
+   }
+
+   std::optional<std::size_t> cell = p->grid_->FindCell(coordinate);
+
+   if (!cell.has_value() || p->grid_->levels()[*cell] == 0u)
+   {
+      return std::nullopt;
+   }
+
+   return p->grid_->levels()[*cell];
+}
+
+std::optional<wsr88d::DataLevelCode>
+MosaicView::GetDataLevelCode(std::uint16_t level) const
+{
+   auto view = p->reference_view();
+   return (view != nullptr) ? view->GetDataLevelCode(level) : std::nullopt;
+}
+
+std::optional<float> MosaicView::GetDataValue(std::uint16_t level) const
+{
+   auto view = p->reference_view();
+   return (view != nullptr) ? view->GetDataValue(level) : std::nullopt;
+}
+
+bool MosaicView::MaskZeroDataMoment() const
+{
+   // Cells without data from any site are stored with a data moment of 0
+   return true;
+}
+
+std::vector<std::pair<std::string, std::string>>
+MosaicView::GetDescriptionFields() const
+{
+   return {{"Mosaic", boost::algorithm::join(radar_ids(), ", ")}};
+}
+
+void MosaicView::UpdateColorTableLut()
+{
+   // The color table LUT is provided by the reference site
+   Q_EMIT ColorTableLutUpdated();
+}
+
+void MosaicView::ComputeSweep()
+{
+   logger_->debug("ComputeSweep()");
+
+   std::unique_lock sweepLock {sweep_mutex()};
+
+   if (p->sites_.empty())
+   {
+      Q_EMIT SweepNotComputed(types::NoUpdateReason::InvalidData);
+      return;
+   }
+
+   if (p->grid_ == nullptr)
+   {
+      p->BuildGrid();
+   }
+
+   p->pendingSites_  = p->sites_.size();
+   p->sweepComputed_ = false;
+
+   // Each site computes its sweep for the selected time. Sites which are
+   // unchanged do not resample the grid.
+   for (auto& site : p->sites_)
+   {
+      site.view_->SelectTime(selected_time());
+      site.view_->Update();
+   }
+}
+
+std::shared_ptr<MosaicView> MosaicView::Create(
+   common::Level2Product product,
+   const std::vector<std::shared_ptr<manager::RadarProductManager>>&
+                      radarProductManagers,
+   common::MosaicRule rule,
+   double             resolution)
+{
+   return std::make_shared<MosaicView>(
+      product, radarProductManagers, rule, resolution);
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <scwx/common/mosaic_grid.hpp>
+#include <scwx/common/products.hpp>
+#include <scwx/qt/view/radar_product_view.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+/**
+ * @brief A view of a Level 2 product from several radar sites, combined on a
+ * shared latitude/longitude grid. Each site is displayed by its own product
+ * view, and the latest sweep of each site is sampled onto the grid. When a site
+ * computes a new sweep, only the cells covered by that site are resampled and
+ * recombined.
+ *
+ * The first radar product manager is the primary site of the mosaic, which
+ * provides the range, volume coverage pattern and elevation cuts of the view.
+ */
+class MosaicView : public RadarProductView
+{
+   Q_OBJECT
+
+public:
+   static constexpr double kRange_ = 460000.0; // Meters
+
+   explicit MosaicView(
+      common::Level2Product product,
+      const std::vector<std::shared_ptr<manager::RadarProductManager>>&
+                         radarProductManagers,
+      common::MosaicRule rule       = common::MosaicRule::NearestRadar,
+      double             resolution = common::MosaicGrid::kDefaultResolution_);
+   ~MosaicView();
+
+   std::shared_ptr<common::ColorTable> color_table() const override;
+   const std::vector<boost::gil::rgba8_pixel_t>&
+                                         color_table_lut() const override;
+   std::uint16_t                         color_table_min() const override;
+   std::uint16_t                         color_table_max() const override;
+   float                                 elevation() const override;
+   float                                 range() const override;
+   std::chrono::system_clock::time_point sweep_time() const override;
+   float                                 unit_scale() const override;
+   std::string                           units() const override;
+   std::uint16_t                         vcp() const override;
+   const std::vector<float>&             vertices() const override;
+
+   /**
+    * @brief Gets the IDs of the radar sites in the mosaic, beginning with the
+    * primary site.
+    */
+   std::vector<std::string> radar_ids() const;
+   common::MosaicRule       rule() const;
+
+   void LoadColorTable(std::shared_ptr<common::ColorTable> colorTable) override;
+   void SelectElevation(float elevation) override;
+   void SelectProduct(const std::string& productName) override;
+
+   common::RadarProductGroup GetRadarProductGroup() const override;
+   std::string               GetRadarProductName() const override;
+   std::vector<float>        GetElevationCuts() const override;
+   std::tuple<const void*, std::size_t, std::size_t>
+   GetMomentData() const override;
+
+   std::optional<std::uint16_t>
+   GetBinLevel(const common::Coordinate& coordinate) const override;
+   std::optional<wsr88d::DataLevelCode>
+                        GetDataLevelCode(std::uint16_t level) const override;
+   std::optional<float> GetDataValue(std::uint16_t level) const override;
+   bool                 MaskZeroDataMoment() const override;
+
+   std::vector<std::pair<std::string, std::string>>
+   GetDescriptionFields() const override;
+
+   static std::shared_ptr<MosaicView>
+   Create(common::Level2Product product,
+          const std::vector<std::shared_ptr<manager::RadarProductManager>>&
+                             radarProductManagers,
+          common::MosaicRule rule = common::MosaicRule::NearestRadar,
+          double resolution       = common::MosaicGrid::kDefaultResolution_);
+
+protected:
+   boost::asio::thread_pool& thread_pool() override;
+
+   void ConnectRadarProductManager() override;
+   void DisconnectRadarProductManager() override;
+   void UpdateColorTableLut() override;
+
+protected slots:
+   void ComputeSweep() override;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
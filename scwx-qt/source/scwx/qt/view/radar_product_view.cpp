@@ -1,7 +1,12 @@
 #include <scwx/qt/view/radar_product_view.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <execution>
+
 #include <boost/asio.hpp>
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
@@ -24,6 +29,8 @@ static const std::vector<boost::gil::rgba8_pixel_t> kDefaultColorTable_ = {
 static const std::uint16_t kDefaultColorTableMin_ = 2u;
 static const std::uint16_t kDefaultColorTableMax_ = 255u;
 
+static std::atomic<std::uint64_t> nextVerticesGeneration_ {1u};
+
 class RadarProductViewImpl
 {
 public:
@@ -40,6 +47,8 @@ public:
    bool       initialized_;
    std::mutex sweepMutex_;
 
+   std::uint64_t verticesGeneration_ {0u};
+
    std::chrono::system_clock::time_point selectedTime_;
 
    std::shared_ptr<manager::RadarProductManager> radarProductManager_;
@@ -92,11 +101,16 @@ std::chrono::system_clock::time_point RadarProductView::sweep_time() const
    return {};
 }
 
-std::mutex& RadarProductView::sweep_mutex()
+std::mutex& RadarProductView::sweep_mutex() const
 {
    return p->sweepMutex_;
 }
 
+std::uint64_t RadarProductView::vertices_generation() const
+{
+   return p->verticesGeneration_;
+}
+
 void RadarProductView::set_radar_product_manager(
    std::shared_ptr<manager::RadarProductManager> radarProductManager)
 {
@@ -144,17 +158,105 @@ RadarProductView::GetCfpMomentData() const
    return std::tie(data, dataSize, componentSize);
 }
 
+std::vector<std::optional<std::uint16_t>> RadarProductView::SampleBins(
+   std::span<const common::Coordinate> coordinates) const
+{
+   std::vector<std::optional<std::uint16_t>> levels(coordinates.size());
+
+   std::transform(coordinates.begin(),
+                  coordinates.end(),
+                  levels.begin(),
+                  [this](const common::Coordinate& coordinate)
+                  { return GetBinLevel(coordinate); });
+
+   return levels;
+}
+
+std::vector<std::optional<std::uint16_t>> RadarProductView::SamplePolarBins(
+   std::span<const wsr88d::VolumeIndex::PolarCoordinate> points) const
+{
+   auto radarSite = radar_product_manager()->radar_site();
+
+   const common::Coordinate center {radarSite->latitude(),
+                                    radarSite->longitude()};
+
+   std::vector<common::Coordinate> coordinates(points.size());
+
+   std::transform(std::execution::par_unseq,
+                  points.begin(),
+                  points.end(),
+                  coordinates.begin(),
+                  [&](const wsr88d::VolumeIndex::PolarCoordinate& point)
+                  {
+                     return util::GeographicLib::GetCoordinate(
+                        center,
+                        units::angle::degrees<double> {point.azimuth_},
+                        units::length::meters<double> {point.distance_});
+                  });
+
+   return SampleBins(coordinates);
+}
+
 bool RadarProductView::IgnoreUnits() const
 {
    return false;
 }
 
+bool RadarProductView::MaskZeroDataMoment() const
+{
+   return false;
+}
+
 std::vector<std::pair<std::string, std::string>>
 RadarProductView::GetDescriptionFields() const
 {
    return {};
 }
 
+std::vector<wsr88d::VolumeIndex::PolarCoordinate>
+RadarProductView::GetPolarCoordinates(
+   std::span<const common::Coordinate> coordinates) const
+{
+   auto         radarSite      = radar_product_manager()->radar_site();
+   const double radarLatitude  = radarSite->latitude();
+   const double radarLongitude = radarSite->longitude();
+
+   const ::GeographicLib::Geodesic& geodesic =
+      util::GeographicLib::DefaultGeodesic();
+
+   std::vector<wsr88d::VolumeIndex::PolarCoordinate> points(coordinates.size());
+
+   std::transform(std::execution::par_unseq,
+                  coordinates.begin(),
+                  coordinates.end(),
+                  points.begin(),
+                  [&](const common::Coordinate& coordinate)
+                  {
+                     // Determine distance and azimuth of coordinate relative to
+                     // radar location. Azimuth is returned as [-180, 180).
+                     double s12;  // Distance (meters)
+                     double azi1; // Azimuth (degrees)
+                     double azi2; // Unused
+                     geodesic.Inverse(radarLatitude,
+                                      radarLongitude,
+                                      coordinate.latitude_,
+                                      coordinate.longitude_,
+                                      s12,
+                                      azi1,
+                                      azi2);
+
+                     return wsr88d::VolumeIndex::PolarCoordinate {azi1, s12};
+                  });
+
+   return points;
+}
+
+void RadarProductView::UpdateVerticesGeneration()
+{
+   // Must be called with the sweep mutex locked
+   p->verticesGeneration_ = nextVerticesGeneration_++;
+}
+
 void RadarProductView::ComputeSweep()
 {
    logger_->debug("ComputeSweep()");
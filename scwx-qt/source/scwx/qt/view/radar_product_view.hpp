@@ -5,12 +5,14 @@
 #include <scwx/common/products.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
 #include <scwx/qt/types/map_types.hpp>
+#include <scwx/wsr88d/volume_index.hpp>
 #include <scwx/wsr88d/wsr88d_types.hpp>
 
 #include <chrono>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include <QObject>
@@ -49,7 +51,14 @@ public:
 
    std::shared_ptr<manager::RadarProductManager> radar_product_manager() const;
    std::chrono::system_clock::time_point         selected_time() const;
-   std::mutex&                                   sweep_mutex();
+   std::mutex&                                   sweep_mutex() const;
+
+   /**
+    * @brief Gets the generation of the vertices. The generation changes each
+    * time the vertices are recomputed, and is unique across all views. A
+    * computed sweep with the same generation only has new data moments.
+    */
+   std::uint64_t vertices_generation() const;
 
    void set_radar_product_manager(
       std::shared_ptr<manager::RadarProductManager> radarProductManager);
@@ -74,17 +83,61 @@ public:
 
    virtual std::optional<std::uint16_t>
    GetBinLevel(const common::Coordinate& coordinate) const = 0;
+
+   /**
+    * @brief Samples the bin levels at a set of coordinates in a single call.
+    *
+    * @param [in] coordinates Coordinates to sample
+    *
+    * @return Bin level at each coordinate, or std::nullopt where no bin is
+    * displayed
+    */
+   virtual std::vector<std::optional<std::uint16_t>>
+   SampleBins(std::span<const common::Coordinate> coordinates) const;
+
+   /**
+    * @brief Samples the bin levels at a set of points given relative to the
+    * radar site. Points which are sampled repeatedly may be converted once,
+    * avoiding the geodesic calculations of SampleBins. Must be called with the
+    * sweep mutex locked.
+    *
+    * @param [in] points Azimuth and distance of each point from the radar site
+    *
+    * @return Bin level at each point, or std::nullopt where no bin is displayed
+    */
+   virtual std::vector<std::optional<std::uint16_t>> SamplePolarBins(
+      std::span<const wsr88d::VolumeIndex::PolarCoordinate> points) const;
    virtual std::optional<wsr88d::DataLevelCode>
                                 GetDataLevelCode(std::uint16_t level) const = 0;
    virtual std::optional<float> GetDataValue(std::uint16_t level) const     = 0;
    virtual bool                 IgnoreUnits() const;
 
+   /**
+    * @brief Gets whether bins with a data moment of 0 are hidden. Views which
+    * keep the vertices of bins below threshold store a data moment of 0 for
+    * these bins.
+    */
+   virtual bool MaskZeroDataMoment() const;
+
    virtual std::vector<std::pair<std::string, std::string>>
    GetDescriptionFields() const;
 
 protected:
    virtual boost::asio::thread_pool& thread_pool() = 0;
 
+   /**
+    * @brief Converts coordinates to points relative to the radar site.
+    *
+    * @param [in] coordinates Coordinates to convert
+    *
+    * @return Azimuth and distance of each coordinate from the radar site. The
+    * azimuth is NaN if it could not be determined.
+    */
+   std::vector<wsr88d::VolumeIndex::PolarCoordinate>
+   GetPolarCoordinates(std::span<const common::Coordinate> coordinates) const;
+
+   void UpdateVerticesGeneration();
+
    virtual void ConnectRadarProductManager()    = 0;
    virtual void DisconnectRadarProductManager() = 0;
    virtual void UpdateColorTableLut()           = 0;
@@ -1,8 +1,10 @@
 #include <scwx/qt/view/radar_product_view_factory.hpp>
+#include <scwx/qt/view/level2_derived_view.hpp>
 #include <scwx/qt/view/level2_product_view.hpp>
 #include <scwx/qt/view/level3_radial_view.hpp>
 #include <scwx/qt/view/level3_raster_view.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/wsr88d/derived_products.hpp>
 
 #include <unordered_set>
 
@@ -81,6 +83,12 @@ std::shared_ptr<RadarProductView> RadarProductViewFactory::Create(
    common::Level2Product                         product,
    std::shared_ptr<manager::RadarProductManager> radarProductManager)
 {
+   // Products derived from the volume are displayed by a separate view
+   if (wsr88d::DerivedProducts::IsDerivedProduct(product))
+   {
+      return Level2DerivedView::Create(product, radarProductManager);
+   }
+
    return Level2ProductView::Create(product, radarProductManager);
 }
 
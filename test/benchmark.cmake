@@ -0,0 +1,40 @@
+cmake_minimum_required(VERSION 3.20)
+
+find_package(GTest)
+
+set(SRC_BENCH_MAIN source/scwx/wxbench.cpp)
+set(SRC_WSR88D_BENCHMARKS source/scwx/wsr88d/ar2v_file.bench.cpp)
+
+set(CMAKE_FILES benchmark.cmake)
+
+# Benchmarks replace the global allocator to measure allocations, so they are
+# built separately from wxtest, and are not registered with CTest
+add_executable(wxbench ${SRC_BENCH_MAIN}
+                       ${SRC_WSR88D_BENCHMARKS}
+                       ${CMAKE_FILES})
+
+source_group("Source Files\\main"   FILES ${SRC_BENCH_MAIN})
+source_group("Source Files\\wsr88d" FILES ${SRC_WSR88D_BENCHMARKS})
+
+target_include_directories(wxbench PRIVATE ${GTest_INCLUDE_DIRS})
+
+set_target_properties(wxbench PROPERTIES CXX_STANDARD 20
+                                         CXX_STANDARD_REQUIRED ON
+                                         CXX_EXTENSIONS OFF)
+
+if (MSVC)
+    set_target_properties(wxbench PROPERTIES LINK_FLAGS "/ignore:4099")
+endif()
+
+target_compile_definitions(wxbench PRIVATE SCWX_TEST_DATA_DIR="${SCWX_DIR}/test/data")
+
+if (MSVC)
+    # Don't include Windows macros
+    target_compile_options(wxbench PRIVATE -DNOMINMAX)
+
+    # Enable multi-processor compilation
+    target_compile_options(wxbench PRIVATE "/MP")
+endif()
+
+target_link_libraries(wxbench GTest::gtest
+                              wxdata)
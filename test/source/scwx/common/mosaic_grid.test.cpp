@@ -0,0 +1,120 @@
+#include <scwx/common/mosaic_grid.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace common
+{
+
+// KLSX and KSGF
+static const std::vector<Coordinate> kSites_ {{38.6986, -90.6828},
+                                              {37.2353, -93.4006}};
+static constexpr double kRange_      = 230000.0;
+static constexpr double kResolution_ = 0.02;
+
+TEST(MosaicGrid, Coverage)
+{
+   MosaicGrid grid {kSites_, kRange_, kResolution_};
+
+   ASSERT_EQ(grid.site_count(), 2u);
+   ASSERT_GT(grid.cell_count(), 0u);
+   EXPECT_EQ(grid.levels().size(), grid.cell_count());
+
+   // Each site covers a circle of about pi * r^2
+   const double cellArea = kResolution_ * 111195.0 * kResolution_ * 111195.0 *
+                           std::cos(kSites_[0].latitude_ * kDegreesToRadians);
+   const double siteCells = 3.14159265 * kRange_ * kRange_ / cellArea;
+
+   EXPECT_NEAR(grid.site_cells(0).size(), siteCells, siteCells * 0.05);
+
+   // The sites overlap
+   EXPECT_LT(grid.cell_count(),
+             grid.site_cells(0).size() + grid.site_cells(1).size());
+
+   // Each cell of a site is found from its center
+   for (std::uint32_t cell : grid.site_cells(1))
+   {
+      EXPECT_EQ(grid.FindCell(grid.cell_center(cell)), cell);
+   }
+
+   // Sites are covered, and points beyond range are not
+   EXPECT_TRUE(grid.FindCell(kSites_[0]).has_value());
+   EXPECT_TRUE(grid.FindCell(kSites_[1]).has_value());
+   EXPECT_FALSE(grid.FindCell({43.0, -80.0}).has_value());
+
+   EXPECT_EQ(grid.GetVertices().size(), grid.cell_count() * 12u);
+}
+
+TEST(MosaicGrid, NearestRadar)
+{
+   MosaicGrid grid {kSites_, kRange_, kResolution_, MosaicRule::NearestRadar};
+
+   const auto site0Cells = grid.site_cells(0);
+   const auto site1Cells = grid.site_cells(1);
+
+   const std::size_t site0Cell = *grid.FindCell(kSites_[0]);
+   const std::size_t site1Cell = *grid.FindCell(kSites_[1]);
+   const std::size_t midCell   = *grid.FindCell(
+      {(kSites_[0].latitude_ * 3.0 + kSites_[1].latitude_) / 4.0,
+       (kSites_[0].longitude_ * 3.0 + kSites_[1].longitude_) / 4.0});
+
+   // Only site 1 is loaded, so it fills every cell it covers
+   grid.UpdateSite(1, std::vector<std::uint16_t>(site1Cells.size(), 20u));
+
+   EXPECT_EQ(grid.levels()[site1Cell], 20u);
+   EXPECT_EQ(grid.levels()[midCell], 20u);
+   EXPECT_EQ(grid.levels()[site0Cell], 0u);
+
+   // Site 0 is nearer to the cell between the sites
+   grid.UpdateSite(0, std::vector<std::uint16_t>(site0Cells.size(), 10u));
+
+   EXPECT_EQ(grid.levels()[site1Cell], 20u);
+   EXPECT_EQ(grid.levels()[midCell], 10u);
+   EXPECT_EQ(grid.levels()[site0Cell], 10u);
+
+   // Cells without data from the nearest site are not filled by another site
+   grid.UpdateSite(0, std::vector<std::uint16_t>(site0Cells.size(), 0u));
+
+   EXPECT_EQ(grid.levels()[midCell], 0u);
+
+   grid.ClearSite(0);
+
+   EXPECT_EQ(grid.levels()[midCell], 20u);
+   EXPECT_EQ(grid.levels()[site0Cell], 0u);
+}
+
+TEST(MosaicGrid, MaximumValue)
+{
+   MosaicGrid grid {kSites_, kRange_, kResolution_, MosaicRule::MaximumValue};
+
+   const auto site0Cells = grid.site_cells(0);
+   const auto site1Cells = grid.site_cells(1);
+
+   const std::size_t midCell = *grid.FindCell(
+      {(kSites_[0].latitude_ * 3.0 + kSites_[1].latitude_) / 4.0,
+       (kSites_[0].longitude_ * 3.0 + kSites_[1].longitude_) / 4.0});
+
+   grid.UpdateSite(0, std::vector<std::uint16_t>(site0Cells.size(), 10u));
+   grid.UpdateSite(1, std::vector<std::uint16_t>(site1Cells.size(), 20u));
+
+   EXPECT_EQ(grid.levels()[midCell], 20u);
+
+   for (std::uint32_t cell : site0Cells)
+   {
+      const bool shared =
+         std::binary_search(site1Cells.begin(), site1Cells.end(), cell);
+      EXPECT_EQ(grid.levels()[cell], shared ? 20u : 10u);
+   }
+
+   // An invalid number of levels is ignored
+   grid.UpdateSite(0, std::vector<std::uint16_t>(1u, 30u));
+
+   EXPECT_EQ(grid.levels()[midCell], 20u);
+}
+
+} // namespace common
+} // namespace scwx
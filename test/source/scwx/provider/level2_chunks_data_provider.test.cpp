@@ -0,0 +1,175 @@
+#include <scwx/provider/local_level2_chunks_data_provider.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string kRadarSite_ {"KLSX"};
+static const std::string kVolumeKey_ {"KLSX/7/20210527-175717"};
+
+class Level2ChunksDataProviderTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      directory_ = std::filesystem::temp_directory_path() /
+                   "scwx-level2-chunks-data-provider-test";
+      std::filesystem::remove_all(directory_);
+      std::filesystem::create_directories(directory_);
+
+      // Split the volume into a start chunk containing the Volume Header Record
+      // and the first two LDM records, intermediate chunks of 20 LDM records,
+      // and an end chunk
+      std::ifstream f(std::string(SCWX_TEST_DATA_DIR) +
+                         "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v",
+                      std::ios_base::in | std::ios_base::binary);
+      std::vector<char> data {std::istreambuf_iterator<char>(f),
+                              std::istreambuf_iterator<char>()};
+
+      static constexpr std::size_t kVolumeHeaderSize = 24;
+
+      std::size_t offset     = kVolumeHeaderSize;
+      std::size_t chunkBegin = 0;
+      std::size_t records    = 0;
+
+      while (offset + 4 <= data.size())
+      {
+         std::int32_t controlWord =
+            (static_cast<std::uint8_t>(data[offset]) << 24) |
+            (static_cast<std::uint8_t>(data[offset + 1]) << 16) |
+            (static_cast<std::uint8_t>(data[offset + 2]) << 8) |
+            static_cast<std::uint8_t>(data[offset + 3]);
+
+         offset += 4 + std::abs(controlWord);
+         ++records;
+
+         if (records == 2 || (records > 2 && (records - 2) % 20 == 0))
+         {
+            chunks_.emplace_back(data.begin() + chunkBegin,
+                                 data.begin() + offset);
+            chunkBegin = offset;
+         }
+      }
+
+      if (chunkBegin < data.size())
+      {
+         chunks_.emplace_back(data.begin() + chunkBegin, data.end());
+      }
+   }
+
+   void TearDown() override { std::filesystem::remove_all(directory_); }
+
+   void WriteChunk(const std::string&       volumeKey,
+                   std::size_t              chunkNumber,
+                   std::size_t              chunkCount,
+                   const std::vector<char>& chunk)
+   {
+      char chunkType = (chunkNumber == 1)          ? 'S' :
+                       (chunkNumber == chunkCount) ? 'E' :
+                                                     'I';
+
+      std::filesystem::path path =
+         directory_ /
+         fmt::format("{}-{:03}-{}", volumeKey, chunkNumber, chunkType);
+      std::filesystem::create_directories(path.parent_path());
+
+      std::ofstream os(path, std::ios_base::out | std::ios_base::binary);
+      os.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+   }
+
+   std::filesystem::path          directory_ {};
+   std::vector<std::vector<char>> chunks_ {};
+};
+
+TEST_F(Level2ChunksDataProviderTest, GetTimePointFromKey)
+{
+   using namespace std::chrono;
+   using sys_days = time_point<system_clock, days>;
+
+   const auto expectedTime = sys_days {2021y / May / 27d} + 17h + 57min + 17s;
+
+   EXPECT_EQ(Level2ChunksDataProvider::GetTimePointFromKey(kVolumeKey_),
+             expectedTime);
+   EXPECT_EQ(Level2ChunksDataProvider::GetTimePointFromKey(kVolumeKey_ +
+                                                           "-001-S"),
+             expectedTime);
+}
+
+TEST_F(Level2ChunksDataProviderTest, Refresh)
+{
+   ASSERT_GE(chunks_.size(), 3u);
+
+   const std::size_t chunkCount = chunks_.size();
+   const std::size_t midChunk   = chunkCount / 2;
+
+   // A volume left over from the previous cycle of volume numbers
+   WriteChunk("KLSX/8/20210526-175717", 1, 2, chunks_[0]);
+   WriteChunk("KLSX/8/20210526-175717", 2, 2, chunks_[1]);
+
+   // The first half of the volume in progress
+   for (std::size_t i = 0; i < midChunk; ++i)
+   {
+      WriteChunk(kVolumeKey_, i + 1, chunkCount, chunks_[i]);
+   }
+
+   LocalLevel2ChunksDataProvider provider(kRadarSite_, directory_.string());
+
+   auto [newElevations, totalVolumes] = provider.Refresh();
+
+   EXPECT_EQ(totalVolumes, 1u);
+   EXPECT_EQ(provider.FindLatestKey(), kVolumeKey_);
+   EXPECT_EQ(provider.TakeCompletedElevationScans().size(), newElevations);
+
+   auto file = std::dynamic_pointer_cast<wsr88d::Ar2vFile>(
+      provider.LoadObjectByKey(kVolumeKey_));
+   ASSERT_NE(file, nullptr);
+
+   const std::size_t partialElevations = file->radar_data().size();
+
+   // The remainder of the volume
+   for (std::size_t i = midChunk; i < chunkCount; ++i)
+   {
+      WriteChunk(kVolumeKey_, i + 1, chunkCount, chunks_[i]);
+   }
+
+   auto [moreElevations, moreVolumes] = provider.Refresh();
+
+   EXPECT_EQ(moreVolumes, 1u);
+   EXPECT_GT(moreElevations, 0u);
+
+   // Each elevation scan completed by the refresh is reported
+   auto completedScans = provider.TakeCompletedElevationScans();
+   ASSERT_EQ(completedScans.size(), moreElevations);
+   for (const auto& [key, elevationCut] : completedScans)
+   {
+      EXPECT_EQ(key, kVolumeKey_);
+      EXPECT_GE(elevationCut, 0.0f);
+   }
+
+   // Completed elevation scans are only taken once
+   EXPECT_EQ(provider.TakeCompletedElevationScans().empty(), true);
+
+   // The growing file is shared, and contains the complete volume
+   EXPECT_EQ(provider.LoadObjectByKey(kVolumeKey_), file);
+
+   wsr88d::Ar2vFile archiveFile;
+   archiveFile.LoadFile(std::string(SCWX_TEST_DATA_DIR) +
+                        "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v");
+
+   EXPECT_GT(file->radar_data().size(), partialElevations);
+   EXPECT_EQ(file->radar_data().size(), archiveFile.radar_data().size());
+   EXPECT_GE(newElevations + moreElevations,
+             archiveFile.radar_data().size());
+   EXPECT_EQ(file->message_count(), archiveFile.message_count());
+}
+
+} // namespace provider
+} // namespace scwx
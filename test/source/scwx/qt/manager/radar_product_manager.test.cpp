@@ -0,0 +1,69 @@
+#include <scwx/qt/manager/radar_product_manager.hpp>
+
+#include <condition_variable>
+#include <mutex>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace manager
+{
+
+TEST(RadarProductManagerTest, LoadLevel3DataBatch)
+{
+   using namespace std::chrono;
+   using sys_days = time_point<system_clock, days>;
+
+   // N0Q products from 17:46 to 17:57 (3 files)
+   const auto startTime = sys_days {2021y / May / 27d} + 17h + 45min;
+   const auto endTime   = sys_days {2021y / May / 27d} + 17h + 58min;
+   const std::vector<std::string> products {"N0Q"};
+
+   auto radarProductManager = RadarProductManager::Instance("KLSX");
+
+   std::mutex              mutex {};
+   std::condition_variable condition {};
+   std::size_t             recordsLoaded {0};
+
+   QObject::connect(radarProductManager.get(),
+                    &RadarProductManager::DataReloaded,
+                    [&](std::shared_ptr<types::RadarProductRecord>)
+                    {
+                       std::unique_lock lock {mutex};
+                       ++recordsLoaded;
+                       condition.notify_all();
+                    });
+
+   // Files in the time range are queued once
+   std::size_t filesQueued =
+      radarProductManager->LoadLevel3Data(products, startTime, endTime);
+   std::size_t overlappingFilesQueued =
+      radarProductManager->LoadLevel3Data(products, startTime, endTime);
+
+   EXPECT_GT(filesQueued, 0u);
+   EXPECT_EQ(overlappingFilesQueued, 0u);
+
+   {
+      std::unique_lock lock {mutex};
+      EXPECT_TRUE(condition.wait_for(
+         lock, 60s, [&]() { return recordsLoaded >= filesQueued; }));
+      EXPECT_EQ(recordsLoaded, filesQueued);
+   }
+
+   // Loaded files are not queued again
+   EXPECT_EQ(radarProductManager->LoadLevel3Data(products, startTime, endTime),
+             0u);
+
+   auto [message, time] = radarProductManager->GetLevel3Data("N0Q", endTime);
+
+   EXPECT_NE(message, nullptr);
+   EXPECT_GE(time, startTime);
+   EXPECT_LE(time, endTime);
+}
+
+} // namespace manager
+} // namespace qt
+} // namespace scwx
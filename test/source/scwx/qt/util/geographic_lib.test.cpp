@@ -0,0 +1,94 @@
+#include <scwx/qt/util/geographic_lib.hpp>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+namespace GeographicLib
+{
+
+// Maximum distance between fast and exact projections, well under the width
+// of a 250 m range gate
+static constexpr double kMaxProjectionError_ = 2.5; // Meters
+
+static constexpr double      kRangeInterval_ = 2500.0; // Meters
+static constexpr std::size_t kNumPoints_     = 185;    // 460 km
+
+class GeographicLibProjectionTest : public testing::TestWithParam<double>
+{
+};
+
+TEST_P(GeographicLibProjectionTest, FastProjectionError)
+{
+   const common::Coordinate center {GetParam(), -97.4};
+
+   std::vector<float> exact(kNumPoints_ * 2);
+   std::vector<float> fast(kNumPoints_ * 2);
+
+   double maxError = 0.0;
+
+   for (double angle = 0.25; angle < 360.0; angle += 5.0)
+   {
+      GetRadialCoordinates(center,
+                           units::angle::degrees<double> {angle},
+                           units::length::meters<double> {kRangeInterval_},
+                           units::length::meters<double> {kRangeInterval_},
+                           exact,
+                           ProjectionMode::Exact);
+      GetRadialCoordinates(center,
+                           units::angle::degrees<double> {angle},
+                           units::length::meters<double> {kRangeInterval_},
+                           units::length::meters<double> {kRangeInterval_},
+                           fast,
+                           ProjectionMode::Fast);
+
+      for (std::size_t i = 0; i < kNumPoints_; ++i)
+      {
+         const double error = GetDistance(exact[i * 2],
+                                          exact[i * 2 + 1],
+                                          fast[i * 2],
+                                          fast[i * 2 + 1])
+                                 .value();
+         maxError = std::max(maxError, error);
+      }
+   }
+
+   EXPECT_LT(maxError, kMaxProjectionError_);
+}
+
+TEST(GeographicLibTest, FastProjectionAntimeridian)
+{
+   const common::Coordinate center {13.45, 179.9};
+
+   std::vector<float> fast(kNumPoints_ * 2);
+
+   GetRadialCoordinates(center,
+                        units::angle::degrees<double> {90.0},
+                        units::length::meters<double> {kRangeInterval_},
+                        units::length::meters<double> {kRangeInterval_},
+                        fast,
+                        ProjectionMode::Fast);
+
+   // Longitudes are normalized to [-180, 180]
+   for (std::size_t i = 0; i < kNumPoints_; ++i)
+   {
+      EXPECT_GE(fast[i * 2 + 1], -180.0f);
+      EXPECT_LE(fast[i * 2 + 1], 180.0f);
+   }
+   EXPECT_LT(fast[kNumPoints_ * 2 - 1], 0.0f);
+}
+
+INSTANTIATE_TEST_SUITE_P(GeographicLibTest,
+                         GeographicLibProjectionTest,
+                         testing::Values(-45.0, 0.0, 18.4, 35.3, 47.1, 64.8));
+
+} // namespace GeographicLib
+} // namespace util
+} // namespace qt
+} // namespace scwx
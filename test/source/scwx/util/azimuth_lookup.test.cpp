@@ -0,0 +1,129 @@
+#include <scwx/util/azimuth_lookup.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static std::optional<std::size_t>
+FindRadialReference(const std::vector<float>& startAngles, double azimuth)
+{
+   const std::size_t numRadials = startAngles.size();
+
+   for (std::size_t i = 0; i < numRadials; ++i)
+   {
+      const float startAngle = startAngles[i];
+      const float nextAngle  = startAngles[(i + 1) % numRadials];
+
+      if (startAngle < nextAngle)
+      {
+         if (startAngle <= azimuth && azimuth < nextAngle)
+         {
+            return i;
+         }
+      }
+      else if (startAngle <= azimuth || azimuth < nextAngle)
+      {
+         return i;
+      }
+   }
+
+   return std::nullopt;
+}
+
+static std::vector<float> CreateStartAngles(std::size_t   numRadials,
+                                            float         firstAngle,
+                                            float         jitter,
+                                            std::mt19937& generator)
+{
+   const float spacing = 360.0f / static_cast<float>(numRadials);
+
+   std::uniform_real_distribution<float> distribution(-jitter, jitter);
+   std::vector<float>                    startAngles(numRadials);
+
+   for (std::size_t i = 0; i < numRadials; ++i)
+   {
+      const float angle = firstAngle + spacing * static_cast<float>(i) +
+                          distribution(generator);
+      startAngles[i]    = std::fmod(angle + 360.0f, 360.0f);
+   }
+
+   return startAngles;
+}
+
+TEST(AzimuthLookup, MatchesLinearScan)
+{
+   std::mt19937                           generator {1234u};
+   std::uniform_real_distribution<double> azimuths(0.0, 360.0);
+
+   for (std::size_t numRadials : {360u, 720u})
+   {
+      for (float firstAngle : {0.0f, 0.25f, 359.8f, 180.3f})
+      {
+         std::vector<float> startAngles =
+            CreateStartAngles(numRadials, firstAngle, 0.05f, generator);
+
+         AzimuthLookup lookup {startAngles};
+         EXPECT_EQ(lookup.radial_count(), numRadials);
+
+         for (int i = 0; i < 10000; ++i)
+         {
+            const double azimuth = azimuths(generator);
+            EXPECT_EQ(lookup.FindRadial(azimuth),
+                      FindRadialReference(startAngles, azimuth))
+               << "Azimuth: " << azimuth;
+         }
+
+         // Radial boundaries are found exactly
+         for (float startAngle : startAngles)
+         {
+            EXPECT_EQ(lookup.FindRadial(startAngle),
+                      FindRadialReference(startAngles, startAngle));
+         }
+      }
+   }
+}
+
+TEST(AzimuthLookup, WrapsAzimuth)
+{
+   std::vector<float> startAngles {0.0f, 90.0f, 180.0f, 270.0f};
+   AzimuthLookup      lookup {startAngles};
+
+   EXPECT_EQ(lookup.FindRadial(45.0), 0u);
+   EXPECT_EQ(lookup.FindRadial(405.0), 0u);
+   EXPECT_EQ(lookup.FindRadial(-45.0), 3u);
+   EXPECT_EQ(lookup.FindRadial(359.999), 3u);
+   EXPECT_EQ(lookup.FindRadial(std::nan("")), std::nullopt);
+}
+
+TEST(AzimuthLookup, NarrowAndUnorderedRadials)
+{
+   // Radials narrower than the resolution, and start angles which are not
+   // monotonic, are still found
+   std::vector<float> startAngles {10.0f, 10.01f, 10.02f, 200.0f, 100.0f};
+   AzimuthLookup      lookup {startAngles, 1.0f};
+
+   for (double azimuth = 0.0; azimuth < 360.0; azimuth += 0.005)
+   {
+      EXPECT_EQ(lookup.FindRadial(azimuth),
+                FindRadialReference(startAngles, azimuth))
+         << "Azimuth: " << azimuth;
+   }
+}
+
+TEST(AzimuthLookup, Empty)
+{
+   AzimuthLookup lookup {std::vector<float> {}};
+
+   EXPECT_EQ(lookup.radial_count(), 0u);
+   EXPECT_EQ(lookup.FindRadial(0.0), std::nullopt);
+}
+
+} // namespace util
+} // namespace scwx
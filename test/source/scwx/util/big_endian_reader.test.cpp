@@ -0,0 +1,93 @@
+#include <scwx/util/big_endian_reader.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::array<char, 24> kTestData_ {
+   '\x12', '\x34',                         // 0-1
+   '\x89', '\xAB', '\xCD', '\xEF',         // 2-5
+   '\xFF', '\xFE',                         // 6-7
+   '\x3F', '\xC0', '\x00', '\x00',         // 8-11
+   'K',    'L',    'S',    'X',            // 12-15
+   '\x00', '\x01', '\x00', '\x02', '\x00', // 16-20
+   '\x03', '\x7F', '\x80'};                // 21-23
+
+TEST(BigEndianReaderTest, ReadValues)
+{
+   BigEndianReader reader {kTestData_};
+
+   EXPECT_EQ(reader.Read<std::uint16_t>(), 0x1234u);
+   EXPECT_EQ(reader.Read<std::uint32_t>(), 0x89ABCDEFu);
+   EXPECT_EQ(reader.Read<std::int16_t>(), -2);
+   EXPECT_EQ(reader.Read<float>(), 1.5f);
+   EXPECT_EQ(reader.ReadString(4), "KLSX");
+
+   std::array<std::uint16_t, 3> values {};
+   EXPECT_TRUE(reader.ReadArray(values));
+   EXPECT_EQ(values, (std::array<std::uint16_t, 3> {1u, 2u, 3u}));
+
+   EXPECT_EQ(reader.Read<std::int8_t>(), 127);
+   EXPECT_EQ(reader.Read<std::uint8_t>(), 128u);
+
+   EXPECT_EQ(reader.position(), kTestData_.size());
+   EXPECT_EQ(reader.remaining(), 0u);
+   EXPECT_FALSE(reader.fail());
+}
+
+TEST(BigEndianReaderTest, SeekAndSkip)
+{
+   BigEndianReader reader {kTestData_.data(), kTestData_.size()};
+
+   EXPECT_TRUE(reader.Seek(12));
+   EXPECT_EQ(reader.current(), kTestData_.data() + 12);
+
+   std::span<const char> span = reader.ReadSpan(4);
+   EXPECT_EQ(span.data(), kTestData_.data() + 12);
+   EXPECT_EQ(span.size(), 4u);
+
+   EXPECT_TRUE(reader.Skip(5));
+   EXPECT_EQ(reader.Read<std::uint16_t>(), 0x037Fu);
+
+   EXPECT_TRUE(reader.Seek(0));
+   EXPECT_EQ(reader.Read<std::uint16_t>(), 0x1234u);
+   EXPECT_FALSE(reader.fail());
+}
+
+TEST(BigEndianReaderTest, ReadPastEnd)
+{
+   BigEndianReader reader {std::span<const char>(kTestData_).first(6)};
+
+   EXPECT_EQ(reader.Read<std::uint32_t>(), 0x123489ABu);
+
+   // A failed read does not consume data
+   std::uint32_t value = 42;
+   EXPECT_FALSE(reader.Read(value));
+   EXPECT_EQ(value, 42u);
+   EXPECT_EQ(reader.position(), 4u);
+   EXPECT_TRUE(reader.fail());
+
+   // The failure state persists, even if subsequent reads are within bounds
+   EXPECT_EQ(reader.Read<std::uint16_t>(), 0u);
+   EXPECT_TRUE(reader.ReadSpan(1).empty());
+   EXPECT_TRUE(reader.ReadString(1).empty());
+   EXPECT_TRUE(reader.fail());
+}
+
+TEST(BigEndianReaderTest, SeekPastEnd)
+{
+   BigEndianReader reader {kTestData_};
+
+   EXPECT_FALSE(reader.Seek(kTestData_.size() + 1));
+   EXPECT_TRUE(reader.fail());
+   EXPECT_EQ(reader.position(), 0u);
+
+   std::array<std::uint16_t, 16> values {};
+   EXPECT_FALSE(reader.ReadArray(values));
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,107 @@
+#include <scwx/util/inflate.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static std::vector<char> Deflate(const std::string& data, InflateFormat format)
+{
+   z_stream stream {};
+   deflateInit2(&stream,
+                Z_DEFAULT_COMPRESSION,
+                Z_DEFLATED,
+                (format == InflateFormat::Gzip) ? 15 + 16 : 15,
+                8,
+                Z_DEFAULT_STRATEGY);
+
+   std::vector<char> output(deflateBound(&stream, data.size()) + 32);
+
+   stream.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+   stream.avail_in  = static_cast<uInt>(data.size());
+   stream.next_out  = reinterpret_cast<Bytef*>(output.data());
+   stream.avail_out = static_cast<uInt>(output.size());
+
+   deflate(&stream, Z_FINISH);
+   output.resize(stream.total_out);
+   deflateEnd(&stream);
+
+   return output;
+}
+
+static std::string Repeat(const std::string& data, std::size_t count)
+{
+   std::string output {};
+   for (std::size_t i = 0; i < count; ++i)
+   {
+      output += data;
+   }
+   return output;
+}
+
+class InflateTest : public testing::TestWithParam<InflateFormat>
+{
+};
+
+TEST_P(InflateTest, SingleMember)
+{
+   // Highly compressible data requires the output buffer to grow
+   const std::string data = Repeat("Supercell ", 100000);
+   auto              compressed = Deflate(data, GetParam());
+
+   std::vector<char>          output {};
+   std::optional<std::size_t> bytesConsumed =
+      Inflate(compressed, GetParam(), output);
+
+   ASSERT_EQ(bytesConsumed.has_value(), true);
+   EXPECT_EQ(*bytesConsumed, compressed.size());
+   EXPECT_EQ(std::string(output.cbegin(), output.cend()), data);
+}
+
+TEST_P(InflateTest, MultipleMembers)
+{
+   const std::string data1 = Repeat("Level 3 ", 1000);
+   const std::string data2 = Repeat("Radial ", 2000);
+
+   auto compressed  = Deflate(data1, GetParam());
+   auto compressed2 = Deflate(data2, GetParam());
+   compressed.insert(compressed.end(), compressed2.cbegin(), compressed2.cend());
+
+   // Data following the last member is not consumed
+   const std::size_t compressedSize = compressed.size();
+   compressed.push_back('\0');
+
+   std::vector<char>          output {};
+   std::optional<std::size_t> bytesConsumed =
+      Inflate(compressed, GetParam(), output);
+
+   ASSERT_EQ(bytesConsumed.has_value(), true);
+   EXPECT_EQ(*bytesConsumed, compressedSize);
+   EXPECT_EQ(std::string(output.cbegin(), output.cend()), data1 + data2);
+}
+
+TEST_P(InflateTest, InvalidData)
+{
+   auto compressed = Deflate("Supercell", GetParam());
+
+   // Corrupt the header
+   compressed[1] = static_cast<char>(~compressed[1]);
+
+   std::vector<char> output {};
+
+   EXPECT_EQ(Inflate(compressed, GetParam(), output).has_value(), false);
+   EXPECT_EQ(output.empty(), true);
+}
+
+INSTANTIATE_TEST_SUITE_P(Util,
+                         InflateTest,
+                         testing::Values(InflateFormat::Zlib,
+                                         InflateFormat::Gzip));
+
+} // namespace util
+} // namespace scwx
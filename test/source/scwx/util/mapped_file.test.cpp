@@ -0,0 +1,50 @@
+#include <scwx/util/mapped_file.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(MappedFileTest, MapFile)
+{
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) +
+                               "/colors/reflectivity.pal"};
+
+   std::ifstream     f(filename, std::ios_base::in | std::ios_base::binary);
+   std::vector<char> fileData {std::istreambuf_iterator<char>(f),
+                               std::istreambuf_iterator<char>()};
+
+   MappedFile mappedFile {filename};
+
+   ASSERT_EQ(mappedFile.is_open(), true);
+   ASSERT_EQ(mappedFile.data().size(), fileData.size());
+   EXPECT_EQ(std::equal(fileData.cbegin(),
+                        fileData.cend(),
+                        mappedFile.data().begin()),
+             true);
+
+   // The mapping is transferred on move
+   MappedFile movedFile {std::move(mappedFile)};
+
+   EXPECT_EQ(movedFile.is_open(), true);
+   EXPECT_EQ(movedFile.data().size(), fileData.size());
+}
+
+TEST(MappedFileTest, MissingFile)
+{
+   MappedFile mappedFile {std::string(SCWX_TEST_DATA_DIR) +
+                          "/colors/missing.pal"};
+
+   EXPECT_EQ(mappedFile.is_open(), false);
+   EXPECT_EQ(mappedFile.data().empty(), true);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,77 @@
+#include <scwx/util/memory_arena.hpp>
+
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(MemoryArenaTest, Allocate)
+{
+   MemoryArena arena {256};
+
+   void* a = arena.allocate(24, alignof(std::uint64_t));
+   void* b = arena.allocate(1000, alignof(std::uint32_t));
+
+   EXPECT_NE(a, nullptr);
+   EXPECT_NE(b, nullptr);
+   EXPECT_NE(a, b);
+   EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a) % alignof(std::uint64_t), 0u);
+   EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % alignof(std::uint32_t), 0u);
+
+   arena.deallocate(a, 24, alignof(std::uint64_t));
+
+   EXPECT_EQ(arena.allocation_count(), 2u);
+   EXPECT_EQ(arena.bytes_allocated(), 1024u);
+}
+
+TEST(MemoryArenaTest, MakeArenaShared)
+{
+   std::weak_ptr<MemoryArena>   weakArena;
+   std::shared_ptr<std::string> value;
+
+   {
+      auto arena = std::make_shared<MemoryArena>();
+      weakArena  = arena;
+
+      value = MakeArenaShared<std::string>(arena, "arena");
+
+      // The object and its control block are allocated from the arena
+      EXPECT_EQ(arena->allocation_count(), 1u);
+   }
+
+   // The arena remains valid while objects allocated from it remain
+   EXPECT_FALSE(weakArena.expired());
+   EXPECT_EQ(*value, "arena");
+
+   value.reset();
+
+   EXPECT_TRUE(weakArena.expired());
+}
+
+TEST(MemoryArenaTest, MakeArenaUnique)
+{
+   MemoryArena arena;
+
+   {
+      ArenaUniquePtr<std::string> value =
+         MakeArenaUnique<std::string>(&arena, "arena");
+
+      EXPECT_EQ(*value, "arena");
+      EXPECT_EQ(arena.allocation_count(), 1u);
+   }
+
+   // Without a memory resource, the default memory resource is used
+   ArenaUniquePtr<std::string> value =
+      MakeArenaUnique<std::string>(nullptr, "default");
+
+   EXPECT_EQ(*value, "default");
+   EXPECT_EQ(arena.allocation_count(), 1u);
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,85 @@
+#include <scwx/util/run_length.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static std::vector<std::uint8_t>
+DecodeRunLengthReference(const std::vector<std::uint8_t>& data,
+                         std::size_t                      binCount)
+{
+   std::vector<std::uint8_t> levels(binCount, 0u);
+   std::size_t               bin = 0;
+
+   for (std::uint8_t value : data)
+   {
+      for (int i = 0; i < (value >> 4) && bin < binCount; ++i)
+      {
+         levels[bin++] = value & 0x0f;
+      }
+   }
+
+   return levels;
+}
+
+TEST(RunLengthTest, DecodeRunLength)
+{
+   const std::vector<std::uint8_t> data {0x31, 0xf2, 0x00, 0x13, 0x24};
+
+   std::vector<std::uint8_t> levels(24, 0xff);
+
+   EXPECT_EQ(GetRunLengthBinCount(data), 21u);
+   EXPECT_EQ(DecodeRunLength(data, levels), 21u);
+
+   // Levels following the decoded bins are cleared
+   EXPECT_EQ(levels, DecodeRunLengthReference(data, levels.size()));
+}
+
+TEST(RunLengthTest, DecodeRunLengthTruncated)
+{
+   const std::vector<std::uint8_t> data {0xf1, 0xf2, 0xf3};
+
+   // Bins beyond the size of the level array are discarded
+   std::vector<std::uint8_t> levels(20, 0u);
+
+   EXPECT_EQ(DecodeRunLength(data, levels), 20u);
+   EXPECT_EQ(levels, DecodeRunLengthReference(data, levels.size()));
+}
+
+TEST(RunLengthTest, DecodeRunLengthRandom)
+{
+   std::mt19937                       generator {1234u};
+   std::uniform_int_distribution<int> distribution {0, 255};
+
+   for (std::size_t size = 0; size < 256; ++size)
+   {
+      std::vector<std::uint8_t> data(size);
+      for (auto& value : data)
+      {
+         value = static_cast<std::uint8_t>(distribution(generator));
+      }
+
+      const std::size_t binCount = GetRunLengthBinCount(data);
+
+      // Decode into level arrays shorter than, equal to, and longer than the
+      // encoded data
+      for (std::size_t levelSize : {binCount / 2, binCount, binCount + 17})
+      {
+         std::vector<std::uint8_t> levels(levelSize, 0xff);
+
+         EXPECT_EQ(DecodeRunLength(data, levels),
+                   std::min(binCount, levelSize));
+         EXPECT_EQ(levels, DecodeRunLengthReference(data, levelSize));
+      }
+   }
+}
+
+} // namespace util
+} // namespace scwx
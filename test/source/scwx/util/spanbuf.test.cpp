@@ -0,0 +1,97 @@
+#include <scwx/util/spanbuf.hpp>
+
+#include <istream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+class spanbuf_test : public ::testing::Test
+{
+protected:
+   spanbuf_test() : sb_(std::span<const char>(data_, 7)), is_(&sb_), Test() {}
+   ~spanbuf_test() = default;
+
+   const char   data_[7] = "smiles";
+   spanbuf      sb_;
+   std::istream is_;
+};
+
+TEST_F(spanbuf_test, smiles)
+{
+   EXPECT_EQ(is_.eof(), false);
+   EXPECT_EQ(is_.fail(), false);
+
+   char data[7];
+   is_.read(data, 7);
+
+   EXPECT_EQ(std::string(data), std::string("smiles"));
+   EXPECT_EQ(is_.eof(), false);
+   EXPECT_EQ(is_.fail(), false);
+
+   is_.read(data, 1);
+
+   EXPECT_EQ(is_.eof(), true);
+   EXPECT_EQ(is_.fail(), true);
+}
+
+TEST_F(spanbuf_test, seekg_begin)
+{
+   is_.seekg(1, std::ios_base::beg);
+
+   char data[7] = {0};
+   is_.read(data, 6);
+
+   EXPECT_EQ(std::string(data), std::string("miles"));
+   EXPECT_EQ(is_.eof(), false);
+   EXPECT_EQ(is_.fail(), false);
+}
+
+TEST_F(spanbuf_test, seekg_cur)
+{
+   char data[4] = {0};
+   is_.read(data, 1);
+   is_.seekg(2, std::ios_base::cur);
+   is_.read(data, 3);
+
+   EXPECT_EQ(std::string(data), std::string("les"));
+   EXPECT_EQ(is_.tellg(), std::streampos(6));
+   EXPECT_EQ(is_.eof(), false);
+   EXPECT_EQ(is_.fail(), false);
+}
+
+TEST_F(spanbuf_test, seekg_end)
+{
+   is_.seekg(-4, std::ios_base::end);
+
+   char data[4] = {0};
+   is_.read(data, 3);
+
+   EXPECT_EQ(std::string(data), std::string("les"));
+   EXPECT_EQ(is_.eof(), false);
+   EXPECT_EQ(is_.fail(), false);
+}
+
+TEST_F(spanbuf_test, seekg_out_of_range)
+{
+   is_.seekg(8, std::ios_base::beg);
+
+   EXPECT_EQ(is_.fail(), true);
+}
+
+TEST_F(spanbuf_test, unread_data)
+{
+   is_.seekg(2, std::ios_base::beg);
+
+   std::span<const char> data = sb_.unread_data();
+
+   ASSERT_EQ(data.size(), 5u);
+   EXPECT_EQ(data.data(), data_ + 2);
+   EXPECT_EQ(std::string(data.data(), 4), std::string("iles"));
+}
+
+} // namespace util
+} // namespace scwx
@@ -79,5 +79,15 @@ TEST_F(vectorbuf_test, seekg_end)
    EXPECT_EQ(is_.fail(), false);
 }
 
+TEST_F(vectorbuf_test, unread_data)
+{
+   is_.seekg(2, std::ios_base::beg);
+
+   std::span<const char> data = vb_.unread_data();
+
+   ASSERT_EQ(data.size(), 5u);
+   EXPECT_EQ(std::string(data.data(), 4), std::string("iles"));
+}
+
 } // namespace util
 } // namespace scwx
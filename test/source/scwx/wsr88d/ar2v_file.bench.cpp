@@ -0,0 +1,172 @@
+#include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <new>
+
+#include <gtest/gtest.h>
+
+// Allocation counters, used to measure allocator pressure while loading data.
+// Allocations from every thread are counted, so the results are approximate.
+static std::atomic<std::size_t> allocationCount_ {0};
+static std::atomic<std::size_t> allocationBytes_ {0};
+
+void* operator new(std::size_t size)
+{
+   ++allocationCount_;
+   allocationBytes_ += size;
+
+   void* ptr = std::malloc(size);
+   if (ptr == nullptr)
+   {
+      throw std::bad_alloc();
+   }
+   return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+   std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /* size */) noexcept
+{
+   std::free(ptr);
+}
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static const std::string logPrefix_ = "scwx::wsr88d::ar2v_file.bench";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+struct LoadStats
+{
+   std::size_t              count_ {};
+   std::size_t              bytes_ {};
+   std::chrono::nanoseconds duration_ {};
+};
+
+static LoadStats Measure(const std::function<void()>& f)
+{
+   const std::size_t count = allocationCount_;
+   const std::size_t bytes = allocationBytes_;
+   const auto        start = std::chrono::steady_clock::now();
+
+   f();
+
+   return {allocationCount_ - count,
+           allocationBytes_ - bytes,
+           std::chrono::steady_clock::now() - start};
+}
+
+static void LogStats(const std::string& name, const LoadStats& stats)
+{
+   logger_->info(" {:<10} {:>9} allocations, {:>11} bytes, {:>8.3f} ms",
+                 name,
+                 stats.count_,
+                 stats.bytes_,
+                 std::chrono::duration<double, std::milli>(stats.duration_)
+                    .count());
+}
+
+class Ar2vFileBenchmark : public testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(Ar2vFileBenchmark, RecordStorage)
+{
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) + GetParam()};
+
+   auto load = [&](bool retainRecordBuffers, bool lazyMomentDecoding)
+   {
+      return Measure(
+         [&]()
+         {
+            Ar2vFile file;
+            file.set_retain_record_buffers(retainRecordBuffers);
+            file.set_lazy_moment_decoding(lazyMomentDecoding);
+            file.LoadFile(filename);
+         });
+   };
+
+   logger_->info("{}", GetParam());
+   LogStats("Copied", load(false, false));
+   LogStats("Retained", load(true, false));
+   LogStats("Lazy", load(false, true));
+}
+
+TEST_P(Ar2vFileBenchmark, MemoryArena)
+{
+   // Simulates loop playback, where volumes are repeatedly loaded and released
+   static constexpr std::size_t kIterations = 3;
+
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) + GetParam()};
+
+   auto loadVolumes = [&](bool useMemoryArena, bool lazyMomentDecoding)
+   {
+      return Measure(
+         [&]()
+         {
+            for (std::size_t i = 0; i < kIterations; ++i)
+            {
+               Ar2vFile file;
+               file.set_use_memory_arena(useMemoryArena);
+               file.set_lazy_moment_decoding(lazyMomentDecoding);
+               file.LoadFile(filename);
+            }
+         });
+   };
+
+   logger_->info("{}", GetParam());
+
+   for (bool lazyMomentDecoding : {false, true})
+   {
+      logger_->info(" {} moment decoding, {} volumes",
+                    lazyMomentDecoding ? "Lazy" : "Eager",
+                    kIterations);
+      LogStats("Heap", loadVolumes(false, lazyMomentDecoding));
+      LogStats("Arena", loadVolumes(true, lazyMomentDecoding));
+   }
+}
+
+TEST_P(Ar2vFileBenchmark, MappedFile)
+{
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) + GetParam()};
+
+   logger_->info("{}", GetParam());
+   LogStats("Mapped",
+            Measure(
+               [&]()
+               {
+                  Ar2vFile file;
+                  file.set_lazy_moment_decoding(true);
+                  file.LoadFile(filename);
+               }));
+   LogStats("Stream",
+            Measure(
+               [&]()
+               {
+                  Ar2vFile      file;
+                  std::ifstream f(filename,
+                                  std::ios_base::in | std::ios_base::binary);
+                  file.set_lazy_moment_decoding(true);
+                  file.LoadData(f);
+               }));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+   Ar2vFile,
+   Ar2vFileBenchmark,
+   testing::Values("/nexrad/level2/KCLE20021110_221234",
+                   "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v",
+                   "/nexrad/level2/Level2_TSTL_20220213_2357.ar2v"));
+
+} // namespace wsr88d
+} // namespace scwx
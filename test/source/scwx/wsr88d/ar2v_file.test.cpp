@@ -1,4 +1,12 @@
 #include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/util/time.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
 
 #include <gtest/gtest.h>
 
@@ -7,6 +15,55 @@ namespace scwx
 namespace wsr88d
 {
 
+static void ExpectEqualMomentData(
+   const std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>&
+      expectedData,
+   const std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>&
+      actualData)
+{
+   ASSERT_EQ(expectedData.size(), actualData.size());
+
+   for (auto& [elevation, expectedScan] : expectedData)
+   {
+      auto& actualScan = actualData.at(elevation);
+
+      ASSERT_EQ(expectedScan->size(), actualScan->size());
+
+      for (auto& [azimuth, expectedRadial] : *expectedScan)
+      {
+         auto& actualRadial = actualScan->at(azimuth);
+
+         for (rda::DataBlockType dataBlockType :
+              rda::MomentDataBlockTypeIterator())
+         {
+            auto expectedBlock =
+               expectedRadial->moment_data_block(dataBlockType);
+            auto actualBlock = actualRadial->moment_data_block(dataBlockType);
+
+            ASSERT_EQ(expectedBlock == nullptr, actualBlock == nullptr);
+
+            if (expectedBlock == nullptr)
+            {
+               continue;
+            }
+
+            const std::size_t gates =
+               expectedBlock->number_of_data_moment_gates();
+            const std::size_t dataSize =
+               gates * (expectedBlock->data_word_size() / 8u);
+
+            ASSERT_EQ(gates, actualBlock->number_of_data_moment_gates());
+            ASSERT_EQ(expectedBlock->data_word_size(),
+                      actualBlock->data_word_size());
+            EXPECT_EQ(std::memcmp(expectedBlock->data_moments(),
+                                  actualBlock->data_moments(),
+                                  dataSize),
+                      0);
+         }
+      }
+   }
+}
+
 class Ar2vValidFileTest :
     public testing::TestWithParam<std::pair<std::string, std::size_t>>
 {
@@ -24,6 +81,330 @@ TEST_P(Ar2vValidFileTest, ValidFile)
    EXPECT_EQ(file.message_count(), param.second);
 }
 
+TEST_P(Ar2vValidFileTest, RetainRecordBuffers)
+{
+   auto&             param = GetParam();
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) + param.first};
+
+   Ar2vFile copiedFile;
+   Ar2vFile retainedFile;
+   bool     copiedFileValid   = false;
+   bool     retainedFileValid = false;
+
+   retainedFile.set_retain_record_buffers(true);
+
+   copiedFileValid   = copiedFile.LoadFile(filename);
+   retainedFileValid = retainedFile.LoadFile(filename);
+
+   EXPECT_EQ(copiedFileValid, true);
+   EXPECT_EQ(retainedFileValid, true);
+   EXPECT_EQ(retainedFile.message_count(), param.second);
+
+   // Data moments must be identical regardless of storage
+   ExpectEqualMomentData(copiedFile.radar_data(), retainedFile.radar_data());
+}
+
+TEST_P(Ar2vValidFileTest, LazyMomentDecoding)
+{
+   auto&             param = GetParam();
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) + param.first};
+
+   Ar2vFile retainedFile;
+   Ar2vFile lazyFile;
+   bool     retainedFileValid = false;
+   bool     lazyFileValid     = false;
+
+   retainedFile.set_retain_record_buffers(true);
+   lazyFile.set_lazy_moment_decoding(true);
+
+   retainedFileValid = retainedFile.LoadFile(filename);
+   lazyFileValid     = lazyFile.LoadFile(filename);
+
+   EXPECT_EQ(retainedFileValid, true);
+   EXPECT_EQ(lazyFileValid, true);
+   EXPECT_EQ(lazyFile.message_count(), param.second);
+
+   // Data moments decoded on access must be identical to those decoded on load
+   ExpectEqualMomentData(retainedFile.radar_data(), lazyFile.radar_data());
+}
+
+TEST_P(Ar2vValidFileTest, MemoryArena)
+{
+   auto&             param = GetParam();
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) + param.first};
+
+   Ar2vFile heapFile;
+   Ar2vFile arenaFile;
+   heapFile.set_use_memory_arena(false);
+
+   EXPECT_EQ(heapFile.LoadFile(filename), true);
+   EXPECT_EQ(arenaFile.LoadFile(filename), true);
+   EXPECT_EQ(heapFile.memory_arena(), nullptr);
+   ASSERT_NE(arenaFile.memory_arena(), nullptr);
+   EXPECT_GT(arenaFile.memory_arena()->allocation_count(), 0u);
+
+   // Radar data must be identical regardless of allocation
+   ExpectEqualMomentData(heapFile.radar_data(), arenaFile.radar_data());
+
+   // Radar data remains valid after the file has been released, and the arena
+   // is released along with the last of its radar data
+   std::weak_ptr<const util::MemoryArena> memoryArena =
+      arenaFile.memory_arena();
+   auto radarData = arenaFile.radar_data();
+
+   arenaFile = Ar2vFile {};
+   EXPECT_EQ(memoryArena.expired(), false);
+   ExpectEqualMomentData(heapFile.radar_data(), radarData);
+
+   radarData.clear();
+   EXPECT_EQ(memoryArena.expired(), true);
+}
+
+TEST_P(Ar2vValidFileTest, ElevationScanCallback)
+{
+   auto& param = GetParam();
+
+   Ar2vFile        file;
+   std::set<float> publishedCuts {};
+   bool            scansAvailable = true;
+
+   file.SetElevationScanCallback(
+      [&](float elevationCut)
+      {
+         // The elevation scan must be available while the volume is loading
+         bool scanAvailable = false;
+
+         for (rda::DataBlockType dataBlockType :
+              rda::MomentDataBlockTypeIterator())
+         {
+            auto [elevationScan, foundCut, elevationCuts] =
+               file.GetElevationScan(dataBlockType, elevationCut, {});
+
+            if (elevationScan != nullptr && foundCut == elevationCut)
+            {
+               scanAvailable = true;
+               break;
+            }
+         }
+
+         scansAvailable &= scanAvailable;
+         publishedCuts.insert(elevationCut);
+      });
+
+   bool fileValid =
+      file.LoadFile(std::string(SCWX_TEST_DATA_DIR) + param.first);
+
+   EXPECT_EQ(fileValid, true);
+   EXPECT_EQ(scansAvailable, true);
+   EXPECT_EQ(publishedCuts.empty(), false);
+
+   // Each indexed elevation cut must have been published
+   auto [elevationScan, elevationCut, elevationCuts] =
+      file.GetElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+
+   for (float cut : elevationCuts)
+   {
+      EXPECT_EQ(publishedCuts.contains(cut), true);
+   }
+}
+
+TEST_P(Ar2vValidFileTest, RepeatedElevationScans)
+{
+   auto& param = GetParam();
+
+   Ar2vFile file;
+   bool     fileValid =
+      file.LoadFile(std::string(SCWX_TEST_DATA_DIR) + param.first);
+
+   ASSERT_EQ(fileValid, true);
+
+   auto vcpData = file.vcp_data();
+   if (vcpData == nullptr)
+   {
+      GTEST_SKIP() << "Elevation scans are not indexed by VCP data";
+   }
+
+   // Collection times of each velocity elevation scan, by elevation angle
+   std::map<std::uint16_t, std::set<std::chrono::system_clock::time_point>>
+      velocityScanTimes {};
+
+   for (auto& [elevationIndex, elevationScan] : file.radar_data())
+   {
+      auto radial0It = elevationScan->find(0);
+      ASSERT_NE(radial0It, elevationScan->cend());
+
+      auto& radial0 = radial0It->second;
+      auto  time    = util::TimePoint(radial0->modified_julian_date(),
+                                  radial0->collection_time());
+      float elevation =
+         static_cast<float>(vcpData->elevation_angle(elevationIndex));
+
+      if (radial0->moment_data_block(rda::DataBlockType::MomentVel) !=
+          nullptr)
+      {
+         velocityScanTimes[vcpData->elevation_angle_raw(elevationIndex)]
+            .insert(time);
+      }
+
+      for (rda::DataBlockType dataBlockType :
+           rda::MomentDataBlockTypeIterator())
+      {
+         if (radial0->moment_data_block(dataBlockType) == nullptr ||
+             (dataBlockType == rda::DataBlockType::MomentRef &&
+              vcpData->waveform_type(elevationIndex) ==
+                 rda::WaveformType::ContiguousDopplerWithAmbiguityResolution))
+         {
+            // Elevation scan is not indexed for this data moment
+            continue;
+         }
+
+         // Each cut is selected by its own collection time
+         auto [foundScan, foundCut, elevationCuts] =
+            file.GetElevationScan(dataBlockType, elevation, time);
+
+         EXPECT_EQ(foundScan, elevationScan);
+
+         // Each elevation cut is listed once
+         EXPECT_EQ(std::set<float>(elevationCuts.cbegin(),
+                                   elevationCuts.cend())
+                      .size(),
+                   elevationCuts.size());
+      }
+   }
+
+   // The most recent velocity cut is selected if no time is requested
+   for (auto& [elevationIndex, elevationScan] : file.radar_data())
+   {
+      auto& radial0 = elevationScan->at(0);
+      auto  time    = util::TimePoint(radial0->modified_julian_date(),
+                                  radial0->collection_time());
+
+      if (radial0->moment_data_block(rda::DataBlockType::MomentVel) !=
+             nullptr &&
+          time == *velocityScanTimes
+                      .at(vcpData->elevation_angle_raw(elevationIndex))
+                      .crbegin())
+      {
+         auto [foundScan, foundCut, elevationCuts] = file.GetElevationScan(
+            rda::DataBlockType::MomentVel,
+            static_cast<float>(vcpData->elevation_angle(elevationIndex)),
+            {});
+
+         EXPECT_EQ(foundScan, elevationScan);
+      }
+   }
+}
+
+TEST_P(Ar2vValidFileTest, FlatElevationScan)
+{
+   auto& param = GetParam();
+
+   Ar2vFile file;
+   bool     fileValid =
+      file.LoadFile(std::string(SCWX_TEST_DATA_DIR) + param.first);
+
+   ASSERT_EQ(fileValid, true);
+
+   std::chrono::system_clock::time_point endTime {};
+
+   for (auto& [elevationIndex, elevationScan] : file.radar_data())
+   {
+      rda::FlatElevationScan flatScan {elevationScan};
+
+      ASSERT_EQ(flatScan.radial_count(), elevationScan->crbegin()->first + 1u);
+
+      // Radial headers are indexed by azimuth number - 1
+      for (auto& [azimuthIndex, radial] : *elevationScan)
+      {
+         auto& header = flatScan.radials()[azimuthIndex];
+
+         EXPECT_EQ(header.valid_, true);
+         EXPECT_EQ(header.azimuthNumber_, radial->azimuth_number());
+         EXPECT_EQ(header.azimuthAngle_, radial->azimuth_angle().value());
+         EXPECT_EQ(header.collectionTime_, radial->collection_time());
+
+         endTime = std::max(endTime,
+                            util::TimePoint(radial->modified_julian_date(),
+                                            radial->collection_time()));
+      }
+
+      // Each row of the moment matrix holds the data moments of one radial
+      for (rda::DataBlockType dataBlockType :
+           rda::MomentDataBlockTypeIterator())
+      {
+         auto momentData = flatScan.moment_data(dataBlockType);
+
+         if (elevationScan->cbegin()->second->moment_data_block(
+                dataBlockType) == nullptr)
+         {
+            EXPECT_EQ(momentData, nullptr);
+            continue;
+         }
+
+         ASSERT_NE(momentData, nullptr);
+         EXPECT_EQ(flatScan.moment_data(dataBlockType), momentData);
+
+         const std::size_t wordSize = momentData->data_word_size() / 8u;
+
+         for (auto& [azimuthIndex, radial] : *elevationScan)
+         {
+            auto  momentDataBlock = radial->moment_data_block(dataBlockType);
+            auto& info            = momentData->radials()[azimuthIndex];
+
+            ASSERT_NE(momentDataBlock, nullptr);
+            ASSERT_EQ(info.numberOfDataMomentGates_,
+                      momentDataBlock->number_of_data_moment_gates());
+            EXPECT_LE(info.numberOfDataMomentGates_, momentData->gates());
+            EXPECT_EQ(std::memcmp(momentData->data_moments(azimuthIndex),
+                                  momentDataBlock->data_moments(),
+                                  info.numberOfDataMomentGates_ * wordSize),
+                      0);
+         }
+      }
+   }
+
+   // The end time is tracked as elevation scans are published
+   EXPECT_EQ(file.end_time(), endTime);
+
+   // The flat elevation scan wraps the elevation scan found
+   auto [elevationScan, elevationCut, elevationCuts] =
+      file.GetElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+   auto [flatScan, flatCut, flatCuts] =
+      file.GetFlatElevationScan(rda::DataBlockType::MomentRef, 0.5f, {});
+
+   ASSERT_NE(flatScan, nullptr);
+   EXPECT_EQ(flatScan->elevation_scan(), elevationScan);
+   EXPECT_EQ(flatCut, elevationCut);
+   EXPECT_EQ(flatCuts, elevationCuts);
+}
+
+TEST_P(Ar2vValidFileTest, MappedFile)
+{
+   auto&             param = GetParam();
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) + param.first};
+
+   // LoadFile decodes from a memory mapped file
+   Ar2vFile mappedFile;
+   Ar2vFile streamFile;
+   bool     mappedFileValid = false;
+   bool     streamFileValid = false;
+
+   mappedFile.set_lazy_moment_decoding(true);
+   streamFile.set_lazy_moment_decoding(true);
+
+   mappedFileValid = mappedFile.LoadFile(filename);
+
+   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+   streamFileValid = streamFile.LoadData(f);
+
+   EXPECT_EQ(mappedFileValid, true);
+   EXPECT_EQ(streamFileValid, true);
+   EXPECT_EQ(mappedFile.message_count(), streamFile.message_count());
+
+   // Radar data must be identical regardless of how the file was read
+   ExpectEqualMomentData(streamFile.radar_data(), mappedFile.radar_data());
+}
+
 INSTANTIATE_TEST_SUITE_P(
    Ar2vFile,
    Ar2vValidFileTest,
@@ -0,0 +1,115 @@
+#include <scwx/wsr88d/derived_products.hpp>
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static const std::string logPrefix_ = "scwx::wsr88d::derived_products.test";
+
+TEST(DerivedProducts, Level2V06)
+{
+   std::string filename = std::string(SCWX_TEST_DATA_DIR) +
+                          "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+   Ar2vFile file;
+   bool     fileValid = file.LoadFile(filename);
+
+   ASSERT_EQ(fileValid, true);
+
+   VolumeIndex     index {file, rda::DataBlockType::MomentRef};
+   DerivedProducts products {index};
+
+   ASSERT_GT(index.cut_count(), 0u);
+   EXPECT_EQ(products.elevation_scan(), index.elevation_scan(0u));
+   EXPECT_EQ(products.radial_count(), products.azimuths().size());
+
+   const std::size_t bins = products.radial_count() * products.gates();
+
+   auto compositeReflectivity =
+      products.levels(common::Level2Product::CompositeReflectivity);
+   auto echoTops = products.levels(common::Level2Product::EchoTops);
+   auto vil =
+      products.levels(common::Level2Product::VerticallyIntegratedLiquid);
+
+   ASSERT_EQ(compositeReflectivity.size(), bins);
+   ASSERT_EQ(echoTops.size(), bins);
+   ASSERT_EQ(vil.size(), bins);
+   EXPECT_TRUE(products.levels(common::Level2Product::Velocity).empty());
+
+   // Composite reflectivity is encoded as reflectivity
+   EXPECT_EQ(products.scale(common::Level2Product::CompositeReflectivity),
+             index.scale());
+   EXPECT_EQ(products.offset(common::Level2Product::CompositeReflectivity),
+             index.offset());
+
+   const float echoTopsThreshold =
+      DerivedProducts::kEchoTopsThreshold_ * index.scale() + index.offset();
+
+   for (std::size_t bin = 0; bin < bins; ++bin)
+   {
+      // Echo tops and VIL are only present where there is an echo
+      if (compositeReflectivity[bin] == 0u)
+      {
+         EXPECT_EQ(echoTops[bin], 0u);
+         EXPECT_EQ(vil[bin], 0u);
+      }
+
+      // Echo tops are only present where the threshold is met
+      EXPECT_EQ(echoTops[bin] != 0u,
+                compositeReflectivity[bin] >= echoTopsThreshold);
+   }
+
+   // Composite reflectivity is the maximum of each cut
+   const double distance =
+      products.first_gate_range() + products.gate_interval() * 100.0;
+
+   const auto        azimuths = products.azimuths();
+   const std::size_t radials  = azimuths.size();
+
+   for (std::size_t radial = 0; radial < radials; radial += 10)
+   {
+      // Products are sampled at the center of each radial
+      double endAngle = azimuths[(radial + 1) % radials];
+      if (endAngle < azimuths[radial])
+      {
+         endAngle += 360.0;
+      }
+      const double azimuth = (azimuths[radial] + endAngle) * 0.5;
+
+      std::uint16_t maxLevel = 0u;
+      for (std::size_t cut = 0; cut < index.cut_count(); ++cut)
+      {
+         maxLevel = std::max(
+            maxLevel, index.GetBinLevel(cut, azimuth, distance).value_or(0u));
+      }
+
+      if (maxLevel == 1u)
+      {
+         // Range folded
+         continue;
+      }
+
+      EXPECT_EQ(compositeReflectivity[radial * products.gates() + 100u],
+                maxLevel);
+   }
+}
+
+TEST(DerivedProducts, DerivedProduct)
+{
+   EXPECT_TRUE(DerivedProducts::IsDerivedProduct(
+      common::Level2Product::CompositeReflectivity));
+   EXPECT_TRUE(
+      DerivedProducts::IsDerivedProduct(common::Level2Product::EchoTops));
+   EXPECT_TRUE(DerivedProducts::IsDerivedProduct(
+      common::Level2Product::VerticallyIntegratedLiquid));
+   EXPECT_FALSE(
+      DerivedProducts::IsDerivedProduct(common::Level2Product::Reflectivity));
+}
+
+} // namespace wsr88d
+} // namespace scwx
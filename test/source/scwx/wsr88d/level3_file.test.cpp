@@ -1,4 +1,7 @@
 #include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/wsr88d/rpg/graphic_product_message.hpp>
+
+#include <fstream>
 
 #include <gtest/gtest.h>
 
@@ -29,6 +32,111 @@ TEST_P(Level3ValidFileTest, ValidFile)
    EXPECT_EQ(message->header().message_code(), param.first);
 }
 
+TEST_P(Level3ValidFileTest, StreamFallback)
+{
+   Level3File mappedFile;
+   Level3File streamFile;
+
+   auto param = GetParam();
+
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) +
+                               "/nexrad/level3/" + param.second};
+
+   // LoadFile inflates compressed products in a single pass from memory,
+   // while products read from a file stream are inflated through the stream
+   std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
+
+   bool mappedFileValid = mappedFile.LoadFile(filename);
+   bool streamFileValid = streamFile.LoadData(f);
+
+   EXPECT_EQ(mappedFileValid, true);
+   EXPECT_EQ(streamFileValid, true);
+   ASSERT_NE(mappedFile.message(), nullptr);
+   ASSERT_NE(streamFile.message(), nullptr);
+   EXPECT_EQ(mappedFile.message()->header().message_code(),
+             streamFile.message()->header().message_code());
+   EXPECT_EQ(mappedFile.message()->data_size(),
+             streamFile.message()->data_size());
+}
+
+TEST_P(Level3ValidFileTest, LazyPacketDecoding)
+{
+   Level3File file;
+
+   auto param = GetParam();
+
+   file.LoadFile(std::string(SCWX_TEST_DATA_DIR) + "/nexrad/level3/" +
+                 param.second);
+
+   auto message = std::dynamic_pointer_cast<rpg::GraphicProductMessage>(
+      file.message());
+
+   if (message == nullptr || message->symbology_block() == nullptr)
+   {
+      GTEST_SKIP() << "No product symbology block";
+   }
+
+   auto symbologyBlock = message->symbology_block();
+
+   for (std::uint16_t layer = 0; layer < symbologyBlock->number_of_layers();
+        ++layer)
+   {
+      const std::size_t packetCount = symbologyBlock->packet_count(layer);
+
+      for (std::size_t i = 0; i < packetCount; ++i)
+      {
+         // Packets recorded during parsing decode on first access
+         auto packet = symbologyBlock->packet(layer, i);
+
+         ASSERT_NE(packet, nullptr);
+         EXPECT_EQ(packet->packet_code(),
+                   symbologyBlock->packet_code(layer, i));
+
+         // Decoded packets are retained
+         EXPECT_EQ(symbologyBlock->packet(layer, i), packet);
+      }
+
+      EXPECT_EQ(symbologyBlock->packet_list(layer).size(), packetCount);
+   }
+}
+
+TEST_P(Level3ValidFileTest, PacketIndex)
+{
+   Level3File file;
+
+   auto param = GetParam();
+
+   file.LoadFile(std::string(SCWX_TEST_DATA_DIR) + "/nexrad/level3/" +
+                 param.second);
+
+   auto message = std::dynamic_pointer_cast<rpg::GraphicProductMessage>(
+      file.message());
+
+   if (message == nullptr)
+   {
+      GTEST_SKIP() << "Not a graphic product message";
+   }
+
+   const rpg::PacketIndex& packetIndex = message->packet_index();
+
+   auto packets = message->FindPackets<rpg::Packet>();
+
+   // Every packet in the index is a packet
+   EXPECT_EQ(packets.size(), packetIndex.size());
+
+   // Subsequent searches return the same packets
+   EXPECT_EQ(message->FindPackets<rpg::Packet>().data(), packets.data());
+
+   for (auto& packet : packets)
+   {
+      const auto packetCode =
+         static_cast<rpg::PacketCode>(packet->packet_code());
+
+      EXPECT_EQ(packetIndex.FindPacketsByCode({packetCode}).size(),
+                packetIndex.packet_count(packetCode));
+   }
+}
+
 INSTANTIATE_TEST_SUITE_P(
    Level3File,
    Level3ValidFileTest,
@@ -0,0 +1,105 @@
+#include <scwx/wsr88d/volume_index.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static const std::string logPrefix_ = "scwx::wsr88d::volume_index.test";
+
+static constexpr double kDegreesToRadians_ = std::numbers::pi / 180.0;
+
+TEST(VolumeIndex, BeamGeometry)
+{
+   // A horizontal beam rises above the curvature of the earth
+   EXPECT_NEAR(VolumeIndex::BeamHeight(0.0, 0.5), 0.0, 1e-6);
+   EXPECT_NEAR(VolumeIndex::BeamHeight(100000.0, 0.0), 588.6, 0.1);
+   EXPECT_NEAR(VolumeIndex::BeamHeight(100000.0, 0.5), 1461.1, 0.1);
+
+   // A vertical beam rises by its range, directly above the radar
+   EXPECT_NEAR(VolumeIndex::BeamHeight(10000.0, 90.0), 10000.0, 1e-6);
+   EXPECT_NEAR(VolumeIndex::BeamDistance(10000.0, 90.0), 0.0, 1e-6);
+
+   // The distance beneath a low beam is slightly less than its range
+   const double distance = VolumeIndex::BeamDistance(100000.0, 0.5);
+   EXPECT_LT(distance, 100000.0);
+   EXPECT_GT(distance, 99950.0);
+}
+
+TEST(VolumeIndex, Level2V06)
+{
+   std::string filename = std::string(SCWX_TEST_DATA_DIR) +
+                          "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v";
+
+   Ar2vFile file;
+   bool     fileValid = file.LoadFile(filename);
+
+   ASSERT_EQ(fileValid, true);
+
+   VolumeIndex index {file, rda::DataBlockType::MomentRef};
+
+   ASSERT_GT(index.cut_count(), 1u);
+   EXPECT_EQ(index.elevation_cuts().size(), index.cut_count());
+   EXPECT_TRUE(std::is_sorted(index.elevation_cuts().begin(),
+                              index.elevation_cuts().end()));
+
+   // Each cut is the flat elevation scan of its elevation
+   for (std::size_t cut = 0; cut < index.cut_count(); ++cut)
+   {
+      auto [flatScan, elevationCut, elevationCuts] = file.GetFlatElevationScan(
+         rda::DataBlockType::MomentRef, index.elevation_cuts()[cut], {});
+
+      EXPECT_EQ(index.elevation_scan(cut), flatScan);
+   }
+
+   // Sample a cross-section beneath a single point
+   constexpr double kAzimuth  = 225.0;
+   constexpr double kDistance = 60000.0;
+
+   const VolumeIndex::PolarCoordinate point {kAzimuth, kDistance};
+
+   std::vector<double> heights {};
+   for (std::size_t cut = 0; cut < index.cut_count(); ++cut)
+   {
+      // Sample at the center of each beam
+      const float  elevation = index.elevation_cuts()[cut];
+      const double range =
+         kDistance / std::cos(elevation * kDegreesToRadians_);
+      heights.push_back(VolumeIndex::BeamHeight(range, elevation));
+   }
+
+   std::vector<std::uint16_t> levels =
+      index.SampleCrossSection({&point, 1u}, heights);
+
+   ASSERT_EQ(levels.size(), heights.size());
+
+   for (std::size_t cut = 0; cut < index.cut_count(); ++cut)
+   {
+      EXPECT_EQ(levels[cut],
+                index.GetBinLevel(cut, kAzimuth, kDistance).value_or(0u));
+   }
+
+   // Heights beyond the highest beam are not covered
+   const double ceiling = heights.back() + 10000.0;
+   levels = index.SampleCrossSection({&point, 1u}, {&ceiling, 1u});
+
+   ASSERT_EQ(levels.size(), 1u);
+   EXPECT_EQ(levels[0], 0u);
+
+   // Points beyond the range of every cut are not sampled
+   const VolumeIndex::PolarCoordinate farPoint {kAzimuth, 1000000.0};
+   levels = index.SampleCrossSection({&farPoint, 1u}, heights);
+
+   EXPECT_TRUE(std::all_of(levels.cbegin(),
+                           levels.cend(),
+                           [](std::uint16_t level) { return level == 0u; }));
+}
+
+} // namespace wsr88d
+} // namespace scwx
@@ -14,29 +14,42 @@ set(SRC_AWIPS_TESTS source/scwx/awips/coded_location.test.cpp
                     source/scwx/awips/text_product_file.test.cpp
                     source/scwx/awips/ugc.test.cpp)
 set(SRC_COMMON_TESTS source/scwx/common/color_table.test.cpp
+                     source/scwx/common/mosaic_grid.test.cpp
                      source/scwx/common/products.test.cpp)
 set(SRC_GR_TESTS source/scwx/gr/placefile.test.cpp)
 set(SRC_NETWORK_TESTS source/scwx/network/dir_list.test.cpp)
 set(SRC_PROVIDER_TESTS source/scwx/provider/aws_level2_data_provider.test.cpp
                        source/scwx/provider/aws_level3_data_provider.test.cpp
+                       source/scwx/provider/level2_chunks_data_provider.test.cpp
                        source/scwx/provider/warnings_provider.test.cpp)
 set(SRC_QT_CONFIG_TESTS source/scwx/qt/config/county_database.test.cpp
                         source/scwx/qt/config/radar_site.test.cpp)
-set(SRC_QT_MANAGER_TESTS source/scwx/qt/manager/settings_manager.test.cpp
+set(SRC_QT_MANAGER_TESTS source/scwx/qt/manager/radar_product_manager.test.cpp
+                         source/scwx/qt/manager/settings_manager.test.cpp
                          source/scwx/qt/manager/update_manager.test.cpp)
 set(SRC_QT_MAP_TESTS source/scwx/qt/map/map_provider.test.cpp)
 set(SRC_QT_MODEL_TESTS source/scwx/qt/model/imgui_context_model.test.cpp)
 set(SRC_QT_SETTINGS_TESTS source/scwx/qt/settings/settings_container.test.cpp
                           source/scwx/qt/settings/settings_variable.test.cpp)
-set(SRC_QT_UTIL_TESTS source/scwx/qt/util/q_file_input_stream.test.cpp)
-set(SRC_UTIL_TESTS source/scwx/util/float.test.cpp
+set(SRC_QT_UTIL_TESTS source/scwx/qt/util/geographic_lib.test.cpp
+                      source/scwx/qt/util/q_file_input_stream.test.cpp)
+set(SRC_UTIL_TESTS source/scwx/util/azimuth_lookup.test.cpp
+                   source/scwx/util/big_endian_reader.test.cpp
+                   source/scwx/util/float.test.cpp
+                   source/scwx/util/inflate.test.cpp
+                   source/scwx/util/mapped_file.test.cpp
+                   source/scwx/util/memory_arena.test.cpp
                    source/scwx/util/rangebuf.test.cpp
+                   source/scwx/util/run_length.test.cpp
+                   source/scwx/util/spanbuf.test.cpp
                    source/scwx/util/streams.test.cpp
                    source/scwx/util/strings.test.cpp
                    source/scwx/util/vectorbuf.test.cpp)
 set(SRC_WSR88D_TESTS source/scwx/wsr88d/ar2v_file.test.cpp
+                     source/scwx/wsr88d/derived_products.test.cpp
                      source/scwx/wsr88d/level3_file.test.cpp
-                     source/scwx/wsr88d/nexrad_file_factory.test.cpp)
+                     source/scwx/wsr88d/nexrad_file_factory.test.cpp
+                     source/scwx/wsr88d/volume_index.test.cpp)
 
 set(CMAKE_FILES test.cmake)
 
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace scwx
+{
+namespace common
+{
+
+/**
+ * @brief Rule used to combine the data levels of radar sites covering the same
+ * cell of a mosaic.
+ */
+enum class MosaicRule
+{
+   NearestRadar, ///< Level of the nearest site with data loaded
+   MaximumValue  ///< Maximum level of all sites with data loaded
+};
+
+/**
+ * @brief A latitude/longitude grid shared by several radar sites. Each site
+ * contributes data levels to the cells within its range, and cells covered by
+ * more than one site are combined using a mosaic rule. When a site is updated,
+ * only the cells covered by that site are recombined.
+ *
+ * Coverage and distances are calculated on a spherical earth, which is
+ * sufficient to order sites by distance, and to determine coverage to within a
+ * fraction of a cell.
+ */
+class MosaicGrid
+{
+public:
+   static constexpr double kDefaultResolution_ = 0.01; // Degrees
+
+   /**
+    * @brief Creates a grid covering the range of each radar site.
+    *
+    * @param [in] sites Location of each radar site
+    * @param [in] range Range of each radar site in meters
+    * @param [in] resolution Size of each cell in degrees of latitude and
+    * longitude
+    * @param [in] rule Rule used to combine sites covering the same cell
+    */
+   explicit MosaicGrid(std::span<const Coordinate> sites,
+                       double                      range,
+                       double     resolution = kDefaultResolution_,
+                       MosaicRule rule       = MosaicRule::NearestRadar);
+   ~MosaicGrid();
+
+   MosaicGrid(const MosaicGrid&)            = delete;
+   MosaicGrid& operator=(const MosaicGrid&) = delete;
+
+   MosaicGrid(MosaicGrid&&) noexcept;
+   MosaicGrid& operator=(MosaicGrid&&) noexcept;
+
+   std::size_t rows() const;
+   std::size_t columns() const;
+   double      resolution() const;
+   MosaicRule  rule() const;
+   std::size_t site_count() const;
+
+   /**
+    * @brief Gets the number of cells covered by at least one radar site. Only
+    * covered cells are stored, in row-major order from the southwest corner of
+    * the grid.
+    */
+   std::size_t cell_count() const;
+
+   /**
+    * @brief Gets the center of a covered cell.
+    *
+    * @param [in] cell Covered cell index
+    *
+    * @return Cell center
+    */
+   Coordinate cell_center(std::size_t cell) const;
+
+   /**
+    * @brief Gets the cells within range of a radar site.
+    *
+    * @param [in] site Site index
+    *
+    * @return Covered cell indices, in ascending order
+    */
+   std::span<const std::uint32_t> site_cells(std::size_t site) const;
+
+   /**
+    * @brief Gets the combined data level of each covered cell, where a level of
+    * 0 has no data.
+    */
+   std::span<const std::uint16_t> levels() const;
+
+   /**
+    * @brief Finds the covered cell containing a coordinate.
+    *
+    * @param [in] coordinate Coordinate
+    *
+    * @return Covered cell index, or std::nullopt if the coordinate is not
+    * covered by any radar site
+    */
+   std::optional<std::size_t> FindCell(const Coordinate& coordinate) const;
+
+   /**
+    * @brief Gets the vertices of each covered cell, as two triangles of
+    * latitude and longitude pairs.
+    *
+    * @return Vertices, with 6 vertices (12 values) per covered cell
+    */
+   std::vector<float> GetVertices() const;
+
+   /**
+    * @brief Replaces the data levels of a radar site, and recombines the cells
+    * covered by the site. Data levels of all sites must share the same
+    * encoding. For the maximum value rule, a greater level must represent a
+    * greater value.
+    *
+    * @param [in] site Site index
+    * @param [in] levels Data level of each cell within range of the site, in
+    * the order given by site_cells(). A level of 0 has no data.
+    */
+   void UpdateSite(std::size_t site, std::span<const std::uint16_t> levels);
+
+   /**
+    * @brief Removes the data levels of a radar site, and recombines the cells
+    * covered by the site.
+    *
+    * @param [in] site Site index
+    */
+   void ClearSite(std::size_t site);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace common
+} // namespace scwx
@@ -31,11 +31,14 @@ enum class Level2Product
    DifferentialPhase,
    CorrelationCoefficient,
    ClutterFilterPowerRemoved,
+   CompositeReflectivity,
+   EchoTops,
+   VerticallyIntegratedLiquid,
    Unknown
 };
 typedef util::Iterator<Level2Product,
                        Level2Product::Reflectivity,
-                       Level2Product::ClutterFilterPowerRemoved>
+                       Level2Product::VerticallyIntegratedLiquid>
    Level2ProductIterator;
 
 enum class Level3ProductCategory
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <scwx/provider/level2_chunks_data_provider.hpp>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief AWS Level 2 Chunks Data Provider
+ *
+ * Reads the real-time Level 2 chunk feed from an S3 bucket.
+ */
+class AwsLevel2ChunksDataProvider : public Level2ChunksDataProvider
+{
+public:
+   explicit AwsLevel2ChunksDataProvider(const std::string& radarSite);
+   explicit AwsLevel2ChunksDataProvider(const std::string& radarSite,
+                                        const std::string& bucketName,
+                                        const std::string& region);
+   ~AwsLevel2ChunksDataProvider();
+
+   AwsLevel2ChunksDataProvider(const AwsLevel2ChunksDataProvider&) = delete;
+   AwsLevel2ChunksDataProvider&
+   operator=(const AwsLevel2ChunksDataProvider&) = delete;
+
+   AwsLevel2ChunksDataProvider(AwsLevel2ChunksDataProvider&&) noexcept;
+   AwsLevel2ChunksDataProvider&
+   operator=(AwsLevel2ChunksDataProvider&&) noexcept;
+
+protected:
+   std::vector<std::string> ListPrefixes(const std::string& prefix) override;
+   std::vector<ObjectInfo>  ListChunks(const std::string& prefix,
+                                       std::size_t        maxKeys) override;
+   std::shared_ptr<std::istream> GetChunk(const std::string& key) override;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace provider
+} // namespace scwx
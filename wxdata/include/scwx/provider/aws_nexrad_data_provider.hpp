@@ -43,8 +43,10 @@ public:
    GetTimePointsByDate(std::chrono::system_clock::time_point date) override;
    std::tuple<bool, size_t, size_t>
    ListObjects(std::chrono::system_clock::time_point date) override;
-   std::shared_ptr<wsr88d::NexradFile>
-                             LoadObjectByKey(const std::string& key) override;
+   std::shared_ptr<wsr88d::NexradFile> LoadObjectByKey(
+      const std::string&                                key,
+      const wsr88d::NexradFileFactory::PreloadFunction& preload =
+         nullptr) override;
    std::pair<size_t, size_t> Refresh() override;
 
 protected:
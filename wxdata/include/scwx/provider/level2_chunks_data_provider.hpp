@@ -0,0 +1,147 @@
+#pragma once
+
+#include <scwx/provider/nexrad_data_provider.hpp>
+
+#include <istream>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief Level 2 Chunks Data Provider
+ *
+ * Ingests the real-time Level 2 chunk feed. Each volume in progress is stored
+ * under its own volume number, as a start chunk, followed by intermediate
+ * chunks and an end chunk:
+ *
+ *   SITE/VVV/YYYYMMDD-HHMMSS-CCC-T
+ *
+ * where VVV is the volume number (1-999), CCC is the chunk number, and T is
+ * the chunk type (S, I or E). Chunks are appended to a growing Archive II file
+ * as they become available. Each volume is represented by a single key, and
+ * each elevation scan completed during a refresh is counted as a new object.
+ */
+class Level2ChunksDataProvider : public NexradDataProvider
+{
+public:
+   explicit Level2ChunksDataProvider(const std::string& radarSite);
+   virtual ~Level2ChunksDataProvider();
+
+   Level2ChunksDataProvider(const Level2ChunksDataProvider&) = delete;
+   Level2ChunksDataProvider&
+   operator=(const Level2ChunksDataProvider&) = delete;
+
+   Level2ChunksDataProvider(Level2ChunksDataProvider&&) noexcept;
+   Level2ChunksDataProvider& operator=(Level2ChunksDataProvider&&) noexcept;
+
+   size_t cache_size() const override;
+
+   /**
+    * Gets the last modified time. This is equal to the most recent chunk's
+    * modification time. If no chunks have been loaded, the epoch is returned.
+    *
+    * @return Last modified time
+    */
+   std::chrono::system_clock::time_point last_modified() const override;
+
+   /**
+    * Gets the current update period. This is equal to the difference between
+    * the last two chunks' modification times. If less than two chunks have
+    * been loaded, an update period of 0 is returned.
+    *
+    * @return Update period
+    */
+   std::chrono::seconds update_period() const override;
+
+   std::string FindKey(std::chrono::system_clock::time_point time) override;
+   std::string FindLatestKey() override;
+   std::vector<std::chrono::system_clock::time_point>
+   GetTimePointsByDate(std::chrono::system_clock::time_point date) override;
+   std::tuple<bool, size_t, size_t>
+   ListObjects(std::chrono::system_clock::time_point date) override;
+
+   /**
+    * Loads a volume by the given key. If the volume is in progress, the
+    * growing file is returned, and the preload function is not called.
+    *
+    * @param key NEXRAD data key
+    * @param preload Function called with the NEXRAD file prior to loading its
+    * data
+    *
+    * @return NEXRAD data
+    */
+   std::shared_ptr<wsr88d::NexradFile> LoadObjectByKey(
+      const std::string&                                key,
+      const wsr88d::NexradFileFactory::PreloadFunction& preload =
+         nullptr) override;
+
+   /**
+    * Loads any new chunks of the volume in progress, and continues with
+    * subsequent volumes once the end chunk has been loaded.
+    *
+    * @return - Elevation scans completed
+    *         - Total volumes in the cache
+    */
+   std::pair<size_t, size_t> Refresh() override;
+
+   /**
+    * Takes the elevation scans completed since they were last taken, in the
+    * order they were completed. Scans completed by consecutive refreshes
+    * accumulate until taken, so none are missed by a concurrent refresh.
+    *
+    * @return Volume key and elevation cut of each elevation scan
+    */
+   std::vector<std::pair<std::string, float>> TakeCompletedElevationScans();
+
+   std::chrono::system_clock::time_point
+   GetTimePointByKey(const std::string& key) const override;
+
+   static std::chrono::system_clock::time_point
+   GetTimePointFromKey(const std::string& key);
+
+protected:
+   struct ObjectInfo
+   {
+      std::string                           key_ {};
+      std::chrono::system_clock::time_point lastModified_ {};
+   };
+
+   /**
+    * Lists the prefixes immediately below the prefix supplied.
+    *
+    * @param prefix Object prefix, ending with a separator
+    *
+    * @return Child prefixes, each ending with a separator
+    */
+   virtual std::vector<std::string> ListPrefixes(const std::string& prefix) = 0;
+
+   /**
+    * Lists the objects immediately below the prefix supplied, in ascending key
+    * order.
+    *
+    * @param prefix Object prefix, ending with a separator
+    * @param maxKeys Maximum number of objects to list, or 0 for no limit
+    *
+    * @return Objects found
+    */
+   virtual std::vector<ObjectInfo> ListChunks(const std::string& prefix,
+                                              std::size_t        maxKeys) = 0;
+
+   /**
+    * Gets the contents of an object.
+    *
+    * @param key Object key
+    *
+    * @return Object contents, or nullptr if the object could not be read
+    */
+   virtual std::shared_ptr<std::istream> GetChunk(const std::string& key) = 0;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace provider
+} // namespace scwx
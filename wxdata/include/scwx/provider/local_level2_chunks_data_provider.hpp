@@ -0,0 +1,43 @@
+#pragma once
+
+#include <scwx/provider/level2_chunks_data_provider.hpp>
+
+namespace scwx
+{
+namespace provider
+{
+
+/**
+ * @brief Local Level 2 Chunks Data Provider
+ *
+ * Reads the real-time Level 2 chunk feed from a local directory, which follows
+ * the same layout as the chunk feed bucket.
+ */
+class LocalLevel2ChunksDataProvider : public Level2ChunksDataProvider
+{
+public:
+   explicit LocalLevel2ChunksDataProvider(const std::string& radarSite,
+                                          const std::string& directory);
+   ~LocalLevel2ChunksDataProvider();
+
+   LocalLevel2ChunksDataProvider(const LocalLevel2ChunksDataProvider&) = delete;
+   LocalLevel2ChunksDataProvider&
+   operator=(const LocalLevel2ChunksDataProvider&) = delete;
+
+   LocalLevel2ChunksDataProvider(LocalLevel2ChunksDataProvider&&) noexcept;
+   LocalLevel2ChunksDataProvider&
+   operator=(LocalLevel2ChunksDataProvider&&) noexcept;
+
+protected:
+   std::vector<std::string> ListPrefixes(const std::string& prefix) override;
+   std::vector<ObjectInfo>  ListChunks(const std::string& prefix,
+                                       std::size_t        maxKeys) override;
+   std::shared_ptr<std::istream> GetChunk(const std::string& key) override;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace provider
+} // namespace scwx
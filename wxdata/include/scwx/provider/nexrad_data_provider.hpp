@@ -1,6 +1,6 @@
 #pragma once
 
-#include <scwx/wsr88d/nexrad_file.hpp>
+#include <scwx/wsr88d/nexrad_file_factory.hpp>
 
 #include <chrono>
 #include <memory>
@@ -75,11 +75,14 @@ public:
     * Loads a NEXRAD file object by the given key.
     *
     * @param key NEXRAD data key
+    * @param preload Function called with the NEXRAD file prior to loading its
+    * data
     *
     * @return NEXRAD data
     */
-   virtual std::shared_ptr<wsr88d::NexradFile>
-   LoadObjectByKey(const std::string& key) = 0;
+   virtual std::shared_ptr<wsr88d::NexradFile> LoadObjectByKey(
+      const std::string&                                key,
+      const wsr88d::NexradFileFactory::PreloadFunction& preload = nullptr) = 0;
 
    /**
     * Lists NEXRAD objects for the current date, and adds them to the cache. If
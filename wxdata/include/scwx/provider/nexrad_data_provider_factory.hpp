@@ -27,6 +27,19 @@ public:
    static std::shared_ptr<NexradDataProvider>
    CreateLevel2DataProvider(const std::string& radarSite);
 
+   /**
+    * @brief Creates a provider for the real-time Level 2 chunk feed.
+    *
+    * @param [in] radarSite Radar site
+    * @param [in] directory Local directory containing the chunk feed. If
+    * empty, chunks are read from the default AWS bucket.
+    *
+    * @return Level 2 chunks data provider
+    */
+   static std::shared_ptr<NexradDataProvider>
+   CreateLevel2ChunksDataProvider(const std::string& radarSite,
+                                  const std::string& directory = {});
+
    static std::shared_ptr<NexradDataProvider>
    CreateLevel3DataProvider(const std::string& radarSite,
                             const std::string& product);
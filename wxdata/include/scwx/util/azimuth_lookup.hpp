@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief A lookup table from azimuth to the radial containing it. The circle is
+ * divided into cells of a fixed angular resolution, and each cell holds the
+ * radial containing the start of the cell, so finding a radial takes constant
+ * time.
+ *
+ * A radial spans from its start angle to the start angle of the following
+ * radial, and the last radial is followed by the first radial. If the start
+ * angles do not increase around the circle, the radials may overlap, and are
+ * found by scanning each radial in order.
+ */
+class AzimuthLookup
+{
+public:
+   static constexpr float kDefaultResolution_ = 0.1f;
+
+   /**
+    * @brief Creates an azimuth lookup table.
+    *
+    * @param [in] startAngles Start angle of each radial in degrees, in radial
+    * order
+    * @param [in] resolution Angular resolution of the table in degrees. Radials
+    * narrower than the resolution are found by stepping through the radials
+    * starting within a cell.
+    */
+   explicit AzimuthLookup(
+      std::span<const float> startAngles,
+      float                  resolution = kDefaultResolution_);
+   ~AzimuthLookup();
+
+   AzimuthLookup(const AzimuthLookup&)            = delete;
+   AzimuthLookup& operator=(const AzimuthLookup&) = delete;
+
+   AzimuthLookup(AzimuthLookup&&) noexcept;
+   AzimuthLookup& operator=(AzimuthLookup&&) noexcept;
+
+   /**
+    * @brief Gets the number of radials in the table.
+    */
+   std::size_t radial_count() const;
+
+   /**
+    * @brief Finds the radial containing an azimuth.
+    *
+    * @param [in] azimuth Azimuth in degrees. Azimuths outside of [0, 360) are
+    * wrapped.
+    *
+    * @return Radial index, or std::nullopt if no radial contains the azimuth
+    */
+   std::optional<std::size_t> FindRadial(double azimuth) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <type_traits>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Reads big-endian (network byte order) binary data from a contiguous
+ * span of bytes. All reads are bounds-checked. A read past the end of the span
+ * does not consume any data, and sets a failure state which persists for all
+ * subsequent reads, so a group of fields may be read before checking fail().
+ *
+ * The reader does not own the underlying data, which must remain valid while
+ * the reader is in use.
+ */
+class BigEndianReader
+{
+public:
+   explicit BigEndianReader(std::span<const char> data) noexcept :
+       data_ {data}
+   {
+   }
+   explicit BigEndianReader(const char* data, std::size_t size) noexcept :
+       data_ {data, size}
+   {
+   }
+   ~BigEndianReader() = default;
+
+   BigEndianReader(const BigEndianReader&)            = default;
+   BigEndianReader& operator=(const BigEndianReader&) = default;
+
+   BigEndianReader(BigEndianReader&&) noexcept            = default;
+   BigEndianReader& operator=(BigEndianReader&&) noexcept = default;
+
+   /**
+    * @brief Gets a pointer to the beginning of the data.
+    */
+   const char* data() const noexcept { return data_.data(); }
+
+   /**
+    * @brief Gets a pointer to the data at the current position.
+    */
+   const char* current() const noexcept { return data_.data() + position_; }
+
+   std::size_t size() const noexcept { return data_.size(); }
+   std::size_t position() const noexcept { return position_; }
+   std::size_t remaining() const noexcept { return data_.size() - position_; }
+
+   /**
+    * @brief Gets whether a read, seek or skip has failed.
+    */
+   bool fail() const noexcept { return fail_; }
+
+   /**
+    * @brief Sets the current position, relative to the beginning of the data.
+    *
+    * @param [in] position New position
+    *
+    * @return Whether the position is within the data
+    */
+   bool Seek(std::size_t position) noexcept
+   {
+      if (position > data_.size())
+      {
+         fail_ = true;
+         return false;
+      }
+
+      position_ = position;
+      return true;
+   }
+
+   /**
+    * @brief Advances the current position without reading data.
+    *
+    * @param [in] count Number of bytes to skip
+    *
+    * @return Whether the bytes were skipped
+    */
+   bool Skip(std::size_t count) noexcept
+   {
+      if (!Require(count))
+      {
+         return false;
+      }
+
+      position_ += count;
+      return true;
+   }
+
+   /**
+    * @brief Reads an integral or floating point value.
+    *
+    * @return Value read, or a value-initialized value if the read failed
+    */
+   template<class T>
+   T Read() noexcept
+   {
+      T value {};
+      Read(value);
+      return value;
+   }
+
+   /**
+    * @brief Reads an integral or floating point value.
+    *
+    * @param [out] value Value read. Unmodified if the read failed.
+    *
+    * @return Whether the value was read
+    */
+   template<class T>
+   bool Read(T& value) noexcept
+   {
+      if (!Require(sizeof(T)))
+      {
+         return false;
+      }
+
+      value = Decode<T>(current());
+      position_ += sizeof(T);
+      return true;
+   }
+
+   /**
+    * @brief Reads an array of integral or floating point values.
+    *
+    * @param [out] values Destination of the values read
+    * @param [in] count Number of values to read
+    *
+    * @return Whether the values were read
+    */
+   template<class T>
+   bool ReadArray(T* values, std::size_t count) noexcept
+   {
+      if (count > remaining() / sizeof(T) || !Require(count * sizeof(T)))
+      {
+         fail_ = true;
+         return false;
+      }
+
+      const char* bytes = current();
+      for (std::size_t i = 0; i < count; ++i, bytes += sizeof(T))
+      {
+         values[i] = Decode<T>(bytes);
+      }
+
+      position_ += count * sizeof(T);
+      return true;
+   }
+
+   template<class T, std::size_t N>
+   bool ReadArray(std::array<T, N>& values) noexcept
+   {
+      return ReadArray(values.data(), N);
+   }
+
+   /**
+    * @brief Reads bytes without byte swapping.
+    *
+    * @param [out] destination Destination of the bytes read
+    * @param [in] count Number of bytes to read
+    *
+    * @return Whether the bytes were read
+    */
+   bool ReadBytes(void* destination, std::size_t count) noexcept
+   {
+      if (!Require(count))
+      {
+         return false;
+      }
+
+      if (count > 0)
+      {
+         std::memcpy(destination, current(), count);
+      }
+
+      position_ += count;
+      return true;
+   }
+
+   /**
+    * @brief Reads a span of bytes which references the underlying data, in
+    * lieu of copying it.
+    *
+    * @param [in] count Number of bytes to read
+    *
+    * @return Span of bytes, or an empty span if the read failed
+    */
+   std::span<const char> ReadSpan(std::size_t count) noexcept
+   {
+      if (!Require(count))
+      {
+         return {};
+      }
+
+      std::span<const char> span = data_.subspan(position_, count);
+      position_ += count;
+      return span;
+   }
+
+   /**
+    * @brief Reads a fixed-length string.
+    *
+    * @param [in] count Number of characters to read
+    *
+    * @return String, or an empty string if the read failed
+    */
+   std::string ReadString(std::size_t count)
+   {
+      std::span<const char> span = ReadSpan(count);
+      return std::string(span.begin(), span.end());
+   }
+
+   /**
+    * @brief Decodes a big-endian value from unaligned bytes.
+    *
+    * @param [in] bytes Bytes to decode, at least sizeof(T) in length
+    *
+    * @return Decoded value
+    */
+   template<class T>
+   static T Decode(const char* bytes) noexcept
+   {
+      static_assert(std::is_arithmetic_v<T>,
+                    "Only integral and floating point types may be decoded");
+
+      if constexpr (std::is_floating_point_v<T>)
+      {
+         static_assert(sizeof(T) == 4 || sizeof(T) == 8,
+                       "Unsupported floating point type");
+
+         using U = std::conditional_t<sizeof(T) == 4, std::uint32_t,
+                                      std::uint64_t>;
+         return std::bit_cast<T>(Decode<U>(bytes));
+      }
+      else
+      {
+         using U = std::make_unsigned_t<T>;
+
+         U value = 0;
+         for (std::size_t i = 0; i < sizeof(T); ++i)
+         {
+            value = static_cast<U>((static_cast<std::uint64_t>(value) << 8) |
+                                   static_cast<std::uint8_t>(bytes[i]));
+         }
+
+         return static_cast<T>(value);
+      }
+   }
+
+private:
+   bool Require(std::size_t count) noexcept
+   {
+      if (fail_ || count > remaining())
+      {
+         fail_ = true;
+         return false;
+      }
+
+      return true;
+   }
+
+   std::span<const char> data_;
+   std::size_t           position_ {0};
+   bool                  fail_ {false};
+};
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace scwx
+{
+namespace util
+{
+
+enum class InflateFormat
+{
+   Zlib,
+   Gzip
+};
+
+/**
+ * @brief Inflates zlib or gzip compressed data into a contiguous buffer in a
+ * single pass. The buffer is preallocated from the gzip trailer, or estimated
+ * from the compressed size, and grows geometrically if needed. Consecutive
+ * compressed members (e.g., the multiple zlib streams contained in many Level 3
+ * products) are inflated into the same buffer.
+ *
+ * @param [in] input Compressed data
+ * @param [in] format Compression format
+ * @param [out] output Decompressed data
+ *
+ * @return Number of compressed bytes consumed, or std::nullopt if the data
+ * could not be inflated
+ */
+std::optional<std::size_t> Inflate(std::span<const char> input,
+                                   InflateFormat         format,
+                                   std::vector<char>&    output);
+
+} // namespace util
+} // namespace scwx
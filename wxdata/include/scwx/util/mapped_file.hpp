@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <span>
+#include <string>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief A read-only memory mapped file. File contents are paged in as they are
+ * accessed, and may be decoded directly from the mapped memory without being
+ * copied through a stream.
+ */
+class MappedFile
+{
+public:
+   /**
+    * @brief Maps a file into memory. If the file could not be mapped (e.g., it
+    * does not exist, or is empty), the mapped file is not open, and the caller
+    * may fall back to reading the file through a stream.
+    *
+    * @param [in] filename Filename to map
+    */
+   explicit MappedFile(const std::string& filename);
+   ~MappedFile();
+
+   MappedFile(const MappedFile&)            = delete;
+   MappedFile& operator=(const MappedFile&) = delete;
+
+   MappedFile(MappedFile&&) noexcept;
+   MappedFile& operator=(MappedFile&&) noexcept;
+
+   bool is_open() const;
+
+   /**
+    * @brief Gets the contents of the mapped file. The data remains valid while
+    * the mapped file is open.
+    *
+    * @return File contents, or an empty span if the mapped file is not open
+    */
+   std::span<const char> data() const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace scwx
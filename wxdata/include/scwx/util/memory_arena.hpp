@@ -0,0 +1,198 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief A thread-safe, monotonic memory arena. Deallocation is a no-op, and
+ * all memory allocated from the arena is released at once when the arena is
+ * destroyed.
+ */
+class MemoryArena : public std::pmr::memory_resource
+{
+public:
+   /**
+    * @brief Creates a memory arena.
+    *
+    * @param [in] initialSize Size of the first block of memory allocated by
+    * the arena. Subsequent blocks grow geometrically.
+    */
+   explicit MemoryArena(std::size_t initialSize = 64 * 1024);
+   ~MemoryArena();
+
+   MemoryArena(const MemoryArena&)            = delete;
+   MemoryArena& operator=(const MemoryArena&) = delete;
+
+   MemoryArena(MemoryArena&&)            = delete;
+   MemoryArena& operator=(MemoryArena&&) = delete;
+
+   /**
+    * @brief Gets the number of allocations made from the arena.
+    *
+    * @return Allocation count
+    */
+   std::size_t allocation_count() const;
+
+   /**
+    * @brief Gets the number of bytes allocated from the arena.
+    *
+    * @return Bytes allocated
+    */
+   std::size_t bytes_allocated() const;
+
+private:
+   void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+   void  do_deallocate(void*       p,
+                       std::size_t bytes,
+                       std::size_t alignment) override;
+   bool
+   do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+/**
+ * @brief Allocator which allocates from a shared memory arena. Each copy of
+ * the allocator keeps the arena alive, so objects created with
+ * std::allocate_shared remain valid after the owner of the arena has released
+ * it. If no arena is provided, the default memory resource is used.
+ */
+template<class T>
+class ArenaAllocator
+{
+public:
+   typedef T value_type;
+
+   ArenaAllocator(std::shared_ptr<MemoryArena> arena = nullptr) noexcept :
+       arena_ {std::move(arena)}
+   {
+   }
+
+   template<class U>
+   ArenaAllocator(const ArenaAllocator<U>& other) noexcept :
+       arena_ {other.arena()}
+   {
+   }
+
+   T* allocate(std::size_t n)
+   {
+      return static_cast<T*>(resource()->allocate(n * sizeof(T), alignof(T)));
+   }
+
+   void deallocate(T* p, std::size_t n) noexcept
+   {
+      resource()->deallocate(p, n * sizeof(T), alignof(T));
+   }
+
+   const std::shared_ptr<MemoryArena>& arena() const noexcept
+   {
+      return arena_;
+   }
+
+   std::pmr::memory_resource* resource() const noexcept
+   {
+      return (arena_ != nullptr) ? arena_.get() :
+                                   std::pmr::get_default_resource();
+   }
+
+   template<class U>
+   bool operator==(const ArenaAllocator<U>& other) const noexcept
+   {
+      return resource() == other.resource();
+   }
+
+private:
+   std::shared_ptr<MemoryArena> arena_;
+};
+
+/**
+ * @brief Deleter for objects allocated from a memory resource with
+ * MakeArenaUnique. The memory resource must outlive the object.
+ */
+template<class T>
+class ArenaDeleter
+{
+public:
+   ArenaDeleter(std::pmr::memory_resource* resource = nullptr) noexcept :
+       resource_ {resource}
+   {
+   }
+
+   void operator()(T* p) const
+   {
+      p->~T();
+      resource_->deallocate(p, sizeof(T), alignof(T));
+   }
+
+private:
+   std::pmr::memory_resource* resource_;
+};
+
+template<class T>
+using ArenaUniquePtr = std::unique_ptr<T, ArenaDeleter<T>>;
+
+/**
+ * @brief Creates an object allocated from a memory resource. If no memory
+ * resource is provided, the default memory resource is used.
+ *
+ * @param [in] resource Memory resource
+ * @param [in] args Constructor arguments
+ *
+ * @return Unique pointer to the object
+ */
+template<class T, class... Args>
+ArenaUniquePtr<T> MakeArenaUnique(std::pmr::memory_resource* resource,
+                                  Args&&... args)
+{
+   if (resource == nullptr)
+   {
+      resource = std::pmr::get_default_resource();
+   }
+
+   void* storage = resource->allocate(sizeof(T), alignof(T));
+
+   try
+   {
+      return ArenaUniquePtr<T>(new (storage) T(std::forward<Args>(args)...),
+                               ArenaDeleter<T>(resource));
+   }
+   catch (...)
+   {
+      resource->deallocate(storage, sizeof(T), alignof(T));
+      throw;
+   }
+}
+
+/**
+ * @brief Creates a shared object allocated from a memory arena, along with its
+ * control block. If no arena is provided, the default memory resource is used.
+ *
+ * @param [in] arena Memory arena
+ * @param [in] args Constructor arguments
+ *
+ * @return Shared pointer to the object
+ */
+template<class T, class... Args>
+std::shared_ptr<T> MakeArenaShared(const std::shared_ptr<MemoryArena>& arena,
+                                   Args&&... args)
+{
+   if (arena == nullptr)
+   {
+      return std::make_shared<T>(std::forward<Args>(args)...);
+   }
+
+   return std::allocate_shared<T>(ArenaAllocator<T>(arena),
+                                  std::forward<Args>(args)...);
+}
+
+} // namespace util
+} // namespace scwx
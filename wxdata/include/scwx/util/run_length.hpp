@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief Gets the number of bins encoded by 4-bit run-length encoded data. Each
+ * byte of the data holds a run in its upper nibble, and a level in its lower
+ * nibble.
+ *
+ * @param [in] data Run-length encoded data
+ *
+ * @return Number of bins
+ */
+std::size_t GetRunLengthBinCount(std::span<const std::uint8_t> data);
+
+/**
+ * @brief Decodes 4-bit run-length encoded data into a contiguous array of
+ * levels. Each byte of the data holds a run in its upper nibble, and a level in
+ * its lower nibble. Runs are written with fixed-width block stores while the
+ * level array has room, so each run costs a single store regardless of its
+ * length.
+ *
+ * @param [in] data Run-length encoded data
+ * @param [out] levels Decoded levels. Bins beyond the size of the level array
+ * are discarded, and levels following the decoded bins are set to 0.
+ *
+ * @return Number of bins decoded
+ */
+std::size_t DecodeRunLength(std::span<const std::uint8_t> data,
+                            std::span<std::uint8_t>       levels);
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <span>
+#include <streambuf>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief A read-only stream buffer over a contiguous span of bytes, such as a
+ * memory mapped file. The stream buffer does not own the underlying data, which
+ * must remain valid while the stream buffer is in use.
+ */
+class spanbuf : public std::streambuf
+{
+public:
+   explicit spanbuf(std::span<const char> data);
+   ~spanbuf() = default;
+
+   spanbuf(const spanbuf&)            = delete;
+   spanbuf& operator=(const spanbuf&) = delete;
+
+   /**
+    * @brief Gets the data which has not yet been read from the buffer. The data
+    * may be decoded directly from memory, in lieu of being read through a
+    * stream.
+    *
+    * @return Data from the current read position to the end of the buffer
+    */
+   std::span<const char> unread_data() const;
+
+protected:
+   pos_type seekoff(std::streamoff          off,
+                    std::ios_base::seekdir  way,
+                    std::ios_base::openmode which = std::ios_base::in) override;
+   pos_type seekpos(pos_type                pos,
+                    std::ios_base::openmode which = std::ios_base::in) override;
+};
+
+} // namespace util
+} // namespace scwx
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <istream>
+#include <optional>
+#include <span>
 
 namespace scwx
 {
@@ -9,5 +11,16 @@ namespace util
 
 std::istream& getline(std::istream& is, std::string& t);
 
+/**
+ * @brief Gets the unread data of an input stream which reads from memory (a
+ * spanbuf or vectorbuf), so the data may be decoded in place.
+ *
+ * @param [in] is Input stream
+ *
+ * @return Data from the current read position to the end of the stream, or
+ * std::nullopt if the stream does not read from memory
+ */
+std::optional<std::span<const char>> GetUnreadData(std::istream& is);
+
 } // namespace util
 } // namespace scwx
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <streambuf>
 #include <vector>
 
@@ -19,6 +20,15 @@ public:
 
    void update_read_pointers(size_t size);
 
+   /**
+    * @brief Gets the data which has not yet been read from the buffer. The data
+    * may be decoded directly from memory, in lieu of being read through a
+    * stream.
+    *
+    * @return Data from the current read position to the end of the buffer
+    */
+   std::span<const char> unread_data() const;
+
 protected:
    pos_type
    seekoff(std::streamoff          off,
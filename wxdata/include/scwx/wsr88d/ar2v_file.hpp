@@ -1,10 +1,13 @@
 #pragma once
 
 #include <scwx/wsr88d/nexrad_file.hpp>
+#include <scwx/wsr88d/rda/flat_elevation_scan.hpp>
 #include <scwx/wsr88d/rda/generic_radar_data.hpp>
 #include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
+#include <scwx/util/memory_arena.hpp>
 
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -23,6 +26,9 @@ class Ar2vFileImpl;
 class Ar2vFile : public NexradFile
 {
 public:
+   typedef std::function<void(float elevationCut)>
+      ElevationScanCallbackFunction;
+
    explicit Ar2vFile();
    ~Ar2vFile();
 
@@ -37,6 +43,17 @@ public:
    std::string   icao() const;
 
    std::size_t message_count() const;
+   bool        retain_record_buffers() const;
+   bool        lazy_moment_decoding() const;
+   bool        use_memory_arena() const;
+
+   /**
+    * @brief Gets the memory arena radar data is allocated from.
+    *
+    * @return Memory arena, or nullptr if radar data is not allocated from an
+    * arena
+    */
+   std::shared_ptr<const util::MemoryArena> memory_arena() const;
 
    std::chrono::system_clock::time_point start_time() const;
    std::chrono::system_clock::time_point end_time() const;
@@ -45,14 +62,104 @@ public:
                                                          radar_data() const;
    std::shared_ptr<const rda::VolumeCoveragePatternData> vcp_data() const;
 
+   /**
+    * @brief Gets the elevation scan nearest the requested elevation. Repeated
+    * cuts of the same elevation (e.g., SAILS, MESO-SAILS) are indexed by
+    * their collection time, and the cut collected nearest the requested time
+    * is returned. If no time is requested, the most recent cut is returned.
+    *
+    * @param [in] dataBlockType Data moment
+    * @param [in] elevation Elevation angle in degrees
+    * @param [in] time Collection time
+    *
+    * @return - Elevation scan, or nullptr if none was found
+    *         - Elevation cut of the elevation scan
+    *         - Available elevation cuts, each listed once
+    */
    std::tuple<std::shared_ptr<rda::ElevationScan>, float, std::vector<float>>
    GetElevationScan(rda::DataBlockType                    dataBlockType,
                     float                                 elevation,
                     std::chrono::system_clock::time_point time) const;
 
+   /**
+    * @brief Gets the flat representation of the elevation scan nearest the
+    * requested elevation and time. Radial headers and data moments are stored
+    * contiguously, for linear access while generating sweeps and sampling
+    * bins.
+    *
+    * @param [in] dataBlockType Data moment
+    * @param [in] elevation Elevation angle in degrees
+    * @param [in] time Collection time
+    *
+    * @return - Flat elevation scan, or nullptr if none was found
+    *         - Elevation cut of the elevation scan
+    *         - Available elevation cuts, each listed once
+    */
+   std::tuple<std::shared_ptr<rda::FlatElevationScan>,
+              float,
+              std::vector<float>>
+   GetFlatElevationScan(rda::DataBlockType                    dataBlockType,
+                        float                                 elevation,
+                        std::chrono::system_clock::time_point time) const;
+
+   /**
+    * @brief Retain decompressed LDM record buffers after loading. Data moments
+    * reference the retained buffers directly, rather than being copied into
+    * their own storage. Must be set prior to loading data.
+    *
+    * @param [in] retainRecordBuffers Whether to retain record buffers
+    */
+   void set_retain_record_buffers(bool retainRecordBuffers);
+
+   /**
+    * @brief Defer decoding of data moments until they are first accessed.
+    * Loading only records the location of each data moment block, so load
+    * time and memory use scale with the data moments that are actually used.
+    * Implies retaining decompressed LDM record buffers. Must be set prior to
+    * loading data.
+    *
+    * @param [in] lazyMomentDecoding Whether to decode data moments on access
+    */
+   void set_lazy_moment_decoding(bool lazyMomentDecoding);
+
+   /**
+    * @brief Allocate radar data from a memory arena owned by the volume, in
+    * lieu of allocating each radial and data block individually. The arena is
+    * released at once, after both the file and all of its radar data have been
+    * released. Enabled by default. Must be set prior to loading data.
+    *
+    * @param [in] useMemoryArena Whether to allocate radar data from an arena
+    */
+   void set_use_memory_arena(bool useMemoryArena);
+
+   /**
+    * @brief Sets a function to be called each time an elevation scan has been
+    * loaded. Elevation scans are available from GetElevationScan as soon as
+    * their last radial has been parsed, while the remainder of the volume
+    * continues to load. The function is called from the loading thread. Must
+    * be set prior to loading data.
+    *
+    * @param [in] callback Function called with the loaded elevation cut
+    */
+   void SetElevationScanCallback(ElevationScanCallbackFunction callback);
+
    bool LoadFile(const std::string& filename);
    bool LoadData(std::istream& is);
 
+   /**
+    * @brief Loads a chunk of a volume in progress, and appends its data to the
+    * file. The start chunk of a volume begins with the Volume Header Record,
+    * and subsequent chunks contain only LDM records. Chunks must be loaded in
+    * order. Elevation scans are published as their final radial is loaded, and
+    * any elevation scans in progress are published with the final chunk.
+    *
+    * @param [in] is Input stream
+    * @param [in] finalChunk Whether this is the final chunk of the volume
+    *
+    * @return Whether the chunk is valid
+    */
+   bool LoadChunk(std::istream& is, bool finalChunk);
+
 private:
    std::unique_ptr<Ar2vFileImpl> p;
 };
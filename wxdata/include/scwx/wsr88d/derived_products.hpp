@@ -0,0 +1,100 @@
+#pragma once
+
+#include <scwx/common/products.hpp>
+#include <scwx/wsr88d/volume_index.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+/**
+ * @brief Products derived from every elevation cut of a Level 2 reflectivity
+ * volume: composite reflectivity, echo tops and vertically integrated liquid.
+ * Products are computed on the polar grid of the lowest cut, in parallel
+ * across radials.
+ *
+ * Each product is stored as 8-bit data levels, where a level of 0 has no data.
+ * Levels are converted to values by (level - offset) / scale:
+ *    - Composite reflectivity: dBZ, encoded as Level 2 reflectivity
+ *    - Echo tops: thousands of feet above mean sea level, or above the radar if
+ *      the height of the radar is not given
+ *    - Vertically integrated liquid: kg/m^2
+ */
+class DerivedProducts
+{
+public:
+   static constexpr float kEchoTopsThreshold_  = 18.0f; // dBZ
+   static constexpr float kVilMaxReflectivity_ = 56.0f; // dBZ
+
+   /**
+    * @brief Computes derived products from a reflectivity volume.
+    *
+    * @param [in] volumeIndex Reflectivity volume index
+    * @param [in] radarHeight Height of the radar above mean sea level in
+    * meters, added to echo tops
+    */
+   explicit DerivedProducts(const VolumeIndex& volumeIndex,
+                            float              radarHeight = 0.0f);
+   ~DerivedProducts();
+
+   DerivedProducts(const DerivedProducts&)            = delete;
+   DerivedProducts& operator=(const DerivedProducts&) = delete;
+
+   DerivedProducts(DerivedProducts&&) noexcept;
+   DerivedProducts& operator=(DerivedProducts&&) noexcept;
+
+   /**
+    * @brief Gets the lowest cut of the volume, whose polar grid the products
+    * are computed on.
+    *
+    * @return Flat elevation scan, or nullptr if the volume has no cuts
+    */
+   std::shared_ptr<const rda::FlatElevationScan> elevation_scan() const;
+
+   /**
+    * @brief Gets the start angle of each radial of the grid, in degrees.
+    */
+   std::span<const float> azimuths() const;
+
+   std::size_t radial_count() const;
+   std::size_t gates() const;
+   double      first_gate_range() const; // Meters
+   double      gate_interval() const;    // Meters
+
+   /**
+    * @brief Gets the data levels of a derived product.
+    *
+    * @param [in] product Composite reflectivity, echo tops or vertically
+    * integrated liquid
+    *
+    * @return Data levels, stored in radial-major order with a stride of gates()
+    * levels, or an empty span if the product is not derived
+    */
+   std::span<const std::uint8_t> levels(common::Level2Product product) const;
+
+   float scale(common::Level2Product product) const;
+   float offset(common::Level2Product product) const;
+
+   /**
+    * @brief Determines if a Level 2 product is derived from the volume, rather
+    * than read from a single elevation cut.
+    *
+    * @param [in] product Level 2 product
+    *
+    * @return true if the product is derived
+    */
+   static bool IsDerivedProduct(common::Level2Product product);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace wsr88d
+} // namespace scwx
@@ -2,6 +2,8 @@
 
 #include <scwx/wsr88d/nexrad_file.hpp>
 
+#include <functional>
+
 namespace scwx
 {
 namespace wsr88d
@@ -20,8 +22,18 @@ private:
    NexradFileFactory& operator=(NexradFileFactory&&) noexcept = delete;
 
 public:
-   static std::shared_ptr<NexradFile> Create(const std::string& filename);
-   static std::shared_ptr<NexradFile> Create(std::istream& is);
+   /**
+    * @brief Function called with a newly created NEXRAD file, prior to loading
+    * its data. Allows the caller to configure the file, or to begin using a
+    * file which becomes available progressively while loading.
+    */
+   typedef std::function<void(const std::shared_ptr<NexradFile>& nexradFile)>
+      PreloadFunction;
+
+   static std::shared_ptr<NexradFile>
+   Create(const std::string& filename, const PreloadFunction& preload = nullptr);
+   static std::shared_ptr<NexradFile>
+   Create(std::istream& is, const PreloadFunction& preload = nullptr);
 };
 
 } // namespace wsr88d
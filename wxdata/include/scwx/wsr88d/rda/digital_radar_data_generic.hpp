@@ -1,6 +1,10 @@
 #pragma once
 
 #include <scwx/wsr88d/rda/generic_radar_data.hpp>
+#include <scwx/util/big_endian_reader.hpp>
+#include <scwx/util/memory_arena.hpp>
+
+#include <vector>
 
 namespace scwx
 {
@@ -18,7 +22,8 @@ public:
    class RadialDataBlock;
    class VolumeDataBlock;
 
-   explicit DigitalRadarDataGeneric();
+   explicit DigitalRadarDataGeneric(
+      std::shared_ptr<util::MemoryArena> arena = nullptr);
    ~DigitalRadarDataGeneric();
 
    DigitalRadarDataGeneric(const DigitalRadarDataGeneric&)            = delete;
@@ -35,7 +40,7 @@ public:
    std::uint8_t          compression_indicator() const;
    std::uint16_t         radial_length() const;
    std::uint8_t          azimuth_resolution_spacing() const;
-   std::uint8_t          radial_status() const;
+   std::uint16_t         radial_status() const;
    std::uint16_t         elevation_number() const;
    std::uint8_t          cut_sector_number() const;
    units::degrees<float> elevation_angle() const;
@@ -52,19 +57,40 @@ public:
 
    bool Parse(std::istream& is);
 
+   /**
+    * @brief Creates a Digital Radar Data Generic (Message Type 31) message.
+    *
+    * @param [in] header Message header
+    * @param [in] is Input stream
+    * @param [in] recordBuffer Optional record buffer the input stream reads
+    * from. If provided, data moments reference the record buffer in lieu of
+    * being copied.
+    * @param [in] lazyMomentDecoding If a record buffer is provided, only the
+    * location of each data moment block is recorded during parsing. The block
+    * is decoded the first time it is requested from moment_data_block().
+    * @param [in] arena Optional memory arena. If provided, the message and its
+    * data blocks are allocated from the arena.
+    *
+    * @return Parsed message, or nullptr if the message is invalid
+    */
    static std::shared_ptr<DigitalRadarDataGeneric>
-   Create(Level2MessageHeader&& header, std::istream& is);
+   Create(Level2MessageHeader&&              header,
+          std::istream&                      is,
+          std::shared_ptr<std::vector<char>> recordBuffer       = nullptr,
+          bool                               lazyMomentDecoding = false,
+          std::shared_ptr<util::MemoryArena> arena              = nullptr);
 
 private:
    class Impl;
-   std::unique_ptr<Impl> p;
+   util::ArenaUniquePtr<Impl> p;
 };
 
 class DigitalRadarDataGeneric::DataBlock
 {
 protected:
-   explicit DataBlock(const std::string& dataBlockType,
-                      const std::string& dataName);
+   explicit DataBlock(const std::string&         dataBlockType,
+                      const std::string&         dataName,
+                      std::pmr::memory_resource* resource = nullptr);
    virtual ~DataBlock();
 
    DataBlock(const DataBlock&)            = delete;
@@ -75,14 +101,15 @@ protected:
 
 private:
    class Impl;
-   std::unique_ptr<Impl> p;
+   util::ArenaUniquePtr<Impl> p;
 };
 
 class DigitalRadarDataGeneric::ElevationDataBlock : public DataBlock
 {
 public:
-   explicit ElevationDataBlock(const std::string& dataBlockType,
-                               const std::string& dataName);
+   explicit ElevationDataBlock(const std::string&         dataBlockType,
+                               const std::string&         dataName,
+                               std::pmr::memory_resource* resource = nullptr);
    ~ElevationDataBlock();
 
    ElevationDataBlock(const ElevationDataBlock&)            = delete;
@@ -92,15 +119,16 @@ public:
    ElevationDataBlock& operator=(ElevationDataBlock&&) noexcept;
 
    static std::shared_ptr<ElevationDataBlock>
-   Create(const std::string& dataBlockType,
-          const std::string& dataName,
-          std::istream&      is);
+   Create(const std::string&                 dataBlockType,
+          const std::string&                 dataName,
+          util::BigEndianReader&             reader,
+          std::shared_ptr<util::MemoryArena> arena = nullptr);
 
 private:
    class Impl;
-   std::unique_ptr<Impl> p;
+   util::ArenaUniquePtr<Impl> p;
 
-   bool Parse(std::istream& is);
+   bool Parse(util::BigEndianReader& reader);
 };
 
 class DigitalRadarDataGeneric::MomentDataBlock :
@@ -108,8 +136,9 @@ class DigitalRadarDataGeneric::MomentDataBlock :
     public GenericRadarData::MomentDataBlock
 {
 public:
-   explicit MomentDataBlock(const std::string& dataBlockType,
-                            const std::string& dataName);
+   explicit MomentDataBlock(const std::string&         dataBlockType,
+                            const std::string&         dataName,
+                            std::pmr::memory_resource* resource = nullptr);
    ~MomentDataBlock();
 
    MomentDataBlock(const MomentDataBlock&)            = delete;
@@ -131,22 +160,25 @@ public:
    const void*              data_moments() const;
 
    static std::shared_ptr<MomentDataBlock>
-   Create(const std::string& dataBlockType,
-          const std::string& dataName,
-          std::istream&      is);
+   Create(const std::string&                 dataBlockType,
+          const std::string&                 dataName,
+          util::BigEndianReader&             reader,
+          std::shared_ptr<std::vector<char>> recordBuffer = nullptr,
+          std::shared_ptr<util::MemoryArena> arena        = nullptr);
 
 private:
    class Impl;
-   std::unique_ptr<Impl> p;
+   util::ArenaUniquePtr<Impl> p;
 
-   bool Parse(std::istream& is);
+   bool Parse(util::BigEndianReader& reader);
 };
 
 class DigitalRadarDataGeneric::RadialDataBlock : public DataBlock
 {
 public:
-   explicit RadialDataBlock(const std::string& dataBlockType,
-                            const std::string& dataName);
+   explicit RadialDataBlock(const std::string&         dataBlockType,
+                            const std::string&         dataName,
+                            std::pmr::memory_resource* resource = nullptr);
    ~RadialDataBlock();
 
    RadialDataBlock(const RadialDataBlock&)            = delete;
@@ -158,22 +190,24 @@ public:
    float unambiguous_range() const;
 
    static std::shared_ptr<RadialDataBlock>
-   Create(const std::string& dataBlockType,
-          const std::string& dataName,
-          std::istream&      is);
+   Create(const std::string&                 dataBlockType,
+          const std::string&                 dataName,
+          util::BigEndianReader&             reader,
+          std::shared_ptr<util::MemoryArena> arena = nullptr);
 
 private:
    class Impl;
-   std::unique_ptr<Impl> p;
+   util::ArenaUniquePtr<Impl> p;
 
-   bool Parse(std::istream& is);
+   bool Parse(util::BigEndianReader& reader);
 };
 
 class DigitalRadarDataGeneric::VolumeDataBlock : public DataBlock
 {
 public:
-   explicit VolumeDataBlock(const std::string& dataBlockType,
-                            const std::string& dataName);
+   explicit VolumeDataBlock(const std::string&         dataBlockType,
+                            const std::string&         dataName,
+                            std::pmr::memory_resource* resource = nullptr);
    ~VolumeDataBlock();
 
    VolumeDataBlock(const VolumeDataBlock&)            = delete;
@@ -187,15 +221,16 @@ public:
    std::uint16_t volume_coverage_pattern_number() const;
 
    static std::shared_ptr<VolumeDataBlock>
-   Create(const std::string& dataBlockType,
-          const std::string& dataName,
-          std::istream&      is);
+   Create(const std::string&                 dataBlockType,
+          const std::string&                 dataName,
+          util::BigEndianReader&             reader,
+          std::shared_ptr<util::MemoryArena> arena = nullptr);
 
 private:
    class Impl;
-   std::unique_ptr<Impl> p;
+   util::ArenaUniquePtr<Impl> p;
 
-   bool Parse(std::istream& is);
+   bool Parse(util::BigEndianReader& reader);
 };
 
 } // namespace rda
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <scwx/wsr88d/rda/generic_radar_data.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+/**
+ * @brief A flat, contiguous representation of an elevation scan. Radial
+ * headers are stored in a single array indexed by azimuth number, and the data
+ * moments of each data block type are stored in a single radial by gate
+ * matrix. Moment matrices are built the first time they are requested.
+ *
+ * The elevation scan must not be modified after the flat elevation scan has
+ * been created.
+ */
+class FlatElevationScan
+{
+public:
+   class MomentData;
+
+   struct RadialHeader
+   {
+      float         azimuthAngle_ {0.0f}; // Degrees
+      std::uint32_t collectionTime_ {0};
+      std::uint16_t modifiedJulianDate_ {0};
+      std::uint16_t azimuthNumber_ {0};
+      std::uint16_t radialStatus_ {0};
+      bool          valid_ {false};
+   };
+
+   explicit FlatElevationScan(std::shared_ptr<ElevationScan> elevationScan);
+   ~FlatElevationScan();
+
+   FlatElevationScan(const FlatElevationScan&)            = delete;
+   FlatElevationScan& operator=(const FlatElevationScan&) = delete;
+
+   FlatElevationScan(FlatElevationScan&&)            = delete;
+   FlatElevationScan& operator=(FlatElevationScan&&) = delete;
+
+   std::shared_ptr<ElevationScan> elevation_scan() const;
+
+   /**
+    * @brief Gets the radial headers, where the radial header at index i
+    * corresponds to azimuth number i + 1. Missing radials are not valid.
+    *
+    * @return Radial headers
+    */
+   std::span<const RadialHeader> radials() const;
+   std::size_t                   radial_count() const;
+
+   std::chrono::system_clock::time_point start_time() const;
+   std::chrono::system_clock::time_point end_time() const;
+   std::uint16_t                         volume_coverage_pattern_number() const;
+
+   /**
+    * @brief Gets the data moments of a data block type. The moment matrix is
+    * built on first access, and shared by subsequent requests.
+    *
+    * @param [in] type Data block type
+    *
+    * @return Data moments, or nullptr if the first radial does not contain the
+    * data block type
+    */
+   std::shared_ptr<const MomentData> moment_data(DataBlockType type) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+/**
+ * @brief Data moments of a single data block type within an elevation scan,
+ * stored in a radial by gate matrix. Each row of the matrix holds the data
+ * moments of one radial, and has a fixed stride of gates() data moments.
+ */
+class FlatElevationScan::MomentData
+{
+public:
+   struct RadialInfo
+   {
+      std::int16_t  dataMomentRange_ {0};               // Meters
+      std::uint16_t dataMomentRangeSampleInterval_ {0}; // Meters
+      std::uint16_t numberOfDataMomentGates_ {0};
+   };
+
+   explicit MomentData(const ElevationScan& elevationScan,
+                       std::size_t          radialCount,
+                       DataBlockType        type);
+   ~MomentData();
+
+   MomentData(const MomentData&)            = delete;
+   MomentData& operator=(const MomentData&) = delete;
+
+   MomentData(MomentData&&) noexcept;
+   MomentData& operator=(MomentData&&) noexcept;
+
+   DataBlockType            data_block_type() const;
+   std::uint16_t            gates() const;
+   units::kilometers<float> data_moment_range() const;
+   units::kilometers<float> data_moment_range_sample_interval() const;
+   std::int16_t             snr_threshold_raw() const;
+   std::uint8_t             data_word_size() const;
+   float                    scale() const;
+   float                    offset() const;
+
+   /**
+    * @brief Gets the gate parameters of each radial. Radials which are
+    * missing, or whose data word size differs from the first radial, have no
+    * data moment gates.
+    *
+    * @return Radial gate parameters, indexed by radial
+    */
+   std::span<const RadialInfo> radials() const;
+
+   /**
+    * @brief Gets the data moments of a radial. Data moments are 8-bit or
+    * 16-bit, depending on the data word size.
+    *
+    * @param [in] radial Radial index
+    *
+    * @return Pointer to the first data moment of the radial
+    */
+   const void* data_moments(std::size_t radial) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -55,6 +55,7 @@ public:
    virtual units::degrees<float> azimuth_angle() const                  = 0;
    virtual std::uint16_t         azimuth_number() const                 = 0;
    virtual std::uint16_t         elevation_number() const               = 0;
+   virtual std::uint16_t         radial_status() const                  = 0;
    virtual std::uint16_t         volume_coverage_pattern_number() const = 0;
 
    virtual std::shared_ptr<MomentDataBlock>
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <scwx/wsr88d/rda/level2_message.hpp>
+#include <scwx/util/memory_arena.hpp>
+
+#include <memory>
+#include <vector>
 
 namespace scwx
 {
@@ -36,9 +40,27 @@ private:
 public:
    struct Context;
 
-   static std::shared_ptr<Context> CreateContext();
-   static Level2MessageInfo        Create(std::istream&             is,
-                                          std::shared_ptr<Context>& ctx);
+   /**
+    * @brief Creates a message parsing context.
+    *
+    * @param [in] recordBuffer If the input stream reads directly from a record
+    * buffer, parsed messages may reference the buffer in lieu of copying its
+    * contents. The position of the input stream must correspond to the offset
+    * within the buffer.
+    * @param [in] lazyMomentDecoding If a record buffer is provided, data
+    * moments are decoded from the buffer the first time they are accessed,
+    * rather than when the message is parsed.
+    * @param [in] arena Optional memory arena. If provided, radar data messages
+    * are allocated from the arena.
+    *
+    * @return Message parsing context
+    */
+   static std::shared_ptr<Context>
+   CreateContext(std::shared_ptr<std::vector<char>> recordBuffer = nullptr,
+                 bool                               lazyMomentDecoding = false,
+                 std::shared_ptr<util::MemoryArena> arena = nullptr);
+   static Level2MessageInfo Create(std::istream&             is,
+                                   std::shared_ptr<Context>& ctx);
 };
 
 } // namespace rda
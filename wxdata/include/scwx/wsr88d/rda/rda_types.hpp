@@ -18,6 +18,16 @@ enum class MessageId : std::uint8_t
    DigitalRadarDataGeneric    = 31
 };
 
+enum class RadialStatus : std::uint8_t
+{
+   StartOfElevation     = 0,
+   Intermediate         = 1,
+   EndOfElevation       = 2,
+   StartOfVolume        = 3,
+   EndOfVolume          = 4,
+   StartOfLastElevation = 5
+};
+
 } // namespace rda
 } // namespace wsr88d
 } // namespace scwx
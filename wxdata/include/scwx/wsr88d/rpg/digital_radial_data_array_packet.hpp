@@ -4,6 +4,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <span>
 
 namespace scwx
 {
@@ -36,9 +37,9 @@ public:
    float    range_scale_factor() const;
    uint16_t number_of_radials() const;
 
-   float                       start_angle(uint16_t r) const;
-   float                       delta_angle(uint16_t r) const;
-   const std::vector<uint8_t>& level(uint16_t r) const;
+   float                    start_angle(uint16_t r) const;
+   float                    delta_angle(uint16_t r) const;
+   std::span<const uint8_t> level(uint16_t r) const;
 
    size_t data_size() const override;
 
@@ -4,6 +4,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <span>
 
 namespace scwx
 {
@@ -33,7 +34,15 @@ public:
    virtual float            start_angle(std::uint16_t r) const = 0;
    virtual float            delta_angle(std::uint16_t r) const = 0;
 
-   virtual const std::vector<std::uint8_t>& level(std::uint16_t r) const = 0;
+   /**
+    * @brief Gets the levels of a radial. The levels of each radial are stored
+    * in a single contiguous array.
+    *
+    * @param [in] r Radial index
+    *
+    * @return Levels of each range bin
+    */
+   virtual std::span<const std::uint8_t> level(std::uint16_t r) const = 0;
 
 private:
    std::unique_ptr<GenericRadialDataPacketImpl> p;
@@ -2,12 +2,14 @@
 
 #include <scwx/wsr88d/rpg/graphic_alphanumeric_block.hpp>
 #include <scwx/wsr88d/rpg/level3_message.hpp>
+#include <scwx/wsr88d/rpg/packet_index.hpp>
 #include <scwx/wsr88d/rpg/product_description_block.hpp>
 #include <scwx/wsr88d/rpg/product_symbology_block.hpp>
 #include <scwx/wsr88d/rpg/tabular_alphanumeric_block.hpp>
 
 #include <cstdint>
 #include <memory>
+#include <span>
 
 namespace scwx
 {
@@ -35,6 +37,29 @@ public:
    std::shared_ptr<GraphicAlphanumericBlock> graphic_block() const;
    std::shared_ptr<TabularAlphanumericBlock> tabular_block() const;
 
+   /**
+    * @brief Gets the index of the packets in the product symbology and graphic
+    * alphanumeric blocks. The tabular alphanumeric block contains only text,
+    * and has no packets.
+    *
+    * @return Packet index
+    */
+   const PacketIndex& packet_index() const;
+
+   /**
+    * @brief Finds the packets of a type in the product symbology and graphic
+    * alphanumeric blocks.
+    *
+    * @tparam T Packet type
+    *
+    * @return Packets, in message order
+    */
+   template<class T>
+   std::span<const std::shared_ptr<T>> FindPackets() const
+   {
+      return packet_index().FindPackets<T>();
+   }
+
    bool Parse(std::istream& is) override;
 
    static std::shared_ptr<GraphicProductMessage>
@@ -2,6 +2,10 @@
 
 #include <scwx/wsr88d/rpg/packet.hpp>
 
+#include <cstddef>
+#include <optional>
+#include <span>
+
 namespace scwx
 {
 namespace wsr88d
@@ -23,6 +27,17 @@ private:
 
 public:
    static std::shared_ptr<Packet> Create(std::istream& is);
+
+   /**
+    * @brief Determines the size of the packet at the beginning of the data
+    * from its packet header, without decoding the packet.
+    *
+    * @param [in] data Packet data, beginning with the packet code
+    *
+    * @return Size of the packet in bytes, or std::nullopt if the packet code is
+    * unknown or the packet is truncated
+    */
+   static std::optional<std::size_t> GetPacketSize(std::span<const char> data);
 };
 
 } // namespace rpg
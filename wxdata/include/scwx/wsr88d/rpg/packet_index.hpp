@@ -0,0 +1,137 @@
+#pragma once
+
+#include <scwx/wsr88d/rpg/packet.hpp>
+#include <scwx/wsr88d/rpg/rpg_types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <typeindex>
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rpg
+{
+
+/**
+ * @brief An index of the packets of a Level 3 message, keyed by packet code and
+ * packet type. Packets are added to the index in message order by packet code,
+ * and are only decoded when a search requires them.
+ *
+ * The packets of a type are found once, the first time they are requested, and
+ * subsequent requests return the same packets in constant time.
+ */
+class PacketIndex
+{
+public:
+   typedef std::function<std::shared_ptr<Packet>()> PacketFunction;
+
+   explicit PacketIndex();
+   ~PacketIndex();
+
+   PacketIndex(const PacketIndex&)            = delete;
+   PacketIndex& operator=(const PacketIndex&) = delete;
+
+   PacketIndex(PacketIndex&&) noexcept;
+   PacketIndex& operator=(PacketIndex&&) noexcept;
+
+   /**
+    * @brief Gets the number of packets in the index.
+    */
+   std::size_t size() const;
+
+   /**
+    * @brief Gets the number of packets with a packet code, without decoding
+    * the packets.
+    *
+    * @param [in] packetCode Packet code
+    *
+    * @return Number of packets
+    */
+   std::size_t packet_count(PacketCode packetCode) const;
+
+   /**
+    * @brief Adds a packet to the index. Packets must be added in message order,
+    * and may not be added after the index has been searched.
+    *
+    * @param [in] packetCode Packet code
+    * @param [in] packet Function returning the decoded packet, called the
+    * first time the packet is required
+    */
+   void Add(std::uint16_t packetCode, PacketFunction packet);
+
+   /**
+    * @brief Finds the packets with any of the specified packet codes. Only the
+    * matching packets are decoded.
+    *
+    * @param [in] packetCodes Packet codes
+    *
+    * @return Packets, in message order
+    */
+   std::vector<std::shared_ptr<Packet>>
+   FindPacketsByCode(std::initializer_list<PacketCode> packetCodes) const;
+
+   /**
+    * @brief Finds the packets of a type, including packets of derived types.
+    * Packets which could not be decoded are omitted.
+    *
+    * @tparam T Packet type
+    *
+    * @return Packets, in message order. The packets remain valid for the
+    * lifetime of the index.
+    */
+   template<class T>
+   std::span<const std::shared_ptr<T>> FindPackets() const
+   {
+      static_assert(std::is_base_of_v<Packet, T>,
+                    "Only packet types may be found");
+
+      typedef std::vector<std::shared_ptr<T>> TypedPacketList;
+
+      std::shared_ptr<void> packets = FindPacketsOfType(
+         typeid(T),
+         [](const Packet& packet)
+         { return dynamic_cast<const T*>(&packet) != nullptr; },
+         [](std::vector<std::shared_ptr<Packet>>&& packetList)
+         {
+            auto typedPacketList = std::make_shared<TypedPacketList>();
+            typedPacketList->reserve(packetList.size());
+
+            for (auto& packet : packetList)
+            {
+               typedPacketList->push_back(
+                  std::static_pointer_cast<T>(std::move(packet)));
+            }
+
+            return std::shared_ptr<void> {std::move(typedPacketList)};
+         });
+
+      return *std::static_pointer_cast<const TypedPacketList>(packets);
+   }
+
+private:
+   typedef std::function<bool(const Packet&)> IsTypeFunction;
+   typedef std::function<std::shared_ptr<void>(
+      std::vector<std::shared_ptr<Packet>>&&)>
+      CreateTypedPacketListFunction;
+
+   std::shared_ptr<void>
+   FindPacketsOfType(std::type_index                      type,
+                     const IsTypeFunction&                isType,
+                     const CreateTypedPacketListFunction& createTypedPacketList)
+      const;
+
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace rpg
+} // namespace wsr88d
+} // namespace scwx
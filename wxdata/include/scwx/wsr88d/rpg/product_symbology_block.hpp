@@ -3,8 +3,10 @@
 #include <scwx/awips/message.hpp>
 #include <scwx/wsr88d/rpg/packet.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace scwx
 {
@@ -15,6 +17,11 @@ namespace rpg
 
 class ProductSymbologyBlockImpl;
 
+/**
+ * @brief The product symbology block of a graphic product. In lazy packet
+ * decoding mode, parsing the block records the code and location of each
+ * packet, and each packet is decoded the first time it is accessed.
+ */
 class ProductSymbologyBlock : public awips::Message
 {
 public:
@@ -30,10 +37,56 @@ public:
    int16_t  block_divider() const;
    uint16_t number_of_layers() const;
 
+   /**
+    * @brief Gets the number of packets in a layer.
+    *
+    * @param [in] layer Layer index
+    *
+    * @return Number of packets
+    */
+   std::size_t packet_count(std::uint16_t layer) const;
+
+   /**
+    * @brief Gets the code of a packet, without decoding the packet.
+    *
+    * @param [in] layer Layer index
+    * @param [in] i Packet index within the layer
+    *
+    * @return Packet code, or 0 if the packet does not exist
+    */
+   std::uint16_t packet_code(std::uint16_t layer, std::size_t i) const;
+
+   /**
+    * @brief Gets a packet, decoding it on first access.
+    *
+    * @param [in] layer Layer index
+    * @param [in] i Packet index within the layer
+    *
+    * @return Packet, or nullptr if the packet does not exist or could not be
+    * decoded
+    */
+   std::shared_ptr<Packet> packet(std::uint16_t layer, std::size_t i) const;
+
+   /**
+    * @brief Gets each packet of a layer, decoding any packets which have not
+    * yet been decoded. Packets which could not be decoded are omitted.
+    *
+    * @param [in] i Layer index
+    *
+    * @return Packets of the layer
+    */
    std::vector<std::shared_ptr<Packet>> packet_list(uint16_t i) const;
 
    size_t data_size() const override;
 
+   /**
+    * @brief Sets whether packets are decoded on first access, in lieu of when
+    * the block is parsed. Must be set prior to parsing.
+    *
+    * @param [in] lazyPacketDecoding Lazy packet decoding. Defaults to false.
+    */
+   void set_lazy_packet_decoding(bool lazyPacketDecoding);
+
    bool Parse(std::istream& is);
 
    static constexpr size_t SIZE = 102u;
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/rda/flat_elevation_scan.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+/**
+ * @brief A volumetric sampling index over the elevation cuts of a Level 2
+ * volume, for a single data moment. Each cut is indexed once, with an azimuth
+ * lookup table and a beam height table, after which any cut may be sampled in
+ * constant time.
+ *
+ * Beam heights are calculated using the 4/3 effective earth radius model of
+ * standard atmospheric refraction, relative to the height of the radar.
+ */
+class VolumeIndex
+{
+public:
+   /**
+    * @brief A point relative to the radar, on the surface of the earth.
+    */
+   struct PolarCoordinate
+   {
+      double azimuth_ {0.0};  // Degrees
+      double distance_ {0.0}; // Meters, along the surface of the earth
+   };
+
+   /**
+    * @brief The beam of a single cut, sampled beneath a point.
+    */
+   struct BeamSample
+   {
+      float         height_ {0.0f};    // Meters, above the radar
+      float         halfWidth_ {0.0f}; // Meters
+      std::uint16_t level_ {0u};       // 0 if below threshold
+      bool          valid_ {false};    // Whether the cut reaches the point
+   };
+
+   static constexpr double kEffectiveEarthRadius_ = 6371000.0 * 4.0 / 3.0;
+   static constexpr float  kDefaultBeamWidth_     = 0.95f;
+
+   /**
+    * @brief Indexes the elevation cuts of a Level 2 volume. If an elevation is
+    * repeated within the volume (e.g., SAILS), the cut collected nearest the
+    * requested time is indexed.
+    *
+    * @param [in] file Level 2 volume
+    * @param [in] dataBlockType Data moment
+    * @param [in] time Collection time. If no time is requested, the most
+    * recent cut of each elevation is indexed.
+    * @param [in] beamWidth Beam width in degrees, used to determine the heights
+    * each cut covers
+    */
+   explicit VolumeIndex(const Ar2vFile&                       file,
+                        rda::DataBlockType                    dataBlockType,
+                        std::chrono::system_clock::time_point time = {},
+                        float beamWidth = kDefaultBeamWidth_);
+   ~VolumeIndex();
+
+   VolumeIndex(const VolumeIndex&)            = delete;
+   VolumeIndex& operator=(const VolumeIndex&) = delete;
+
+   VolumeIndex(VolumeIndex&&) noexcept;
+   VolumeIndex& operator=(VolumeIndex&&) noexcept;
+
+   rda::DataBlockType data_block_type() const;
+   std::size_t        cut_count() const;
+
+   /**
+    * @brief Gets the elevation angle of each indexed cut, in ascending order.
+    *
+    * @return Elevation angles in degrees, indexed by cut
+    */
+   std::span<const float> elevation_cuts() const;
+
+   /**
+    * @brief Gets the flat elevation scan of an indexed cut.
+    *
+    * @param [in] cut Cut index
+    *
+    * @return Flat elevation scan
+    */
+   std::shared_ptr<const rda::FlatElevationScan>
+   elevation_scan(std::size_t cut) const;
+
+   /**
+    * @brief Gets the scale and offset of the data moment, as reported by the
+    * lowest cut. Levels are converted to values by (level - offset) / scale.
+    */
+   float scale() const;
+   float offset() const;
+
+   /**
+    * @brief Gets the height of the center of a beam above the radar.
+    *
+    * @param [in] range Slant range in meters
+    * @param [in] elevation Elevation angle in degrees
+    *
+    * @return Height in meters
+    */
+   static double BeamHeight(double range, double elevation);
+
+   /**
+    * @brief Gets the distance along the surface of the earth beneath the
+    * center of a beam.
+    *
+    * @param [in] range Slant range in meters
+    * @param [in] elevation Elevation angle in degrees
+    *
+    * @return Distance in meters
+    */
+   static double BeamDistance(double range, double elevation);
+
+   /**
+    * @brief Gets the data level of the bin of a cut containing a point.
+    *
+    * @param [in] cut Cut index
+    * @param [in] azimuth Azimuth in degrees
+    * @param [in] distance Distance from the radar in meters, along the surface
+    * of the earth
+    *
+    * @return Data level, or std::nullopt if the point is beyond the range of
+    * the cut, or the level is below the signal to noise threshold
+    */
+   std::optional<std::uint16_t>
+   GetBinLevel(std::size_t cut, double azimuth, double distance) const;
+
+   /**
+    * @brief Samples every cut along a radial. Each cut finds its radial
+    * containing the azimuth once, so sampling a radial is faster than sampling
+    * each point individually.
+    *
+    * @param [in] azimuth Azimuth in degrees
+    * @param [in] distances Distances from the radar in meters, along the
+    * surface of the earth
+    *
+    * @return Beams sampled, stored in row-major order with one row per
+    * distance and one column per cut, in ascending elevation order.
+    */
+   std::vector<BeamSample>
+   SampleRadial(double azimuth, std::span<const double> distances) const;
+
+   /**
+    * @brief Samples a vertical cross-section along a path. Every cut is sampled
+    * beneath each point of the path, and each height is assigned the data
+    * level of the cut whose beam covers it. Points are sampled in parallel.
+    *
+    * @param [in] path Points along the path, relative to the radar
+    * @param [in] heights Heights above the radar in meters, in ascending order
+    *
+    * @return Data levels, stored in row-major order with one row per height
+    * and one column per path point. Heights not covered by a beam, and levels
+    * below the signal to noise threshold, are 0.
+    */
+   std::vector<std::uint16_t>
+   SampleCrossSection(std::span<const PolarCoordinate> path,
+                      std::span<const double>          heights) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace wsr88d
+} // namespace scwx
@@ -0,0 +1,508 @@
+#include <scwx/common/mosaic_grid.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <execution>
+#include <numeric>
+
+namespace scwx
+{
+namespace common
+{
+
+static const std::string logPrefix_ = "scwx::common::mosaic_grid";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+static constexpr double kEarthRadius_     = 6371008.8; // Mean radius, meters
+static constexpr double kMetersPerDegree_ = kEarthRadius_ * kDegreesToRadians;
+static constexpr double kMaxLatitude_     = 89.0;
+
+static constexpr std::uint32_t kNoCell_ = 0xffffffffu;
+
+static double GetDistance(double lat1, double lon1, double lat2, double lon2)
+{
+   // Haversine formula
+   const double phi1       = lat1 * kDegreesToRadians;
+   const double phi2       = lat2 * kDegreesToRadians;
+   const double sinDPhi    = std::sin((phi2 - phi1) * 0.5);
+   const double sinDLambda = std::sin((lon2 - lon1) * kDegreesToRadians * 0.5);
+
+   const double a = sinDPhi * sinDPhi +
+                    std::cos(phi1) * std::cos(phi2) * sinDLambda * sinDLambda;
+
+   return 2.0 * kEarthRadius_ * std::asin(std::min(1.0, std::sqrt(a)));
+}
+
+class MosaicGrid::Impl
+{
+public:
+   struct SiteBounds
+   {
+      std::size_t firstRow_ {0u};
+      std::size_t lastRow_ {0u};
+      std::size_t firstColumn_ {0u};
+      std::size_t lastColumn_ {0u};
+   };
+
+   struct CellSite
+   {
+      std::uint32_t site_ {0u};
+      std::uint32_t siteCell_ {0u}; // Index of the cell within the site
+   };
+
+   explicit Impl(double resolution, MosaicRule rule) :
+       resolution_ {resolution}, rule_ {rule}
+   {
+   }
+   ~Impl() = default;
+
+   void          Build(std::span<const Coordinate> sites, double range);
+   std::uint16_t CombineCell(std::size_t cell) const;
+   void          CombineSite(std::size_t site);
+
+   template<class Function>
+   void ForEachCoveringSite(std::size_t row,
+                            std::size_t column,
+                            Function    function) const;
+
+   double     resolution_;
+   MosaicRule rule_;
+
+   double      south_ {0.0};
+   double      west_ {0.0};
+   std::size_t rows_ {0u};
+   std::size_t columns_ {0u};
+   double      range_ {0.0};
+
+   std::vector<Coordinate> sites_ {};
+   std::vector<SiteBounds> siteBounds_ {};
+
+   // Covered cell index of each grid cell, or kNoCell_ if not covered
+   std::vector<std::uint32_t> gridCells_ {};
+
+   // Grid cell index of each covered cell
+   std::vector<std::uint32_t> cells_ {};
+
+   // Sites covering each covered cell, ordered by distance. The sites of cell
+   // n are stored in [cellSiteOffsets_[n], cellSiteOffsets_[n + 1]).
+   std::vector<std::uint32_t> cellSiteOffsets_ {};
+   std::vector<CellSite>      cellSites_ {};
+
+   std::vector<std::vector<std::uint32_t>> siteCells_ {};
+   std::vector<std::vector<std::uint16_t>> siteLevels_ {};
+   std::vector<bool>                       siteLoaded_ {};
+
+   std::vector<std::uint16_t> levels_ {};
+};
+
+MosaicGrid::MosaicGrid(std::span<const Coordinate> sites,
+                       double                      range,
+                       double                      resolution,
+                       MosaicRule                  rule) :
+    p(std::make_unique<Impl>(resolution, rule))
+{
+   if (sites.empty() || range <= 0.0 || resolution <= 0.0)
+   {
+      logger_->warn("Invalid mosaic grid");
+      return;
+   }
+
+   p->Build(sites, range);
+}
+
+MosaicGrid::~MosaicGrid() = default;
+
+MosaicGrid::MosaicGrid(MosaicGrid&&) noexcept            = default;
+MosaicGrid& MosaicGrid::operator=(MosaicGrid&&) noexcept = default;
+
+template<class Function>
+void MosaicGrid::Impl::ForEachCoveringSite(std::size_t row,
+                                           std::size_t column,
+                                           Function    function) const
+{
+   const double latitude  = south_ + (row + 0.5) * resolution_;
+   const double longitude = west_ + (column + 0.5) * resolution_;
+
+   for (std::size_t site = 0; site < sites_.size(); ++site)
+   {
+      const SiteBounds& bounds = siteBounds_[site];
+
+      if (row < bounds.firstRow_ || row > bounds.lastRow_ ||
+          column < bounds.firstColumn_ || column > bounds.lastColumn_)
+      {
+         continue;
+      }
+
+      const double distance = GetDistance(sites_[site].latitude_,
+                                          sites_[site].longitude_,
+                                          latitude,
+                                          longitude);
+
+      if (distance <= range_)
+      {
+         function(site, distance);
+      }
+   }
+}
+
+void MosaicGrid::Impl::Build(std::span<const Coordinate> sites, double range)
+{
+   sites_.assign(sites.begin(), sites.end());
+   range_ = range;
+
+   // Determine the extent of each site, and of the grid. The grid is aligned to
+   // a multiple of the resolution, so grids of the same resolution share cell
+   // boundaries.
+   const double latitudeExtent = range / kMetersPerDegree_;
+
+   double north = -90.0;
+   double east  = -180.0;
+   south_       = 90.0;
+   west_        = 180.0;
+
+   std::vector<std::array<double, 4>> siteExtents(sites_.size());
+
+   for (std::size_t site = 0; site < sites_.size(); ++site)
+   {
+      const Coordinate& coordinate = sites_[site];
+
+      const double siteSouth = coordinate.latitude_ - latitudeExtent;
+      const double siteNorth = coordinate.latitude_ + latitudeExtent;
+
+      // Longitude extent is greatest on the poleward edge of the site
+      const double maxLatitude = std::min(
+         std::max(std::abs(siteSouth), std::abs(siteNorth)), kMaxLatitude_);
+      const double longitudeExtent =
+         latitudeExtent / std::cos(maxLatitude * kDegreesToRadians);
+
+      const double siteWest = coordinate.longitude_ - longitudeExtent;
+      const double siteEast = coordinate.longitude_ + longitudeExtent;
+
+      siteExtents[site] = {siteSouth, siteNorth, siteWest, siteEast};
+
+      south_ = std::min(south_, siteSouth);
+      north  = std::max(north, siteNorth);
+      west_  = std::min(west_, siteWest);
+      east   = std::max(east, siteEast);
+   }
+
+   south_ = std::floor(south_ / resolution_) * resolution_;
+   west_  = std::floor(west_ / resolution_) * resolution_;
+   rows_ =
+      static_cast<std::size_t>(std::ceil((north - south_) / resolution_));
+   columns_ =
+      static_cast<std::size_t>(std::ceil((east - west_) / resolution_));
+
+   auto toIndex = [this](double value, double origin, std::size_t count)
+   {
+      return static_cast<std::size_t>(std::clamp<double>(
+         std::floor((value - origin) / resolution_), 0.0, count - 1.0));
+   };
+
+   siteBounds_.resize(sites_.size());
+   for (std::size_t site = 0; site < sites_.size(); ++site)
+   {
+      const auto& extent = siteExtents[site];
+
+      siteBounds_[site] = {toIndex(extent[0], south_, rows_),
+                           toIndex(extent[1], south_, rows_),
+                           toIndex(extent[2], west_, columns_),
+                           toIndex(extent[3], west_, columns_)};
+   }
+
+   std::vector<std::size_t> rowIndices(rows_);
+   std::iota(rowIndices.begin(), rowIndices.end(), 0u);
+
+   // First pass: count the sites covering each grid cell
+   std::vector<std::uint16_t> siteCounts(rows_ * columns_, 0u);
+
+   std::for_each(std::execution::par,
+                 rowIndices.cbegin(),
+                 rowIndices.cend(),
+                 [&](std::size_t row)
+                 {
+                    for (std::size_t column = 0; column < columns_; ++column)
+                    {
+                       ForEachCoveringSite(
+                          row,
+                          column,
+                          [&](std::size_t, double)
+                          { ++siteCounts[row * columns_ + column]; });
+                    }
+                 });
+
+   // Number the covered cells in row-major order. The prefix sum of the site
+   // counts gives the offset at which the sites of each cell are stored.
+   gridCells_.assign(rows_ * columns_, kNoCell_);
+   cellSiteOffsets_.assign(1u, 0u);
+
+   for (std::size_t gridCell = 0; gridCell < gridCells_.size(); ++gridCell)
+   {
+      if (siteCounts[gridCell] > 0u)
+      {
+         gridCells_[gridCell] = static_cast<std::uint32_t>(cells_.size());
+         cells_.push_back(static_cast<std::uint32_t>(gridCell));
+         cellSiteOffsets_.push_back(cellSiteOffsets_.back() +
+                                    siteCounts[gridCell]);
+      }
+   }
+
+   // Second pass: store the sites covering each cell, ordered by distance
+   cellSites_.resize(cellSiteOffsets_.back());
+
+   std::for_each(
+      std::execution::par,
+      rowIndices.cbegin(),
+      rowIndices.cend(),
+      [&](std::size_t row)
+      {
+         std::vector<std::pair<double, std::uint32_t>> covering {};
+
+         for (std::size_t column = 0; column < columns_; ++column)
+         {
+            const std::uint32_t cell = gridCells_[row * columns_ + column];
+            if (cell == kNoCell_)
+            {
+               continue;
+            }
+
+            covering.clear();
+            ForEachCoveringSite(
+               row,
+               column,
+               [&](std::size_t site, double distance)
+               {
+                  covering.emplace_back(distance,
+                                        static_cast<std::uint32_t>(site));
+               });
+            std::sort(covering.begin(), covering.end());
+
+            std::size_t offset = cellSiteOffsets_[cell];
+            for (const auto& [distance, site] : covering)
+            {
+               cellSites_[offset++].site_ = site;
+            }
+         }
+      });
+
+   // Number the cells within range of each site
+   siteCells_.resize(sites_.size());
+   siteLevels_.resize(sites_.size());
+   siteLoaded_.assign(sites_.size(), false);
+
+   for (std::size_t cell = 0; cell < cells_.size(); ++cell)
+   {
+      for (std::size_t i = cellSiteOffsets_[cell];
+           i < cellSiteOffsets_[cell + 1];
+           ++i)
+      {
+         auto& siteCells = siteCells_[cellSites_[i].site_];
+
+         cellSites_[i].siteCell_ = static_cast<std::uint32_t>(siteCells.size());
+         siteCells.push_back(static_cast<std::uint32_t>(cell));
+      }
+   }
+
+   levels_.assign(cells_.size(), 0u);
+}
+
+std::uint16_t MosaicGrid::Impl::CombineCell(std::size_t cell) const
+{
+   std::uint16_t level = 0u;
+
+   for (std::size_t i = cellSiteOffsets_[cell]; i < cellSiteOffsets_[cell + 1];
+        ++i)
+   {
+      const CellSite& cellSite = cellSites_[i];
+
+      if (!siteLoaded_[cellSite.site_])
+      {
+         continue;
+      }
+
+      const std::uint16_t siteLevel =
+         siteLevels_[cellSite.site_][cellSite.siteCell_];
+
+      if (rule_ == MosaicRule::NearestRadar)
+      {
+         // Sites are ordered by distance
+         return siteLevel;
+      }
+
+      level = std::max(level, siteLevel);
+   }
+
+   return level;
+}
+
+void MosaicGrid::Impl::CombineSite(std::size_t site)
+{
+   // Only the cells covered by the site are recombined
+   const std::vector<std::uint32_t>& siteCells = siteCells_[site];
+
+   std::for_each(std::execution::par_unseq,
+                 siteCells.cbegin(),
+                 siteCells.cend(),
+                 [this](std::uint32_t cell)
+                 { levels_[cell] = CombineCell(cell); });
+}
+
+std::size_t MosaicGrid::rows() const
+{
+   return p->rows_;
+}
+
+std::size_t MosaicGrid::columns() const
+{
+   return p->columns_;
+}
+
+double MosaicGrid::resolution() const
+{
+   return p->resolution_;
+}
+
+MosaicRule MosaicGrid::rule() const
+{
+   return p->rule_;
+}
+
+std::size_t MosaicGrid::site_count() const
+{
+   return p->sites_.size();
+}
+
+std::size_t MosaicGrid::cell_count() const
+{
+   return p->cells_.size();
+}
+
+Coordinate MosaicGrid::cell_center(std::size_t cell) const
+{
+   const std::size_t gridCell = p->cells_[cell];
+   const std::size_t row      = gridCell / p->columns_;
+   const std::size_t column   = gridCell % p->columns_;
+
+   return {p->south_ + (row + 0.5) * p->resolution_,
+           p->west_ + (column + 0.5) * p->resolution_};
+}
+
+std::span<const std::uint32_t> MosaicGrid::site_cells(std::size_t site) const
+{
+   return p->siteCells_[site];
+}
+
+std::span<const std::uint16_t> MosaicGrid::levels() const
+{
+   return p->levels_;
+}
+
+std::optional<std::size_t>
+MosaicGrid::FindCell(const Coordinate& coordinate) const
+{
+   const double row = std::floor((coordinate.latitude_ - p->south_) /
+                                 p->resolution_);
+   const double column =
+      std::floor((coordinate.longitude_ - p->west_) / p->resolution_);
+
+   if (row < 0.0 || row >= static_cast<double>(p->rows_) || column < 0.0 ||
+       column >= static_cast<double>(p->columns_))
+   {
+      return std::nullopt;
+   }
+
+   const std::uint32_t cell =
+      p->gridCells_[static_cast<std::size_t>(row) * p->columns_ +
+                    static_cast<std::size_t>(column)];
+
+   if (cell == kNoCell_)
+   {
+      return std::nullopt;
+   }
+
+   return cell;
+}
+
+std::vector<float> MosaicGrid::GetVertices() const
+{
+   static constexpr std::size_t kValuesPerCell_ = 12u;
+
+   std::vector<float> vertices(p->cells_.size() * kValuesPerCell_);
+
+   std::vector<std::size_t> cellIndices(p->cells_.size());
+   std::iota(cellIndices.begin(), cellIndices.end(), 0u);
+
+   std::for_each(std::execution::par_unseq,
+                 cellIndices.cbegin(),
+                 cellIndices.cend(),
+                 [&](std::size_t cell)
+                 {
+                    const std::size_t gridCell = p->cells_[cell];
+                    const std::size_t row      = gridCell / p->columns_;
+                    const std::size_t column   = gridCell % p->columns_;
+
+                    const float south = static_cast<float>(
+                       p->south_ + row * p->resolution_);
+                    const float north = static_cast<float>(
+                       p->south_ + (row + 1) * p->resolution_);
+                    const float west = static_cast<float>(
+                       p->west_ + column * p->resolution_);
+                    const float east = static_cast<float>(
+                       p->west_ + (column + 1) * p->resolution_);
+
+                    std::size_t vIndex = cell * kValuesPerCell_;
+
+                    vertices[vIndex++] = south;
+                    vertices[vIndex++] = west;
+
+                    vertices[vIndex++] = north;
+                    vertices[vIndex++] = west;
+
+                    vertices[vIndex++] = south;
+                    vertices[vIndex++] = east;
+
+                    vertices[vIndex++] = south;
+                    vertices[vIndex++] = east;
+
+                    vertices[vIndex++] = north;
+                    vertices[vIndex++] = east;
+
+                    vertices[vIndex++] = north;
+                    vertices[vIndex++] = west;
+                 });
+
+   return vertices;
+}
+
+void MosaicGrid::UpdateSite(std::size_t                    site,
+                            std::span<const std::uint16_t> levels)
+{
+   if (site >= p->sites_.size() || levels.size() != p->siteCells_[site].size())
+   {
+      logger_->warn("Invalid levels for mosaic site: {}", site);
+      return;
+   }
+
+   p->siteLevels_[site].assign(levels.begin(), levels.end());
+   p->siteLoaded_[site] = true;
+
+   p->CombineSite(site);
+}
+
+void MosaicGrid::ClearSite(std::size_t site)
+{
+   if (site >= p->sites_.size())
+   {
+      return;
+   }
+
+   p->siteLevels_[site].clear();
+   p->siteLoaded_[site] = false;
+
+   p->CombineSite(site);
+}
+
+} // namespace common
+} // namespace scwx
@@ -0,0 +1,181 @@
+#define _SILENCE_STDEXT_ARR_ITERS_DEPRECATION_WARNING
+
+#include <scwx/provider/aws_level2_chunks_data_provider.hpp>
+#include <scwx/util/environment.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <sstream>
+
+#include <aws/core/auth/AWSCredentials.h>
+#include <aws/s3/S3Client.h>
+#include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/ListObjectsV2Request.h>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string logPrefix_ =
+   "scwx::provider::aws_level2_chunks_data_provider";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+static const std::string kDefaultBucketName_ = "unidata-nexrad-level2-chunks";
+static const std::string kDefaultRegion_     = "us-east-1";
+
+class AwsLevel2ChunksDataProvider::Impl
+{
+public:
+   explicit Impl(const std::string& bucketName, const std::string& region) :
+       bucketName_ {bucketName}, region_ {region}, client_ {nullptr}
+   {
+      // Disable HTTP request for region
+      util::SetEnvironment("AWS_EC2_METADATA_DISABLED", "true");
+
+      // Use anonymous credentials
+      Aws::Auth::AWSCredentials credentials {};
+
+      Aws::Client::ClientConfiguration config;
+      config.region           = region_;
+      config.connectTimeoutMs = 10000;
+
+      client_ = std::make_shared<Aws::S3::S3Client>(
+         credentials,
+         Aws::MakeShared<Aws::S3::S3EndpointProvider>(
+            Aws::S3::S3Client::GetAllocationTag()),
+         config);
+   }
+
+   ~Impl() {}
+
+   std::string bucketName_;
+   std::string region_;
+
+   std::shared_ptr<Aws::S3::S3Client> client_;
+};
+
+AwsLevel2ChunksDataProvider::AwsLevel2ChunksDataProvider(
+   const std::string& radarSite) :
+    AwsLevel2ChunksDataProvider(radarSite, kDefaultBucketName_, kDefaultRegion_)
+{
+}
+AwsLevel2ChunksDataProvider::AwsLevel2ChunksDataProvider(
+   const std::string& radarSite,
+   const std::string& bucketName,
+   const std::string& region) :
+    Level2ChunksDataProvider(radarSite),
+    p(std::make_unique<Impl>(bucketName, region))
+{
+}
+AwsLevel2ChunksDataProvider::~AwsLevel2ChunksDataProvider() = default;
+
+AwsLevel2ChunksDataProvider::AwsLevel2ChunksDataProvider(
+   AwsLevel2ChunksDataProvider&&) noexcept = default;
+AwsLevel2ChunksDataProvider& AwsLevel2ChunksDataProvider::operator=(
+   AwsLevel2ChunksDataProvider&&) noexcept = default;
+
+std::vector<std::string>
+AwsLevel2ChunksDataProvider::ListPrefixes(const std::string& prefix)
+{
+   logger_->debug("ListPrefixes: {}", prefix);
+
+   std::vector<std::string> prefixes {};
+
+   // There are at most 999 volume prefixes per radar site, which do not exceed
+   // the maximum number of keys returned by a single request
+   Aws::S3::Model::ListObjectsV2Request request;
+   request.SetBucket(p->bucketName_);
+   request.SetPrefix(prefix);
+   request.SetDelimiter("/");
+
+   auto outcome = p->client_->ListObjectsV2(request);
+
+   if (outcome.IsSuccess())
+   {
+      for (auto& commonPrefix : outcome.GetResult().GetCommonPrefixes())
+      {
+         prefixes.push_back(commonPrefix.GetPrefix());
+      }
+   }
+   else
+   {
+      logger_->warn("Could not list prefixes: {}",
+                    outcome.GetError().GetMessage());
+   }
+
+   return prefixes;
+}
+
+std::vector<AwsLevel2ChunksDataProvider::ObjectInfo>
+AwsLevel2ChunksDataProvider::ListChunks(const std::string& prefix,
+                                        std::size_t        maxKeys)
+{
+   logger_->debug("ListChunks: {}", prefix);
+
+   std::vector<ObjectInfo> chunks {};
+
+   Aws::S3::Model::ListObjectsV2Request request;
+   request.SetBucket(p->bucketName_);
+   request.SetPrefix(prefix);
+   request.SetDelimiter("/");
+
+   if (maxKeys > 0)
+   {
+      request.SetMaxKeys(static_cast<int>(maxKeys));
+   }
+
+   auto outcome = p->client_->ListObjectsV2(request);
+
+   if (outcome.IsSuccess())
+   {
+      // Objects are returned in ascending key order
+      for (auto& object : outcome.GetResult().GetContents())
+      {
+         std::chrono::seconds lastModifiedSeconds {
+            object.GetLastModified().Seconds()};
+         std::chrono::system_clock::time_point lastModified {
+            lastModifiedSeconds};
+
+         chunks.push_back({object.GetKey(), lastModified});
+      }
+   }
+   else
+   {
+      logger_->warn("Could not list chunks: {}",
+                    outcome.GetError().GetMessage());
+   }
+
+   return chunks;
+}
+
+std::shared_ptr<std::istream>
+AwsLevel2ChunksDataProvider::GetChunk(const std::string& key)
+{
+   std::shared_ptr<std::stringstream> chunk = nullptr;
+
+   Aws::S3::Model::GetObjectRequest request;
+   request.SetBucket(p->bucketName_);
+   request.SetKey(key);
+
+   auto outcome = p->client_->GetObject(request);
+
+   if (outcome.IsSuccess())
+   {
+      auto& body = outcome.GetResultWithOwnership().GetBody();
+
+      // The object body is owned by the request outcome
+      chunk = std::make_shared<std::stringstream>(std::ios_base::in |
+                                                  std::ios_base::out |
+                                                  std::ios_base::binary);
+      *chunk << body.rdbuf();
+   }
+   else
+   {
+      logger_->warn("Could not get chunk: {}", outcome.GetError().GetMessage());
+   }
+
+   return chunk;
+}
+
+} // namespace provider
+} // namespace scwx
@@ -295,7 +295,9 @@ AwsNexradDataProvider::ListObjects(std::chrono::system_clock::time_point date)
 }
 
 std::shared_ptr<wsr88d::NexradFile>
-AwsNexradDataProvider::LoadObjectByKey(const std::string& key)
+AwsNexradDataProvider::LoadObjectByKey(
+   const std::string&                                key,
+   const wsr88d::NexradFileFactory::PreloadFunction& preload)
 {
    std::shared_ptr<wsr88d::NexradFile> nexradFile = nullptr;
 
@@ -309,7 +311,7 @@ AwsNexradDataProvider::LoadObjectByKey(const std::string& key)
    {
       auto& body = outcome.GetResultWithOwnership().GetBody();
 
-      nexradFile = wsr88d::NexradFileFactory::Create(body);
+      nexradFile = wsr88d::NexradFileFactory::Create(body, preload);
    }
    else
    {
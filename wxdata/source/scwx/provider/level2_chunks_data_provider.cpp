@@ -0,0 +1,654 @@
+#include <scwx/provider/level2_chunks_data_provider.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/map.hpp>
+#include <scwx/util/strings.hpp>
+#include <scwx/util/time.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <sstream>
+
+#include <boost/algorithm/string/split.hpp>
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#if !defined(_MSC_VER)
+#   include <date/date.h>
+#endif
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string logPrefix_ =
+   "scwx::provider::level2_chunks_data_provider";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+// Keep the volume in progress, and the most recently completed volume
+static constexpr std::size_t kMaxVolumes_ = 2;
+
+// Volume numbers cycle from 1 to 999
+static constexpr int kMaxVolumeNumber_ = 999;
+
+class Level2ChunksDataProvider::Impl
+{
+public:
+   struct ChunkInfo
+   {
+      std::string                           volumeKey_ {};
+      std::chrono::system_clock::time_point time_ {};
+      std::size_t                           chunkNumber_ {};
+      char                                  chunkType_ {};
+   };
+
+   struct VolumeRecord
+   {
+      explicit VolumeRecord(const std::string&                    key,
+                            int                                   volumeNumber,
+                            std::chrono::system_clock::time_point time) :
+          key_ {key}, volumeNumber_ {volumeNumber}, time_ {time}
+      {
+      }
+      ~VolumeRecord() = default;
+
+      std::string                           key_;
+      int                                   volumeNumber_;
+      std::chrono::system_clock::time_point time_;
+
+      std::shared_ptr<wsr88d::Ar2vFile> file_ {nullptr};
+      std::size_t                       chunksLoaded_ {0};
+      bool                              complete_ {false};
+   };
+
+   explicit Impl(Level2ChunksDataProvider* self,
+                 const std::string&        radarSite) :
+       self_ {self}, radarSite_ {radarSite}
+   {
+   }
+
+   ~Impl() {}
+
+   std::optional<int>       FindCurrentVolume();
+   std::optional<ChunkInfo> FindStartChunk(
+      const std::string&                    prefix,
+      std::chrono::system_clock::time_point previousVolumeTime);
+   std::string GetVolumePrefix(int volumeNumber) const;
+   std::chrono::system_clock::time_point GetVolumeTime(int volumeNumber);
+   bool LoadChunk(VolumeRecord& volume, const ObjectInfo& chunk, bool final);
+   bool LoadVolumeChunks(VolumeRecord& volume);
+   bool NextVolumeStarted(const VolumeRecord& volume);
+   void PruneVolumes();
+   void UpdateMetadata(std::chrono::system_clock::time_point lastModified);
+
+   static std::optional<ChunkInfo> ParseChunkKey(const std::string& key);
+
+   Level2ChunksDataProvider* self_;
+
+   std::string radarSite_;
+
+   std::map<std::chrono::system_clock::time_point,
+            std::shared_ptr<VolumeRecord>>
+                     volumes_ {};
+   std::shared_mutex volumesMutex_ {};
+
+   std::mutex                    refreshMutex_ {};
+   std::optional<int>            currentVolumeNumber_ {};
+   std::shared_ptr<VolumeRecord> currentVolume_ {nullptr};
+
+   std::vector<std::pair<std::string, float>> completedElevationScans_ {};
+
+   std::chrono::system_clock::time_point lastModified_ {};
+   std::chrono::seconds                  updatePeriod_ {};
+};
+
+Level2ChunksDataProvider::Level2ChunksDataProvider(
+   const std::string& radarSite) :
+    p(std::make_unique<Impl>(this, radarSite))
+{
+}
+Level2ChunksDataProvider::~Level2ChunksDataProvider() = default;
+
+Level2ChunksDataProvider::Level2ChunksDataProvider(
+   Level2ChunksDataProvider&& other) noexcept :
+    NexradDataProvider(std::move(other)), p {std::move(other.p)}
+{
+   p->self_ = this;
+}
+Level2ChunksDataProvider&
+Level2ChunksDataProvider::operator=(Level2ChunksDataProvider&& other) noexcept
+{
+   NexradDataProvider::operator=(std::move(other));
+   p        = std::move(other.p);
+   p->self_ = this;
+   return *this;
+}
+
+size_t Level2ChunksDataProvider::cache_size() const
+{
+   std::shared_lock lock(p->volumesMutex_);
+   return p->volumes_.size();
+}
+
+std::chrono::system_clock::time_point
+Level2ChunksDataProvider::last_modified() const
+{
+   return p->lastModified_;
+}
+
+std::chrono::seconds Level2ChunksDataProvider::update_period() const
+{
+   return p->updatePeriod_;
+}
+
+std::string
+Level2ChunksDataProvider::FindKey(std::chrono::system_clock::time_point time)
+{
+   logger_->debug("FindKey: {}", util::TimeString(time));
+
+   std::string key {};
+
+   std::shared_lock lock(p->volumesMutex_);
+
+   auto element = util::GetBoundedElement(p->volumes_, time);
+
+   if (element.has_value())
+   {
+      key = element.value()->key_;
+   }
+
+   return key;
+}
+
+std::string Level2ChunksDataProvider::FindLatestKey()
+{
+   logger_->debug("FindLatestKey()");
+
+   std::string key {};
+
+   std::shared_lock lock(p->volumesMutex_);
+
+   if (!p->volumes_.empty())
+   {
+      key = p->volumes_.crbegin()->second->key_;
+   }
+
+   return key;
+}
+
+std::vector<std::chrono::system_clock::time_point>
+Level2ChunksDataProvider::GetTimePointsByDate(
+   std::chrono::system_clock::time_point date)
+{
+   const auto day = std::chrono::floor<std::chrono::days>(date);
+
+   std::vector<std::chrono::system_clock::time_point> timePoints {};
+
+   logger_->trace("GetTimePointsByDate: {}", util::TimeString(date));
+
+   std::shared_lock lock(p->volumesMutex_);
+
+   // Only volumes which have been ingested from the chunk feed are available
+   auto volumesBegin = p->volumes_.lower_bound(day);
+   auto volumesEnd   = p->volumes_.lower_bound(day + std::chrono::days {1});
+
+   std::transform(volumesBegin,
+                  volumesEnd,
+                  std::back_inserter(timePoints),
+                  [](const auto& volume) { return volume.first; });
+
+   return timePoints;
+}
+
+std::tuple<bool, size_t, size_t> Level2ChunksDataProvider::ListObjects(
+   std::chrono::system_clock::time_point date)
+{
+   // The chunk feed is not organized by date, and only contains the most recent
+   // volumes. Report the volumes which have already been ingested.
+   return {true, 0u, GetTimePointsByDate(date).size()};
+}
+
+std::shared_ptr<wsr88d::NexradFile> Level2ChunksDataProvider::LoadObjectByKey(
+   const std::string&                                key,
+   const wsr88d::NexradFileFactory::PreloadFunction& preload)
+{
+   std::shared_lock lock(p->volumesMutex_);
+
+   auto it = p->volumes_.find(GetTimePointFromKey(key));
+   if (it != p->volumes_.cend() && it->second->key_ == key)
+   {
+      // The volume has already been ingested, and may still be growing
+      return it->second->file_;
+   }
+
+   lock.unlock();
+
+   // Load the volume from each of its chunks
+   const std::size_t lastSeparator = key.rfind('/');
+   if (lastSeparator == std::string::npos)
+   {
+      logger_->warn("Invalid key: \"{}\"", key);
+      return nullptr;
+   }
+
+   std::vector<ObjectInfo> chunks =
+      ListChunks(key.substr(0, lastSeparator + 1), 0);
+
+   std::erase_if(chunks,
+                 [&key](const ObjectInfo& chunk)
+                 { return !chunk.key_.starts_with(key + "-"); });
+
+   if (chunks.empty())
+   {
+      logger_->warn("No chunks found for key: \"{}\"", key);
+      return nullptr;
+   }
+
+   auto file = std::make_shared<wsr88d::Ar2vFile>();
+
+   if (preload != nullptr)
+   {
+      preload(file);
+   }
+
+   for (std::size_t i = 0; i < chunks.size(); ++i)
+   {
+      std::shared_ptr<std::istream> is = GetChunk(chunks[i].key_);
+
+      if (is == nullptr || !file->LoadChunk(*is, i == chunks.size() - 1))
+      {
+         logger_->warn("Could not load chunk: \"{}\"", chunks[i].key_);
+         return nullptr;
+      }
+   }
+
+   return file;
+}
+
+std::pair<size_t, size_t> Level2ChunksDataProvider::Refresh()
+{
+   logger_->debug("Refresh()");
+
+   std::unique_lock lock(p->refreshMutex_);
+
+   const std::size_t previousElevationScans =
+      p->completedElevationScans_.size();
+
+   if (!p->currentVolumeNumber_.has_value())
+   {
+      p->currentVolumeNumber_ = p->FindCurrentVolume();
+   }
+
+   while (p->currentVolumeNumber_.has_value())
+   {
+      const int volumeNumber = p->currentVolumeNumber_.value();
+
+      if (p->currentVolume_ == nullptr ||
+          p->currentVolume_->volumeNumber_ != volumeNumber)
+      {
+         std::chrono::system_clock::time_point previousVolumeTime {};
+         if (p->currentVolume_ != nullptr)
+         {
+            previousVolumeTime = p->currentVolume_->time_;
+         }
+
+         // Look for the start chunk of the volume. Chunks older than the
+         // previous volume are left over from the previous cycle of volume
+         // numbers.
+         auto chunkInfo =
+            p->FindStartChunk(p->GetVolumePrefix(volumeNumber),
+                              previousVolumeTime);
+
+         if (!chunkInfo.has_value())
+         {
+            // The volume has not started yet
+            break;
+         }
+
+         logger_->debug("Volume started: {}", chunkInfo->volumeKey_);
+
+         auto volume = std::make_shared<Impl::VolumeRecord>(
+            chunkInfo->volumeKey_, volumeNumber, chunkInfo->time_);
+         volume->file_ = std::make_shared<wsr88d::Ar2vFile>();
+         volume->file_->SetElevationScanCallback(
+            [impl = p.get(), key = volume->key_](float elevationCut)
+            {
+               impl->completedElevationScans_.emplace_back(key,
+                                                           elevationCut);
+            });
+
+         p->currentVolume_ = volume;
+
+         std::unique_lock volumesLock(p->volumesMutex_);
+         p->volumes_.insert_or_assign(volume->time_, volume);
+         volumesLock.unlock();
+
+         p->PruneVolumes();
+      }
+
+      Impl::VolumeRecord& volume = *p->currentVolume_;
+
+      bool chunksLoaded = p->LoadVolumeChunks(volume);
+
+      if (!volume.complete_ && !chunksLoaded && p->NextVolumeStarted(volume))
+      {
+         // The end chunk of the volume was missed. Publish the elevation scans
+         // in progress, and continue with the next volume.
+         logger_->warn("Volume incomplete: {}", volume.key_);
+
+         std::istringstream empty {};
+         volume.file_->LoadChunk(empty, true);
+         volume.complete_ = true;
+      }
+
+      if (!volume.complete_)
+      {
+         // Wait for more chunks
+         break;
+      }
+
+      p->currentVolumeNumber_ = volumeNumber % kMaxVolumeNumber_ + 1;
+   }
+
+   return {p->completedElevationScans_.size() - previousElevationScans,
+           cache_size()};
+}
+
+std::vector<std::pair<std::string, float>>
+Level2ChunksDataProvider::TakeCompletedElevationScans()
+{
+   std::unique_lock lock(p->refreshMutex_);
+
+   std::vector<std::pair<std::string, float>> completedElevationScans {};
+   completedElevationScans.swap(p->completedElevationScans_);
+
+   return completedElevationScans;
+}
+
+std::chrono::system_clock::time_point
+Level2ChunksDataProvider::GetTimePointByKey(const std::string& key) const
+{
+   return GetTimePointFromKey(key);
+}
+
+std::chrono::system_clock::time_point
+Level2ChunksDataProvider::GetTimePointFromKey(const std::string& key)
+{
+   std::chrono::system_clock::time_point time {};
+
+   const size_t lastSeparator = key.rfind('/');
+   const size_t offset =
+      (lastSeparator == std::string::npos) ? 0 : lastSeparator + 1;
+
+   // Key format is SITE/VVV/YYYYMMDD-HHMMSS(-CCC-T)
+   static const size_t formatSize = std::string("YYYYMMDD-HHMMSS").size();
+
+   if (key.size() >= offset + formatSize)
+   {
+      using namespace std::chrono;
+
+#if !defined(_MSC_VER)
+      using namespace date;
+#endif
+
+      static const std::string timeFormat {"%Y%m%d-%H%M%S"};
+
+      std::string        timeStr {key.substr(offset, formatSize)};
+      std::istringstream in {timeStr};
+      in >> parse(timeFormat, time);
+
+      if (in.fail())
+      {
+         logger_->warn("Invalid time: \"{}\"", timeStr);
+      }
+   }
+   else
+   {
+      logger_->warn("Time not parsable from key: \"{}\"", key);
+   }
+
+   return time;
+}
+
+std::optional<int> Level2ChunksDataProvider::Impl::FindCurrentVolume()
+{
+   logger_->debug("FindCurrentVolume()");
+
+   std::vector<int> volumeNumbers {};
+
+   for (const std::string& prefix : self_->ListPrefixes(radarSite_ + "/"))
+   {
+      // Prefix format is SITE/VVV/
+      const std::size_t begin = radarSite_.size() + 1;
+      const std::string volume {
+         prefix.substr(begin, prefix.size() - begin - 1)};
+
+      auto volumeNumber = util::TryParseNumeric<std::uint16_t>(volume);
+      if (volumeNumber.has_value())
+      {
+         volumeNumbers.push_back(volumeNumber.value());
+      }
+      else
+      {
+         logger_->trace("Ignoring prefix: \"{}\"", prefix);
+      }
+   }
+
+   if (volumeNumbers.empty())
+   {
+      logger_->info("No volumes found for {}", radarSite_);
+      return std::nullopt;
+   }
+
+   std::sort(volumeNumbers.begin(), volumeNumbers.end());
+
+   // Ordered by volume number, volume times are ascending, apart from where the
+   // volume number has wrapped. Binary search for the oldest volume, which
+   // immediately follows the most recent volume.
+   std::size_t low  = 0;
+   std::size_t high = volumeNumbers.size() - 1;
+
+   const auto highTime = GetVolumeTime(volumeNumbers[high]);
+
+   while (low < high)
+   {
+      const std::size_t mid = (low + high) / 2;
+
+      if (GetVolumeTime(volumeNumbers[mid]) > highTime)
+      {
+         low = mid + 1;
+      }
+      else
+      {
+         high = mid;
+      }
+   }
+
+   const int volumeNumber =
+      volumeNumbers[(low + volumeNumbers.size() - 1) % volumeNumbers.size()];
+
+   logger_->debug("Current volume: {}", volumeNumber);
+
+   return volumeNumber;
+}
+
+std::string Level2ChunksDataProvider::Impl::GetVolumePrefix(
+   int volumeNumber) const
+{
+   return fmt::format("{}/{}/", radarSite_, volumeNumber);
+}
+
+std::chrono::system_clock::time_point
+Level2ChunksDataProvider::Impl::GetVolumeTime(int volumeNumber)
+{
+   std::chrono::system_clock::time_point time {};
+
+   std::vector<ObjectInfo> chunks =
+      self_->ListChunks(GetVolumePrefix(volumeNumber), 0);
+
+   // Keys are ordered by time, use the most recent chunk
+   if (!chunks.empty())
+   {
+      time = GetTimePointFromKey(chunks.back().key_);
+   }
+
+   return time;
+}
+
+std::optional<Level2ChunksDataProvider::Impl::ChunkInfo>
+Level2ChunksDataProvider::Impl::FindStartChunk(
+   const std::string&                    prefix,
+   std::chrono::system_clock::time_point previousVolumeTime)
+{
+   std::optional<ChunkInfo> startChunk {};
+
+   for (const ObjectInfo& chunk : self_->ListChunks(prefix, 0))
+   {
+      auto chunkInfo = ParseChunkKey(chunk.key_);
+
+      if (chunkInfo.has_value() && chunkInfo->chunkType_ == 'S' &&
+          chunkInfo->time_ > previousVolumeTime)
+      {
+         startChunk = chunkInfo;
+      }
+   }
+
+   return startChunk;
+}
+
+bool Level2ChunksDataProvider::Impl::LoadChunk(VolumeRecord&     volume,
+                                               const ObjectInfo& chunk,
+                                               bool              final)
+{
+   logger_->debug("Loading chunk: {}", chunk.key_);
+
+   std::shared_ptr<std::istream> is = self_->GetChunk(chunk.key_);
+
+   if (is == nullptr || !volume.file_->LoadChunk(*is, final))
+   {
+      logger_->warn("Could not load chunk: \"{}\"", chunk.key_);
+      return false;
+   }
+
+   ++volume.chunksLoaded_;
+   volume.complete_ = final;
+
+   UpdateMetadata(chunk.lastModified_);
+
+   return true;
+}
+
+bool Level2ChunksDataProvider::Impl::LoadVolumeChunks(VolumeRecord& volume)
+{
+   bool chunksLoaded = false;
+
+   std::vector<ObjectInfo> chunks =
+      self_->ListChunks(GetVolumePrefix(volume.volumeNumber_), 0);
+
+   for (const ObjectInfo& chunk : chunks)
+   {
+      auto chunkInfo = ParseChunkKey(chunk.key_);
+
+      if (!chunkInfo.has_value() || chunkInfo->volumeKey_ != volume.key_ ||
+          chunkInfo->chunkNumber_ <= volume.chunksLoaded_)
+      {
+         // Skip chunks from other volumes, and chunks already loaded
+         continue;
+      }
+
+      if (chunkInfo->chunkNumber_ != volume.chunksLoaded_ + 1)
+      {
+         // Chunks must be loaded in order, wait for the missing chunk
+         logger_->debug("Waiting for chunk {} of {}",
+                        volume.chunksLoaded_ + 1,
+                        volume.key_);
+         break;
+      }
+
+      if (!LoadChunk(volume, chunk, chunkInfo->chunkType_ == 'E'))
+      {
+         break;
+      }
+
+      chunksLoaded = true;
+
+      if (volume.complete_)
+      {
+         logger_->debug("Volume complete: {}", volume.key_);
+         break;
+      }
+   }
+
+   return chunksLoaded;
+}
+
+bool Level2ChunksDataProvider::Impl::NextVolumeStarted(
+   const VolumeRecord& volume)
+{
+   const int nextVolumeNumber = volume.volumeNumber_ % kMaxVolumeNumber_ + 1;
+
+   return GetVolumeTime(nextVolumeNumber) > volume.time_;
+}
+
+void Level2ChunksDataProvider::Impl::PruneVolumes()
+{
+   std::unique_lock lock(volumesMutex_);
+
+   while (volumes_.size() > kMaxVolumes_)
+   {
+      volumes_.erase(volumes_.begin());
+   }
+}
+
+void Level2ChunksDataProvider::Impl::UpdateMetadata(
+   std::chrono::system_clock::time_point lastModified)
+{
+   if (lastModified_ != std::chrono::system_clock::time_point {} &&
+       lastModified > lastModified_)
+   {
+      updatePeriod_ = std::chrono::duration_cast<std::chrono::seconds>(
+         lastModified - lastModified_);
+   }
+
+   lastModified_ = std::max(lastModified_, lastModified);
+}
+
+std::optional<Level2ChunksDataProvider::Impl::ChunkInfo>
+Level2ChunksDataProvider::Impl::ParseChunkKey(const std::string& key)
+{
+   // Key format is SITE/VVV/YYYYMMDD-HHMMSS-CCC-T
+   const std::size_t lastSeparator = key.rfind('/');
+   const std::string filename = (lastSeparator == std::string::npos) ?
+                                   key :
+                                   key.substr(lastSeparator + 1);
+
+   std::vector<std::string> tokens {};
+   boost::split(tokens, filename, [](char c) { return c == '-'; });
+
+   if (tokens.size() != 4 || tokens[3].size() != 1)
+   {
+      logger_->trace("Invalid chunk key: \"{}\"", key);
+      return std::nullopt;
+   }
+
+   auto chunkNumber = util::TryParseNumeric<std::uint16_t>(tokens[2]);
+   if (!chunkNumber.has_value())
+   {
+      logger_->trace("Invalid chunk number: \"{}\"", key);
+      return std::nullopt;
+   }
+
+   ChunkInfo chunkInfo {};
+   chunkInfo.volumeKey_   = key.substr(0, key.size() - tokens[2].size() - 3);
+   chunkInfo.time_        = GetTimePointFromKey(key);
+   chunkInfo.chunkNumber_ = chunkNumber.value();
+   chunkInfo.chunkType_   = tokens[3].front();
+
+   return chunkInfo;
+}
+
+} // namespace provider
+} // namespace scwx
@@ -0,0 +1,118 @@
+#include <scwx/provider/local_level2_chunks_data_provider.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace scwx
+{
+namespace provider
+{
+
+static const std::string logPrefix_ =
+   "scwx::provider::local_level2_chunks_data_provider";
+static const auto logger_ = util::Logger::Create(logPrefix_);
+
+class LocalLevel2ChunksDataProvider::Impl
+{
+public:
+   explicit Impl(const std::string& directory) : directory_ {directory} {}
+
+   ~Impl() {}
+
+   std::filesystem::path directory_;
+};
+
+LocalLevel2ChunksDataProvider::LocalLevel2ChunksDataProvider(
+   const std::string& radarSite, const std::string& directory) :
+    Level2ChunksDataProvider(radarSite), p(std::make_unique<Impl>(directory))
+{
+}
+LocalLevel2ChunksDataProvider::~LocalLevel2ChunksDataProvider() = default;
+
+LocalLevel2ChunksDataProvider::LocalLevel2ChunksDataProvider(
+   LocalLevel2ChunksDataProvider&&) noexcept = default;
+LocalLevel2ChunksDataProvider& LocalLevel2ChunksDataProvider::operator=(
+   LocalLevel2ChunksDataProvider&&) noexcept = default;
+
+std::vector<std::string>
+LocalLevel2ChunksDataProvider::ListPrefixes(const std::string& prefix)
+{
+   std::vector<std::string> prefixes {};
+   std::error_code          error {};
+
+   for (auto& entry :
+        std::filesystem::directory_iterator(p->directory_ / prefix, error))
+   {
+      if (entry.is_directory())
+      {
+         prefixes.push_back(prefix + entry.path().filename().string() + "/");
+      }
+   }
+
+   if (error)
+   {
+      logger_->warn("Could not list prefixes: {}", error.message());
+   }
+
+   return prefixes;
+}
+
+std::vector<LocalLevel2ChunksDataProvider::ObjectInfo>
+LocalLevel2ChunksDataProvider::ListChunks(const std::string& prefix,
+                                          std::size_t        maxKeys)
+{
+   std::vector<ObjectInfo> chunks {};
+   std::error_code         error {};
+
+   for (auto& entry :
+        std::filesystem::directory_iterator(p->directory_ / prefix, error))
+   {
+      if (entry.is_regular_file())
+      {
+         auto lastModified = std::chrono::time_point_cast<
+            std::chrono::system_clock::duration>(
+            std::chrono::file_clock::to_sys(entry.last_write_time()));
+
+         chunks.push_back(
+            {prefix + entry.path().filename().string(), lastModified});
+      }
+   }
+
+   if (error)
+   {
+      logger_->warn("Could not list chunks: {}", error.message());
+   }
+
+   // Directory iteration order is unspecified
+   std::sort(chunks.begin(),
+             chunks.end(),
+             [](const ObjectInfo& a, const ObjectInfo& b)
+             { return a.key_ < b.key_; });
+
+   if (maxKeys > 0 && chunks.size() > maxKeys)
+   {
+      chunks.resize(maxKeys);
+   }
+
+   return chunks;
+}
+
+std::shared_ptr<std::istream>
+LocalLevel2ChunksDataProvider::GetChunk(const std::string& key)
+{
+   auto is = std::make_shared<std::ifstream>(
+      p->directory_ / key, std::ios_base::in | std::ios_base::binary);
+
+   if (!is->good())
+   {
+      logger_->warn("Could not open chunk for reading: {}", key);
+      is = nullptr;
+   }
+
+   return is;
+}
+
+} // namespace provider
+} // namespace scwx
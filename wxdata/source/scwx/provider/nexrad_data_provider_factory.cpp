@@ -1,6 +1,8 @@
 #include <scwx/provider/nexrad_data_provider_factory.hpp>
+#include <scwx/provider/aws_level2_chunks_data_provider.hpp>
 #include <scwx/provider/aws_level2_data_provider.hpp>
 #include <scwx/provider/aws_level3_data_provider.hpp>
+#include <scwx/provider/local_level2_chunks_data_provider.hpp>
 
 namespace scwx
 {
@@ -17,6 +19,19 @@ NexradDataProviderFactory::CreateLevel2DataProvider(
    return std::make_unique<AwsLevel2DataProvider>(radarSite);
 }
 
+std::shared_ptr<NexradDataProvider>
+NexradDataProviderFactory::CreateLevel2ChunksDataProvider(
+   const std::string& radarSite, const std::string& directory)
+{
+   if (!directory.empty())
+   {
+      return std::make_unique<LocalLevel2ChunksDataProvider>(radarSite,
+                                                             directory);
+   }
+
+   return std::make_unique<AwsLevel2ChunksDataProvider>(radarSite);
+}
+
 std::shared_ptr<NexradDataProvider>
 NexradDataProviderFactory::CreateLevel3DataProvider(
    const std::string& radarSite, const std::string& product)
@@ -0,0 +1,154 @@
+#include <scwx/util/azimuth_lookup.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace scwx
+{
+namespace util
+{
+
+static constexpr std::uint32_t kInvalidRadial_ =
+   std::numeric_limits<std::uint32_t>::max();
+
+class AzimuthLookup::Impl
+{
+public:
+   explicit Impl(std::span<const float> startAngles, float resolution) :
+       startAngles_(startAngles.begin(), startAngles.end()),
+       resolution_ {resolution}
+   {
+   }
+   ~Impl() = default;
+
+   void BuildTable();
+   bool Contains(std::size_t radial, double azimuth) const;
+
+   std::vector<float>         startAngles_;
+   double                     resolution_;
+   std::vector<std::uint32_t> table_ {};
+};
+
+AzimuthLookup::AzimuthLookup(std::span<const float> startAngles,
+                             float                  resolution) :
+    p(std::make_unique<Impl>(startAngles, resolution))
+{
+   p->BuildTable();
+}
+AzimuthLookup::~AzimuthLookup() = default;
+
+AzimuthLookup::AzimuthLookup(AzimuthLookup&&) noexcept            = default;
+AzimuthLookup& AzimuthLookup::operator=(AzimuthLookup&&) noexcept = default;
+
+void AzimuthLookup::Impl::BuildTable()
+{
+   const std::size_t numRadials = startAngles_.size();
+   const std::size_t numCells =
+      static_cast<std::size_t>(std::ceil(360.0 / resolution_));
+
+   table_.assign(numCells, kInvalidRadial_);
+
+   if (numRadials == 0)
+   {
+      return;
+   }
+
+   // Start angles must increase around the circle, wrapping at most once. If
+   // they do not, radials may overlap, and are found by scanning each radial.
+   std::size_t wraps = 0;
+   for (std::size_t radial = 0; radial < numRadials; ++radial)
+   {
+      if (startAngles_[(radial + 1) % numRadials] <= startAngles_[radial])
+      {
+         ++wraps;
+      }
+   }
+
+   if (wraps > 1)
+   {
+      return;
+   }
+
+   // Assign each radial to the cells whose start it contains. Each cell is
+   // visited once.
+   for (std::size_t radial = 0; radial < numRadials; ++radial)
+   {
+      std::size_t cell = static_cast<std::size_t>(
+                            std::ceil(startAngles_[radial] / resolution_)) %
+                         numCells;
+
+      for (std::size_t i = 0;
+           i < numCells && Contains(radial, cell * resolution_);
+           ++i)
+      {
+         table_[cell] = static_cast<std::uint32_t>(radial);
+         cell         = (cell + 1) % numCells;
+      }
+   }
+}
+
+bool AzimuthLookup::Impl::Contains(std::size_t radial, double azimuth) const
+{
+   const double startAngle = startAngles_[radial];
+   const double nextAngle  = startAngles_[(radial + 1) % startAngles_.size()];
+
+   if (startAngle < nextAngle)
+   {
+      return startAngle <= azimuth && azimuth < nextAngle;
+   }
+
+   // If the radial crosses 0/360 degrees, special handling is needed
+   return startAngle <= azimuth || azimuth < nextAngle;
+}
+
+std::size_t AzimuthLookup::radial_count() const
+{
+   return p->startAngles_.size();
+}
+
+std::optional<std::size_t> AzimuthLookup::FindRadial(double azimuth) const
+{
+   const std::size_t numRadials = p->startAngles_.size();
+
+   if (numRadials == 0 || !std::isfinite(azimuth))
+   {
+      return std::nullopt;
+   }
+
+   azimuth = std::fmod(azimuth, 360.0);
+   if (azimuth < 0.0)
+   {
+      azimuth += 360.0;
+   }
+
+   const std::size_t cell =
+      std::min(static_cast<std::size_t>(azimuth / p->resolution_),
+               p->table_.size() - 1u);
+
+   std::size_t radial = p->table_[cell];
+
+   if (radial == kInvalidRadial_)
+   {
+      // The start angles are not ordered, so scan each radial
+      radial = 0u;
+   }
+
+   // The cell may contain the start of one or more following radials
+   for (std::size_t i = 0; i < numRadials; ++i)
+   {
+      if (p->Contains(radial, azimuth))
+      {
+         return radial;
+      }
+
+      radial = (radial + 1) % numRadials;
+   }
+
+   return std::nullopt;
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,177 @@
+#include <scwx/util/inflate.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include <zlib.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::inflate";
+static const auto        logger_    = Logger::Create(logPrefix_);
+
+static constexpr std::size_t kMinOutputSize_       = 16u * 1024u;
+static constexpr std::size_t kCompressionRatio_    = 4u;
+static constexpr std::size_t kMaxCompressionRatio_ = 1032u;
+
+static constexpr int kZlibWindowBits_ = 15;
+static constexpr int kGzipWindowBits_ = 15 + 16;
+
+static bool        IsMemberStart(std::span<const char> input,
+                                 InflateFormat         format);
+static std::size_t EstimateOutputSize(std::span<const char> input,
+                                      InflateFormat         format);
+
+std::optional<std::size_t> Inflate(std::span<const char> input,
+                                   InflateFormat         format,
+                                   std::vector<char>&    output)
+{
+   static constexpr std::size_t kMaxAvail =
+      std::numeric_limits<uInt>::max();
+
+   z_stream stream {};
+
+   if (inflateInit2(&stream,
+                    (format == InflateFormat::Gzip) ? kGzipWindowBits_ :
+                                                      kZlibWindowBits_) != Z_OK)
+   {
+      logger_->warn("Could not initialize inflate");
+      return std::nullopt;
+   }
+
+   std::size_t bytesConsumed = 0;
+   std::size_t bytesProduced = 0;
+   bool        dataValid     = true;
+
+   output.resize(EstimateOutputSize(input, format));
+
+   while (true)
+   {
+      if (bytesProduced == output.size())
+      {
+         // Grow the output buffer geometrically
+         output.resize(output.size() * 2);
+      }
+
+      const std::size_t availIn =
+         std::min(input.size() - bytesConsumed, kMaxAvail);
+      const std::size_t availOut =
+         std::min(output.size() - bytesProduced, kMaxAvail);
+
+      // zlib does not modify the input, despite the non-const pointer
+      stream.next_in = reinterpret_cast<Bytef*>(
+         const_cast<char*>(input.data() + bytesConsumed));
+      stream.avail_in = static_cast<uInt>(availIn);
+      stream.next_out =
+         reinterpret_cast<Bytef*>(output.data() + bytesProduced);
+      stream.avail_out = static_cast<uInt>(availOut);
+
+      int status = inflate(&stream, Z_NO_FLUSH);
+
+      bytesConsumed += availIn - stream.avail_in;
+      bytesProduced += availOut - stream.avail_out;
+
+      if (status == Z_STREAM_END)
+      {
+         // Inflate the next member into the same buffer, if present
+         if (IsMemberStart(input.subspan(bytesConsumed), format) &&
+             inflateReset(&stream) == Z_OK)
+         {
+            continue;
+         }
+         break;
+      }
+      else if (status == Z_OK || status == Z_BUF_ERROR)
+      {
+         if (stream.avail_out == 0)
+         {
+            // More output space is required
+            continue;
+         }
+         if (bytesConsumed == input.size())
+         {
+            // The compressed data is truncated, keep the data inflated so far
+            logger_->debug("Compressed data ended before the end of stream");
+            break;
+         }
+         if (status == Z_BUF_ERROR)
+         {
+            logger_->warn("Inflate made no progress");
+            dataValid = false;
+            break;
+         }
+      }
+      else
+      {
+         logger_->warn("Error inflating data: {}",
+                       (stream.msg != nullptr) ? stream.msg : "unknown");
+         dataValid = false;
+         break;
+      }
+   }
+
+   inflateEnd(&stream);
+
+   if (!dataValid)
+   {
+      output.clear();
+      return std::nullopt;
+   }
+
+   output.resize(bytesProduced);
+
+   logger_->trace(
+      "Inflated {} bytes into {} bytes", bytesConsumed, bytesProduced);
+
+   return bytesConsumed;
+}
+
+static bool IsMemberStart(std::span<const char> input, InflateFormat format)
+{
+   if (format == InflateFormat::Gzip)
+   {
+      return input.size() >= 2 &&
+             static_cast<std::uint8_t>(input[0]) == 0x1f &&
+             static_cast<std::uint8_t>(input[1]) == 0x8b;
+   }
+
+   return input.size() >= 1 && static_cast<std::uint8_t>(input[0]) == 0x78;
+}
+
+static std::size_t EstimateOutputSize(std::span<const char> input,
+                                      InflateFormat         format)
+{
+   std::size_t outputSize =
+      std::max(input.size() * kCompressionRatio_, kMinOutputSize_);
+
+   // The gzip trailer contains the size of the uncompressed data (modulo 2^32)
+   // of the last member, which is exact for single member data
+   if (format == InflateFormat::Gzip && input.size() >= 18)
+   {
+      const auto* trailer = reinterpret_cast<const std::uint8_t*>(
+         input.data() + input.size() - 4);
+      const std::size_t uncompressedSize =
+         static_cast<std::size_t>(trailer[0]) |
+         (static_cast<std::size_t>(trailer[1]) << 8) |
+         (static_cast<std::size_t>(trailer[2]) << 16) |
+         (static_cast<std::size_t>(trailer[3]) << 24);
+
+      if (uncompressedSize > 0 &&
+          uncompressedSize <= input.size() * kMaxCompressionRatio_)
+      {
+         // Reserve an extra byte, so the end of stream is reached without
+         // growing the buffer
+         outputSize = uncompressedSize + 1;
+      }
+   }
+
+   return outputSize;
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,56 @@
+#include <scwx/util/mapped_file.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::mapped_file";
+static const auto        logger_    = Logger::Create(logPrefix_);
+
+class MappedFile::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() = default;
+
+   boost::iostreams::mapped_file_source file_ {};
+};
+
+MappedFile::MappedFile(const std::string& filename) :
+    p(std::make_unique<Impl>())
+{
+   try
+   {
+      p->file_.open(filename);
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->debug("Could not map file: {} ({})", filename, ex.what());
+   }
+}
+MappedFile::~MappedFile() = default;
+
+MappedFile::MappedFile(MappedFile&&) noexcept            = default;
+MappedFile& MappedFile::operator=(MappedFile&&) noexcept = default;
+
+bool MappedFile::is_open() const
+{
+   return p->file_.is_open();
+}
+
+std::span<const char> MappedFile::data() const
+{
+   if (!p->file_.is_open())
+   {
+      return {};
+   }
+
+   return {p->file_.data(), p->file_.size()};
+}
+
+} // namespace util
+} // namespace scwx
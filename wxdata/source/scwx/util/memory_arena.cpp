@@ -0,0 +1,69 @@
+#include <scwx/util/memory_arena.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+namespace scwx
+{
+namespace util
+{
+
+class MemoryArena::Impl
+{
+public:
+   explicit Impl(std::size_t initialSize) :
+       resource_ {std::max<std::size_t>(initialSize, 1u)}
+   {
+   }
+   ~Impl() = default;
+
+   std::pmr::monotonic_buffer_resource resource_;
+   std::mutex                          mutex_ {};
+
+   std::size_t allocationCount_ {0};
+   std::size_t bytesAllocated_ {0};
+};
+
+MemoryArena::MemoryArena(std::size_t initialSize) :
+    p(std::make_unique<Impl>(initialSize))
+{
+}
+MemoryArena::~MemoryArena() = default;
+
+std::size_t MemoryArena::allocation_count() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->allocationCount_;
+}
+
+std::size_t MemoryArena::bytes_allocated() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->bytesAllocated_;
+}
+
+void* MemoryArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+   std::unique_lock lock {p->mutex_};
+
+   ++p->allocationCount_;
+   p->bytesAllocated_ += bytes;
+
+   return p->resource_.allocate(bytes, alignment);
+}
+
+void MemoryArena::do_deallocate(void* /* p */,
+                                std::size_t /* bytes */,
+                                std::size_t /* alignment */)
+{
+   // Memory is released when the arena is destroyed
+}
+
+bool MemoryArena::do_is_equal(
+   const std::pmr::memory_resource& other) const noexcept
+{
+   return this == &other;
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,69 @@
+#include <scwx/util/run_length.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace scwx
+{
+namespace util
+{
+
+// Each block store writes a full run, as runs are at most 15 bins
+static constexpr std::size_t kBlockSize_ = 16u;
+
+std::size_t GetRunLengthBinCount(std::span<const std::uint8_t> data)
+{
+   std::size_t binCount = 0;
+
+   for (std::uint8_t value : data)
+   {
+      binCount += value >> 4;
+   }
+
+   return binCount;
+}
+
+std::size_t DecodeRunLength(std::span<const std::uint8_t> data,
+                            std::span<std::uint8_t>       levels)
+{
+   std::uint8_t*     output = levels.data();
+   const std::size_t size   = levels.size();
+   std::size_t       bin    = 0;
+
+   auto it = data.begin();
+
+   // While a full block remains in the level array, store a block of the level,
+   // and advance by the run. The excess bins of the block are overwritten by
+   // subsequent runs.
+   for (; it != data.end() && bin + kBlockSize_ <= size; ++it)
+   {
+      const std::uint8_t  run     = *it >> 4;
+      const std::uint64_t pattern = (*it & 0x0fu) * 0x0101010101010101ull;
+
+      std::memcpy(output + bin, &pattern, sizeof(pattern));
+      std::memcpy(output + bin + sizeof(pattern), &pattern, sizeof(pattern));
+
+      bin += run;
+   }
+
+   // Write the remaining runs, bounded by the size of the level array
+   for (; it != data.end() && bin < size; ++it)
+   {
+      const std::size_t  run   = std::min<std::size_t>(*it >> 4, size - bin);
+      const std::uint8_t level = *it & 0x0fu;
+
+      std::memset(output + bin, level, run);
+
+      bin += run;
+   }
+
+   // Clear any excess bins of the final block, and any bins not encoded
+   std::fill(levels.begin() + static_cast<std::ptrdiff_t>(bin),
+             levels.end(),
+             std::uint8_t {0});
+
+   return bin;
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,65 @@
+#include <scwx/util/spanbuf.hpp>
+
+namespace scwx
+{
+namespace util
+{
+
+spanbuf::spanbuf(std::span<const char> data)
+{
+   // The get area is never written to, as the buffer does not support putback
+   // of a character which differs from the data
+   char* begin = const_cast<char*>(data.data());
+   setg(begin, begin, begin + data.size());
+}
+
+std::span<const char> spanbuf::unread_data() const
+{
+   return {gptr(), egptr()};
+}
+
+spanbuf::pos_type spanbuf::seekoff(std::streamoff          off,
+                                   std::ios_base::seekdir  way,
+                                   std::ios_base::openmode which)
+{
+   if ((which & std::ios_base::out) || !(which & std::ios_base::in))
+   {
+      return pos_type(off_type(-1));
+   }
+
+   off_type newOffset;
+
+   switch (way)
+   {
+   case std::ios_base::beg:
+      newOffset = 0;
+      break;
+   case std::ios_base::cur:
+      newOffset = gptr() - eback();
+      break;
+   case std::ios_base::end:
+      newOffset = egptr() - eback();
+      break;
+   default:
+      return pos_type(off_type(-1));
+   }
+
+   newOffset += off;
+
+   if (newOffset < 0 || newOffset > egptr() - eback())
+   {
+      return pos_type(off_type(-1));
+   }
+
+   setg(eback(), eback() + newOffset, egptr());
+
+   return pos_type(newOffset);
+}
+
+spanbuf::pos_type spanbuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+   return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+} // namespace util
+} // namespace scwx
@@ -1,4 +1,6 @@
 #include <scwx/util/streams.hpp>
+#include <scwx/util/spanbuf.hpp>
+#include <scwx/util/vectorbuf.hpp>
 
 namespace scwx
 {
@@ -42,5 +44,19 @@ std::istream& getline(std::istream& is, std::string& t)
    }
 }
 
+std::optional<std::span<const char>> GetUnreadData(std::istream& is)
+{
+   if (auto buffer = dynamic_cast<spanbuf*>(is.rdbuf()); buffer != nullptr)
+   {
+      return buffer->unread_data();
+   }
+   if (auto buffer = dynamic_cast<vectorbuf*>(is.rdbuf()); buffer != nullptr)
+   {
+      return buffer->unread_data();
+   }
+
+   return std::nullopt;
+}
+
 } // namespace util
 } // namespace scwx
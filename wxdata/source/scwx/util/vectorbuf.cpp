@@ -15,6 +15,11 @@ void vectorbuf::update_read_pointers(size_t size)
    setg(v_.data(), v_.data(), v_.data() + size);
 }
 
+std::span<const char> vectorbuf::unread_data() const
+{
+   return {gptr(), egptr()};
+}
+
 vectorbuf::pos_type vectorbuf::seekoff(std::streamoff          off,
                                        std::ios_base::seekdir  way,
                                        std::ios_base::openmode which)
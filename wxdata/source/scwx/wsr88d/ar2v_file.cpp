@@ -2,12 +2,22 @@
 #include <scwx/wsr88d/rda/digital_radar_data.hpp>
 #include <scwx/wsr88d/rda/level2_message_factory.hpp>
 #include <scwx/wsr88d/rda/rda_types.hpp>
+#include <scwx/util/big_endian_reader.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/rangebuf.hpp>
+#include <scwx/util/mapped_file.hpp>
+#include <scwx/util/spanbuf.hpp>
+#include <scwx/util/streams.hpp>
 #include <scwx/util/time.hpp>
+#include <scwx/util/vectorbuf.hpp>
 
+#include <algorithm>
 #include <fstream>
-#include <sstream>
+#include <future>
+#include <limits>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <thread>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -20,7 +30,11 @@
 #endif
 
 #include <boost/algorithm/string/trim.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/filtering_streambuf.hpp>
 #include <boost/iostreams/filter/bzip2.hpp>
 
@@ -40,18 +54,44 @@ namespace wsr88d
 static const std::string logPrefix_ = "scwx::wsr88d::ar2v_file";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static constexpr float kElevationScaleFactor_ = 8.0f / 0.043945f;
+
+// Fewer records (e.g., a real-time chunk) are decompressed on the calling thread
+static constexpr std::size_t kMinParallelRecords_ = 4u;
+
+static boost::asio::thread_pool& DecompressionThreadPool()
+{
+   // Shared by every file, so a thread pool is not created for each load
+   static boost::asio::thread_pool threadPool {
+      std::max(1u, std::thread::hardware_concurrency())};
+   return threadPool;
+}
+
 class Ar2vFileImpl
 {
 public:
    explicit Ar2vFileImpl() {};
    ~Ar2vFileImpl() = default;
 
-   std::size_t DecompressLDMRecords(std::istream& is);
-   void        HandleMessage(std::shared_ptr<rda::Level2Message>& message);
-   void        IndexFile();
-   void        ParseLDMRecords();
-   void        ParseLDMRecord(std::istream& is);
+   void HandleMessage(std::shared_ptr<rda::Level2Message>& message);
+   std::optional<std::uint16_t>
+   IndexElevationScan(std::uint16_t elevationIndex,
+                      const std::shared_ptr<rda::FlatElevationScan>& flatScan);
+   void LoadLDMRecords(std::istream& is);
+   void ParseLDMRecords(
+      const std::vector<std::span<const char>>& compressedRecords);
+   void ParseLDMRecord(std::istream&                             is,
+                       const std::shared_ptr<std::vector<char>>& record);
    void ProcessRadarData(const std::shared_ptr<rda::GenericRadarData>& message);
+   void PublishElevationScan(std::uint16_t elevationIndex);
+   void PublishElevationScans();
+   bool ReadVolumeHeader(std::istream& is);
+
+   static std::shared_ptr<std::vector<char>>
+   DecompressLDMRecord(std::span<const char> compressedRecord);
+   static std::vector<std::span<const char>>
+   FindLDMRecords(std::istream& is, std::span<const char> data);
+   static std::vector<std::vector<char>> ReadLDMRecords(std::istream& is);
 
    std::string   tapeFilename_ {};
    std::string   extensionNumber_ {};
@@ -61,14 +101,38 @@ public:
 
    std::size_t messageCount_ {0};
 
+   bool retainRecordBuffers_ {false};
+   bool lazyMomentDecoding_ {false};
+   bool useMemoryArena_ {true};
+
+   // Radar data of the volume is allocated from a single arena, which is
+   // released once the file and all of its radar data have been released
+   std::shared_ptr<util::MemoryArena> memoryArena_ {nullptr};
+
+   Ar2vFile::ElevationScanCallbackFunction elevationScanCallback_ {nullptr};
+
    std::shared_ptr<rda::VolumeCoveragePatternData>              vcpData_ {};
    std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>> radarData_ {};
 
+   // Flat elevation scans, indexed by data block type, elevation angle and
+   // collection time. Repeated cuts (e.g., SAILS, MESO-SAILS) of the same
+   // elevation angle are indexed separately.
    std::map<rda::DataBlockType,
-            std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>>
+            std::map<std::uint16_t,
+                     std::map<std::chrono::system_clock::time_point,
+                              std::shared_ptr<rda::FlatElevationScan>>>>
       index_ {};
 
-   std::list<std::stringstream> rawRecords_ {};
+   // Collection time of the most recent radial published
+   std::chrono::system_clock::time_point endTime_ {};
+
+   // Elevation scans which are still receiving radials. Scans are moved into
+   // radarData_ once complete, and are not modified afterward.
+   std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>
+      pendingScans_ {};
+
+   // Protects published data, which may be accessed while loading
+   mutable std::shared_mutex dataMutex_ {};
 };
 
 Ar2vFile::Ar2vFile() : p(std::make_unique<Ar2vFileImpl>()) {}
@@ -97,54 +161,117 @@ std::size_t Ar2vFile::message_count() const
    return p->messageCount_;
 }
 
-std::chrono::system_clock::time_point Ar2vFile::start_time() const
+bool Ar2vFile::retain_record_buffers() const
 {
-   return util::TimePoint(p->julianDate_, p->milliseconds_);
+   return p->retainRecordBuffers_;
 }
 
-std::chrono::system_clock::time_point Ar2vFile::end_time() const
+bool Ar2vFile::lazy_moment_decoding() const
 {
-   std::chrono::system_clock::time_point endTime {};
+   return p->lazyMomentDecoding_;
+}
 
-   if (p->radarData_.size() > 0)
-   {
-      std::shared_ptr<rda::GenericRadarData> lastRadial =
-         p->radarData_.crbegin()->second->crbegin()->second;
+bool Ar2vFile::use_memory_arena() const
+{
+   return p->useMemoryArena_;
+}
 
-      endTime = util::TimePoint(lastRadial->modified_julian_date(),
-                                lastRadial->collection_time());
-   }
+std::shared_ptr<const util::MemoryArena> Ar2vFile::memory_arena() const
+{
+   return p->memoryArena_;
+}
+
+std::chrono::system_clock::time_point Ar2vFile::start_time() const
+{
+   return util::TimePoint(p->julianDate_, p->milliseconds_);
+}
 
-   return endTime;
+std::chrono::system_clock::time_point Ar2vFile::end_time() const
+{
+   std::shared_lock lock {p->dataMutex_};
+   return p->endTime_;
 }
 
 std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>
 Ar2vFile::radar_data() const
 {
+   std::shared_lock lock {p->dataMutex_};
    return p->radarData_;
 }
 
 std::shared_ptr<const rda::VolumeCoveragePatternData> Ar2vFile::vcp_data() const
 {
+   std::shared_lock lock {p->dataMutex_};
    return p->vcpData_;
 }
 
+static std::shared_ptr<rda::FlatElevationScan> GetNearestElevationScan(
+   const std::map<std::chrono::system_clock::time_point,
+                  std::shared_ptr<rda::FlatElevationScan>>& scans,
+   std::chrono::system_clock::time_point                    time)
+{
+   if (scans.empty())
+   {
+      return nullptr;
+   }
+
+   // If no time is requested, use the most recent scan
+   if (time == std::chrono::system_clock::time_point {})
+   {
+      return scans.crbegin()->second;
+   }
+
+   // Find the first scan collected at or after the time requested
+   auto it = scans.lower_bound(time);
+
+   if (it == scans.cend())
+   {
+      return scans.crbegin()->second;
+   }
+   else if (it == scans.cbegin())
+   {
+      return it->second;
+   }
+
+   // Select the nearer of the scans on either side of the time requested
+   auto prev = std::prev(it);
+
+   return (time - prev->first <= it->first - time) ? prev->second :
+                                                     it->second;
+}
+
 std::tuple<std::shared_ptr<rda::ElevationScan>, float, std::vector<float>>
 Ar2vFile::GetElevationScan(rda::DataBlockType dataBlockType,
                            float              elevation,
-                           std::chrono::system_clock::time_point /*time*/) const
+                           std::chrono::system_clock::time_point time) const
+{
+   auto [flatScan, elevationCut, elevationCuts] =
+      GetFlatElevationScan(dataBlockType, elevation, time);
+
+   std::shared_ptr<rda::ElevationScan> elevationScan =
+      (flatScan != nullptr) ? flatScan->elevation_scan() : nullptr;
+
+   return {elevationScan, elevationCut, elevationCuts};
+}
+
+std::tuple<std::shared_ptr<rda::FlatElevationScan>, float, std::vector<float>>
+Ar2vFile::GetFlatElevationScan(rda::DataBlockType dataBlockType,
+                               float              elevation,
+                               std::chrono::system_clock::time_point time) const
 {
-   logger_->debug("GetElevationScan: {} degrees", elevation);
+   logger_->debug("GetFlatElevationScan: {} degrees", elevation);
 
-   constexpr float scaleFactor = 8.0f / 0.043945f;
+   constexpr float scaleFactor = kElevationScaleFactor_;
 
-   std::shared_ptr<rda::ElevationScan> elevationScan = nullptr;
-   float                               elevationCut  = 0.0f;
-   std::vector<float>                  elevationCuts;
+   std::shared_ptr<rda::FlatElevationScan> elevationScan = nullptr;
+   float                                   elevationCut  = 0.0f;
+   std::vector<float>                      elevationCuts;
 
    std::uint16_t codedElevation =
       static_cast<std::uint16_t>(std::lroundf(elevation * scaleFactor));
 
+   std::shared_lock lock {p->dataMutex_};
+
    if (p->index_.contains(dataBlockType))
    {
       auto& scans = p->index_.at(dataBlockType);
@@ -173,26 +300,52 @@ Ar2vFile::GetElevationScan(rda::DataBlockType dataBlockType,
          std::abs(static_cast<std::int32_t>(codedElevation) -
                   static_cast<std::int32_t>(upperBound));
 
-      if (lowerDelta < upperDelta)
-      {
-         elevationScan = scans.at(lowerBound);
-         elevationCut  = lowerBound / scaleFactor;
-      }
-      else
-      {
-         elevationScan = scans.at(upperBound);
-         elevationCut  = upperBound / scaleFactor;
-      }
+      std::uint16_t foundElevation =
+         (lowerDelta < upperDelta) ? lowerBound : upperBound;
+
+      elevationScan = GetNearestElevationScan(scans.at(foundElevation), time);
+      elevationCut  = foundElevation / scaleFactor;
    }
 
    return std::tie(elevationScan, elevationCut, elevationCuts);
 }
 
+void Ar2vFile::set_retain_record_buffers(bool retainRecordBuffers)
+{
+   p->retainRecordBuffers_ = retainRecordBuffers;
+}
+
+void Ar2vFile::set_lazy_moment_decoding(bool lazyMomentDecoding)
+{
+   p->lazyMomentDecoding_ = lazyMomentDecoding;
+}
+
+void Ar2vFile::set_use_memory_arena(bool useMemoryArena)
+{
+   p->useMemoryArena_ = useMemoryArena;
+}
+
+void Ar2vFile::SetElevationScanCallback(ElevationScanCallbackFunction callback)
+{
+   p->elevationScanCallback_ = std::move(callback);
+}
+
 bool Ar2vFile::LoadFile(const std::string& filename)
 {
    logger_->debug("LoadFile: {}", filename);
    bool fileValid = true;
 
+   // Decode directly from the mapped file if possible, falling back to reading
+   // the file through a stream
+   util::MappedFile mappedFile {filename};
+   if (mappedFile.is_open())
+   {
+      util::spanbuf fileBuffer {mappedFile.data()};
+      std::istream  is {&fileBuffer};
+
+      return LoadData(is);
+   }
+
    std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
    if (!f.good())
    {
@@ -212,61 +365,132 @@ bool Ar2vFile::LoadData(std::istream& is)
 {
    logger_->debug("Loading Data");
 
+   bool dataValid = p->ReadVolumeHeader(is);
+
+   if (dataValid)
+   {
+      p->LoadLDMRecords(is);
+   }
+
+   // Publish any elevation scans which did not end with a final radial
+   p->PublishElevationScans();
+
+   return dataValid;
+}
+
+bool Ar2vFile::LoadChunk(std::istream& is, bool finalChunk)
+{
+   logger_->debug("Loading Chunk");
+
    bool dataValid = true;
 
+   // The start chunk of a volume begins with the Volume Header Record, while
+   // subsequent chunks contain only LDM records
+   std::string    tapeFilename(4, ' ');
+   std::streampos startPosition = is.tellg();
+
+   is.read(&tapeFilename[0], 4);
+   is.seekg(startPosition, std::ios_base::beg);
+
+   if (tapeFilename == "AR2V")
+   {
+      dataValid = p->ReadVolumeHeader(is);
+   }
+
+   if (dataValid)
+   {
+      p->LoadLDMRecords(is);
+   }
+
+   if (finalChunk)
+   {
+      // Publish any elevation scans which did not end with a final radial
+      p->PublishElevationScans();
+   }
+
+   return dataValid;
+}
+
+bool Ar2vFileImpl::ReadVolumeHeader(std::istream& is)
+{
+   bool headerValid = true;
+
    // Read Volume Header Record
-   p->tapeFilename_.resize(9, ' ');
-   p->extensionNumber_.resize(3, ' ');
-   p->icao_.resize(4, ' ');
+   tapeFilename_.resize(9, ' ');
+   extensionNumber_.resize(3, ' ');
+   icao_.resize(4, ' ');
 
-   is.read(&p->tapeFilename_[0], 9);
-   is.read(&p->extensionNumber_[0], 3);
-   is.read(reinterpret_cast<char*>(&p->julianDate_), 4);
-   is.read(reinterpret_cast<char*>(&p->milliseconds_), 4);
-   is.read(&p->icao_[0], 4);
+   is.read(&tapeFilename_[0], 9);
+   is.read(&extensionNumber_[0], 3);
+   is.read(reinterpret_cast<char*>(&julianDate_), 4);
+   is.read(reinterpret_cast<char*>(&milliseconds_), 4);
+   is.read(&icao_[0], 4);
 
-   p->julianDate_   = ntohl(p->julianDate_);
-   p->milliseconds_ = ntohl(p->milliseconds_);
+   julianDate_   = ntohl(julianDate_);
+   milliseconds_ = ntohl(milliseconds_);
 
    if (is.eof())
    {
       logger_->warn("Could not read Volume Header Record");
-      dataValid = false;
+      headerValid = false;
    }
 
    // Trim spaces and null characters from the end of the ICAO
-   boost::trim_right_if(p->icao_,
+   boost::trim_right_if(icao_,
                         [](char x) { return std::isspace(x) || x == '\0'; });
 
-   if (dataValid)
+   if (headerValid)
    {
-      logger_->debug("Filename:  {}", p->tapeFilename_);
-      logger_->debug("Extension: {}", p->extensionNumber_);
-      logger_->debug("Date:      {}", p->julianDate_);
-      logger_->debug("Time:      {}", p->milliseconds_);
-      logger_->debug("ICAO:      {}", p->icao_);
+      logger_->debug("Filename:  {}", tapeFilename_);
+      logger_->debug("Extension: {}", extensionNumber_);
+      logger_->debug("Date:      {}", julianDate_);
+      logger_->debug("Time:      {}", milliseconds_);
+      logger_->debug("ICAO:      {}", icao_);
+   }
 
-      size_t decompressedRecords = p->DecompressLDMRecords(is);
-      if (decompressedRecords == 0)
-      {
-         p->ParseLDMRecord(is);
-      }
-      else
-      {
-         p->ParseLDMRecords();
-      }
+   return headerValid;
+}
+
+void Ar2vFileImpl::LoadLDMRecords(std::istream& is)
+{
+   if (useMemoryArena_ && memoryArena_ == nullptr)
+   {
+      memoryArena_ = std::make_shared<util::MemoryArena>();
    }
 
-   p->IndexFile();
+   // If the stream is backed by memory (e.g., a memory mapped file), compressed
+   // records are decompressed in place. Otherwise, each compressed record is
+   // read into memory.
+   std::vector<std::vector<char>>     recordBuffers {};
+   std::vector<std::span<const char>> compressedRecords {};
 
-   return dataValid;
+   if (auto data = util::GetUnreadData(is); data.has_value())
+   {
+      compressedRecords = FindLDMRecords(is, *data);
+   }
+   else
+   {
+      recordBuffers = ReadLDMRecords(is);
+      compressedRecords.assign(recordBuffers.cbegin(), recordBuffers.cend());
+   }
+
+   if (compressedRecords.empty())
+   {
+      ParseLDMRecord(is, nullptr);
+   }
+   else
+   {
+      ParseLDMRecords(compressedRecords);
+   }
 }
 
-std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
+std::vector<std::vector<char>> Ar2vFileImpl::ReadLDMRecords(std::istream& is)
 {
-   logger_->debug("Decompressing LDM Records");
+   logger_->debug("Reading LDM Records");
 
-   std::size_t numRecords = 0;
+   // Read each compressed record into memory, so the records can be
+   // decompressed independently of the input stream
+   std::vector<std::vector<char>> compressedRecords {};
 
    while (is.peek() != EOF)
    {
@@ -277,7 +501,15 @@ std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
       is.read(reinterpret_cast<char*>(&controlWord), 4);
 
       controlWord = ntohl(controlWord);
-      recordSize  = std::abs(controlWord);
+
+      if (controlWord == std::numeric_limits<std::int32_t>::min())
+      {
+         logger_->warn("Invalid LDM record control word");
+         is.seekg(startPosition, std::ios_base::beg);
+         break;
+      }
+
+      recordSize = std::abs(controlWord);
 
       logger_->trace("LDM Record Found: Size = {} bytes", recordSize);
 
@@ -287,60 +519,187 @@ std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
          break;
       }
 
-      boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
-      util::rangebuf r(is.rdbuf(), recordSize);
-      in.push(boost::iostreams::bzip2_decompressor());
-      in.push(r);
+      std::vector<char>& record = compressedRecords.emplace_back(recordSize);
+      is.read(record.data(), recordSize);
+      record.resize(static_cast<std::size_t>(is.gcount()));
+   }
 
-      try
-      {
-         std::stringstream ss;
-         std::streamsize   bytesCopied = boost::iostreams::copy(in, ss);
-         logger_->trace("Decompressed record size = {} bytes", bytesCopied);
+   logger_->debug("Read {} LDM Records", compressedRecords.size());
 
-         rawRecords_.push_back(std::move(ss));
+   return compressedRecords;
+}
+
+std::vector<std::span<const char>>
+Ar2vFileImpl::FindLDMRecords(std::istream& is, std::span<const char> data)
+{
+   logger_->debug("Finding LDM Records");
+
+   // Reference each compressed record in place
+   std::vector<std::span<const char>> compressedRecords {};
+   util::BigEndianReader              reader {data};
+
+   while (reader.remaining() > 0)
+   {
+      std::int32_t controlWord = 0;
+      std::size_t  recordSize;
+
+      if (!reader.Read(controlWord))
+      {
+         break;
       }
-      catch (const boost::iostreams::bzip2_error& ex)
+
+      if (controlWord == std::numeric_limits<std::int32_t>::min())
       {
-         logger_->warn(
-            "Error decompressing record {}: {}", numRecords, ex.what());
+         logger_->warn("Invalid LDM record control word");
+         reader.Seek(reader.position() - sizeof(controlWord));
+         break;
+      }
+
+      recordSize = std::abs(controlWord);
 
-         is.seekg(startPosition + std::streampos(recordSize),
-                  std::ios_base::beg);
+      logger_->trace("LDM Record Found: Size = {} bytes", recordSize);
+
+      if (recordSize == 0)
+      {
+         reader.Seek(reader.position() - sizeof(controlWord));
+         break;
       }
 
-      ++numRecords;
+      compressedRecords.push_back(
+         reader.ReadSpan(std::min(recordSize, reader.remaining())));
    }
 
-   logger_->debug("Decompressed {} LDM Records", numRecords);
+   // Advance the stream past the records found
+   is.seekg(static_cast<std::streamoff>(reader.position()), std::ios_base::cur);
+
+   logger_->debug("Found {} LDM Records", compressedRecords.size());
 
-   return numRecords;
+   return compressedRecords;
 }
 
-void Ar2vFileImpl::ParseLDMRecords()
+std::shared_ptr<std::vector<char>>
+Ar2vFileImpl::DecompressLDMRecord(std::span<const char> compressedRecord)
+{
+   std::shared_ptr<std::vector<char>> record {};
+
+   // Records are decompressed on worker threads. No exception may escape, so
+   // a failure only skips the record which caused it.
+   try
+   {
+      boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
+      in.push(boost::iostreams::bzip2_decompressor());
+      in.push(boost::iostreams::array_source(compressedRecord.data(),
+                                             compressedRecord.size()));
+
+      record = std::make_shared<std::vector<char>>();
+
+      std::streamsize bytesCopied =
+         boost::iostreams::copy(in, boost::iostreams::back_inserter(*record));
+      logger_->trace("Decompressed record size = {} bytes", bytesCopied);
+   }
+   catch (const boost::iostreams::bzip2_error& ex)
+   {
+      logger_->warn("Error decompressing record: {}", ex.what());
+      record = nullptr;
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->error("Unexpected error decompressing record: {}", ex.what());
+      record = nullptr;
+   }
+   catch (...)
+   {
+      logger_->error("Unknown error decompressing record");
+      record = nullptr;
+   }
+
+   return record;
+}
+
+void Ar2vFileImpl::ParseLDMRecords(
+   const std::vector<std::span<const char>>& compressedRecords)
 {
    logger_->debug("Parsing LDM Records");
 
-   std::size_t count = 0;
+   const std::size_t numRecords = compressedRecords.size();
+
+   // Decompress records in parallel. Records are parsed in order as soon as
+   // each has been decompressed, so elevation scans can be published before the
+   // remainder of the volume has been decompressed.
+   const bool parallel = numRecords >= kMinParallelRecords_;
+
+   std::vector<std::future<std::shared_ptr<std::vector<char>>>> records {};
+   records.reserve(numRecords);
+
+   for (std::span<const char> compressedRecord : compressedRecords)
+   {
+      auto task = std::make_shared<
+         std::packaged_task<std::shared_ptr<std::vector<char>>()>>(
+         [compressedRecord]()
+         { return DecompressLDMRecord(compressedRecord); });
+
+      records.push_back(task->get_future());
 
-   for (auto it = rawRecords_.begin(); it != rawRecords_.end(); it++)
+      if (parallel)
+      {
+         boost::asio::post(DecompressionThreadPool(), [task]() { (*task)(); });
+      }
+      else
+      {
+         (*task)();
+      }
+   }
+
+   try
    {
-      std::stringstream& ss = *it;
+      for (std::size_t i = 0; i < numRecords; ++i)
+      {
+         std::shared_ptr<std::vector<char>> record = records[i].get();
 
-      logger_->trace("Record {}", count++);
+         if (record == nullptr)
+         {
+            logger_->warn("Skipping record {}", i);
+            continue;
+         }
+
+         util::vectorbuf recordBuffer {*record};
+         std::istream    is {&recordBuffer};
+         recordBuffer.update_read_pointers(record->size());
 
-      ParseLDMRecord(ss);
+         logger_->trace("Record {}", i);
+
+         // If record buffers are retained, data moments reference the record
+         // buffer instead of copying its contents. Lazily decoded data moments
+         // require the record buffer to be retained.
+         const bool retainRecord = retainRecordBuffers_ || lazyMomentDecoding_;
+         ParseLDMRecord(is, retainRecord ? record : nullptr);
+      }
+   }
+   catch (...)
+   {
+      // Pending tasks reference the compressed records, which must outlive
+      // decompression
+      for (auto& record : records)
+      {
+         if (record.valid())
+         {
+            record.wait();
+         }
+      }
+      throw;
    }
 
-   rawRecords_.clear();
+   logger_->debug("Parsed {} LDM Records", numRecords);
 }
 
-void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
+void Ar2vFileImpl::ParseLDMRecord(
+   std::istream& is, const std::shared_ptr<std::vector<char>>& record)
 {
    static constexpr std::size_t kDefaultSegmentSize = 2432;
    static constexpr std::size_t kCtmHeaderSize      = 12;
 
-   auto ctx = rda::Level2MessageFactory::CreateContext();
+   auto ctx = rda::Level2MessageFactory::CreateContext(
+      record, lazyMomentDecoding_, memoryArena_);
 
    while (!is.eof() && !is.fail())
    {
@@ -405,9 +764,12 @@ void Ar2vFileImpl::HandleMessage(std::shared_ptr<rda::Level2Message>& message)
    switch (message->header().message_type())
    {
    case static_cast<std::uint8_t>(rda::MessageId::VolumeCoveragePatternData):
+   {
+      std::unique_lock lock {dataMutex_};
       vcpData_ =
          std::static_pointer_cast<rda::VolumeCoveragePatternData>(message);
       break;
+   }
 
    case static_cast<std::uint8_t>(rda::MessageId::DigitalRadarData):
    case static_cast<std::uint8_t>(rda::MessageId::DigitalRadarDataGeneric):
@@ -425,74 +787,164 @@ void Ar2vFileImpl::ProcessRadarData(
 {
    std::uint16_t azimuthIndex   = message->azimuth_number() - 1;
    std::uint16_t elevationIndex = message->elevation_number() - 1;
+   auto          radialStatus =
+      static_cast<rda::RadialStatus>(message->radial_status());
+
+   if (radialStatus == rda::RadialStatus::StartOfElevation ||
+       radialStatus == rda::RadialStatus::StartOfVolume ||
+       radialStatus == rda::RadialStatus::StartOfLastElevation)
+   {
+      // A new elevation scan has started, any other pending elevation scan is
+      // not receiving further radials
+      for (auto it = pendingScans_.begin(); it != pendingScans_.end();)
+      {
+         auto next = std::next(it);
+         if (it->first != elevationIndex)
+         {
+            PublishElevationScan(it->first);
+         }
+         it = next;
+      }
+   }
 
-   if (radarData_[elevationIndex] == nullptr)
+   std::shared_ptr<rda::ElevationScan>& elevationScan =
+      pendingScans_[elevationIndex];
+
+   if (elevationScan == nullptr)
    {
-      radarData_[elevationIndex] = std::make_shared<rda::ElevationScan>();
+      // Only the loading thread modifies radar data, so no lock is required to
+      // read it here
+      auto it = radarData_.find(elevationIndex);
+      if (it != radarData_.cend())
+      {
+         // Published elevation scans are not modified, continue the elevation
+         // scan from a copy
+         elevationScan = std::make_shared<rda::ElevationScan>(*it->second);
+      }
+      else
+      {
+         elevationScan = std::make_shared<rda::ElevationScan>();
+      }
    }
 
-   (*radarData_[elevationIndex])[azimuthIndex] = message;
+   (*elevationScan)[azimuthIndex] = message;
+
+   if (radialStatus == rda::RadialStatus::EndOfElevation ||
+       radialStatus == rda::RadialStatus::EndOfVolume)
+   {
+      PublishElevationScan(elevationIndex);
+   }
 }
 
-void Ar2vFileImpl::IndexFile()
+void Ar2vFileImpl::PublishElevationScan(std::uint16_t elevationIndex)
 {
-   logger_->debug("Indexing file");
+   auto it = pendingScans_.find(elevationIndex);
+   if (it == pendingScans_.cend())
+   {
+      return;
+   }
+
+   std::shared_ptr<rda::ElevationScan> elevationScan = std::move(it->second);
+   pendingScans_.erase(it);
+
+   logger_->debug("Publishing elevation scan {} ({} radials)",
+                  elevationIndex,
+                  elevationScan->size());
+
+   std::optional<std::uint16_t> elevationAngle {};
+
+   // Radial headers are flattened once, prior to publishing. Moment matrices
+   // are built on first access.
+   auto flatScan = std::make_shared<rda::FlatElevationScan>(elevationScan);
 
-   for (auto& elevationCut : radarData_)
    {
-      std::uint16_t     elevationAngle {};
-      rda::WaveformType waveformType = rda::WaveformType::Unknown;
+      std::unique_lock lock {dataMutex_};
 
-      std::shared_ptr<rda::GenericRadarData>& radial0 =
-         (*elevationCut.second)[0];
+      radarData_[elevationIndex] = elevationScan;
+      elevationAngle = IndexElevationScan(elevationIndex, flatScan);
+      endTime_       = std::max(endTime_, flatScan->end_time());
+   }
 
-      if (radial0 == nullptr)
-      {
-         logger_->warn("Empty radial data");
-         continue;
-      }
+   if (elevationAngle.has_value() && elevationScanCallback_ != nullptr)
+   {
+      elevationScanCallback_(elevationAngle.value() / kElevationScaleFactor_);
+   }
+}
 
-      std::shared_ptr<rda::DigitalRadarData> digitalRadarData0 = nullptr;
+void Ar2vFileImpl::PublishElevationScans()
+{
+   while (!pendingScans_.empty())
+   {
+      PublishElevationScan(pendingScans_.cbegin()->first);
+   }
+}
 
-      if (vcpData_ != nullptr)
-      {
-         elevationAngle = vcpData_->elevation_angle_raw(elevationCut.first);
-         waveformType   = vcpData_->waveform_type(elevationCut.first);
-      }
-      else if ((digitalRadarData0 =
-                   std::dynamic_pointer_cast<rda::DigitalRadarData>(
-                      (*elevationCut.second)[0])) != nullptr)
-      {
-         elevationAngle = digitalRadarData0->elevation_angle_raw();
-      }
-      else
-      {
-         // Return here, because we should only have a single message type
-         logger_->warn("Cannot index file without VCP data");
-         return;
-      }
+std::optional<std::uint16_t> Ar2vFileImpl::IndexElevationScan(
+   std::uint16_t                                  elevationIndex,
+   const std::shared_ptr<rda::FlatElevationScan>& flatScan)
+{
+   const std::shared_ptr<rda::ElevationScan> elevationScan =
+      flatScan->elevation_scan();
+
+   logger_->debug("Indexing elevation scan {}", elevationIndex);
+
+   std::uint16_t     elevationAngle {};
+   rda::WaveformType waveformType = rda::WaveformType::Unknown;
+
+   auto radial0It = elevationScan->find(0);
+
+   if (radial0It == elevationScan->cend() || radial0It->second == nullptr)
+   {
+      logger_->warn("Empty radial data");
+      return std::nullopt;
+   }
+
+   const std::shared_ptr<rda::GenericRadarData>& radial0 = radial0It->second;
+
+   const std::chrono::system_clock::time_point collectionTime = util::TimePoint(
+      radial0->modified_julian_date(), radial0->collection_time());
+
+   std::shared_ptr<rda::DigitalRadarData> digitalRadarData0 = nullptr;
+
+   if (vcpData_ != nullptr)
+   {
+      elevationAngle = vcpData_->elevation_angle_raw(elevationIndex);
+      waveformType   = vcpData_->waveform_type(elevationIndex);
+   }
+   else if ((digitalRadarData0 =
+                std::dynamic_pointer_cast<rda::DigitalRadarData>(radial0)) !=
+            nullptr)
+   {
+      elevationAngle = digitalRadarData0->elevation_angle_raw();
+   }
+   else
+   {
+      logger_->warn("Cannot index elevation scan without VCP data");
+      return std::nullopt;
+   }
 
-      for (rda::DataBlockType dataBlockType :
-           rda::MomentDataBlockTypeIterator())
+   for (rda::DataBlockType dataBlockType : rda::MomentDataBlockTypeIterator())
+   {
+      if (dataBlockType == rda::DataBlockType::MomentRef &&
+          waveformType ==
+             rda::WaveformType::ContiguousDopplerWithAmbiguityResolution)
       {
-         if (dataBlockType == rda::DataBlockType::MomentRef &&
-             waveformType ==
-                rda::WaveformType::ContiguousDopplerWithAmbiguityResolution)
-         {
-            // Reflectivity data is contained within both surveillance and
-            // doppler modes.  Surveillance mode produces a better image.
-            continue;
-         }
+         // Reflectivity data is contained within both surveillance and doppler
+         // modes.  Surveillance mode produces a better image.
+         continue;
+      }
 
-         auto momentData = radial0->moment_data_block(dataBlockType);
+      auto momentData = radial0->moment_data_block(dataBlockType);
 
-         if (momentData != nullptr)
-         {
-            // TODO: Handle multiple elevation scans
-            index_[dataBlockType][elevationAngle] = elevationCut.second;
-         }
+      if (momentData != nullptr)
+      {
+         // Repeated cuts of the same elevation angle are indexed by their
+         // collection time. A republished scan replaces its previous entry.
+         index_[dataBlockType][elevationAngle][collectionTime] = flatScan;
       }
    }
+
+   return elevationAngle;
 }
 
 } // namespace wsr88d
@@ -0,0 +1,348 @@
+#include <scwx/wsr88d/derived_products.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static const std::string logPrefix_ = "scwx::wsr88d::derived_products";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+static constexpr double kFeetPerMeter_ = 3.28084;
+
+// Echo tops and vertically integrated liquid levels are encoded as the Level 3
+// products of the same palette
+static constexpr float kEchoTopsScale_  = 1.0f;
+static constexpr float kEchoTopsOffset_ = 2.0f;
+static constexpr float kVilScale_       = 2.5f;
+static constexpr float kVilOffset_      = 1.0f;
+
+// Minimum level of reflectivity with an echo. Level 1 is range folded.
+static constexpr std::uint16_t kMinEchoLevel_ = 2u;
+
+// Number of 8-bit reflectivity levels
+static constexpr std::size_t kLevelCount_ = 256u;
+
+class DerivedProducts::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() = default;
+
+   void Compute(const VolumeIndex& volumeIndex, float radarHeight);
+
+   std::shared_ptr<const rda::FlatElevationScan> elevationScan_ {nullptr};
+   std::vector<float>                            azimuths_ {};
+
+   std::size_t gates_ {0u};
+   double      firstGateRange_ {0.0};
+   double      gateInterval_ {0.0};
+
+   float reflectivityScale_ {2.0f};
+   float reflectivityOffset_ {66.0f};
+
+   std::vector<std::uint8_t> compositeReflectivity_ {};
+   std::vector<std::uint8_t> echoTops_ {};
+   std::vector<std::uint8_t> vil_ {};
+};
+
+DerivedProducts::DerivedProducts(const VolumeIndex& volumeIndex,
+                                 float              radarHeight) :
+    p(std::make_unique<Impl>())
+{
+   if (volumeIndex.data_block_type() != rda::DataBlockType::MomentRef)
+   {
+      logger_->warn("Products can only be derived from reflectivity");
+      return;
+   }
+
+   p->Compute(volumeIndex, radarHeight);
+}
+
+DerivedProducts::~DerivedProducts() = default;
+
+DerivedProducts::DerivedProducts(DerivedProducts&&) noexcept = default;
+DerivedProducts&
+DerivedProducts::operator=(DerivedProducts&&) noexcept = default;
+
+void DerivedProducts::Impl::Compute(const VolumeIndex& volumeIndex,
+                                    float              radarHeight)
+{
+   if (volumeIndex.cut_count() == 0u)
+   {
+      return;
+   }
+
+   // Products are computed on the polar grid of the lowest cut
+   elevationScan_ = volumeIndex.elevation_scan(0u);
+
+   auto momentData = elevationScan_->moment_data(rda::DataBlockType::MomentRef);
+
+   const auto radialHeaders = elevationScan_->radials();
+   azimuths_.resize(radialHeaders.size());
+   std::transform(radialHeaders.begin(),
+                  radialHeaders.end(),
+                  azimuths_.begin(),
+                  [](const auto& header) { return header.azimuthAngle_; });
+
+   gates_          = momentData->gates();
+   firstGateRange_ = momentData->data_moment_range().value() * 1000.0;
+   gateInterval_ =
+      momentData->data_moment_range_sample_interval().value() * 1000.0;
+
+   reflectivityScale_  = volumeIndex.scale();
+   reflectivityOffset_ = volumeIndex.offset();
+
+   const std::size_t radials = azimuths_.size();
+   const std::size_t cuts    = volumeIndex.cut_count();
+
+   compositeReflectivity_.assign(radials * gates_, 0u);
+   echoTops_.assign(radials * gates_, 0u);
+   vil_.assign(radials * gates_, 0u);
+
+   std::vector<double> distances(gates_);
+   for (std::size_t gate = 0; gate < gates_; ++gate)
+   {
+      distances[gate] = firstGateRange_ + gate * gateInterval_;
+   }
+
+   const std::uint16_t echoTopsLevel = static_cast<std::uint16_t>(std::ceil(
+      kEchoTopsThreshold_ * reflectivityScale_ + reflectivityOffset_));
+
+   auto toDbz = [this](std::uint16_t level)
+   { return (level - reflectivityOffset_) / reflectivityScale_; };
+
+   // Liquid water content of a layer between two beams, per meter of depth,
+   // for each pair of reflectivity levels. Linear reflectivity factors
+   // (mm^6/m^3) are limited to exclude hail.
+   std::array<double, kLevelCount_> z {};
+   for (std::uint16_t level = kMinEchoLevel_; level < kLevelCount_; ++level)
+   {
+      const double dbz = std::min<double>(toDbz(level), kVilMaxReflectivity_);
+      z[level] = std::pow(10.0, dbz / 10.0);
+   }
+
+   std::vector<double> layerVil(kLevelCount_ * kLevelCount_);
+   for (std::size_t a = 0; a < kLevelCount_; ++a)
+   {
+      for (std::size_t b = 0; b < kLevelCount_; ++b)
+      {
+         layerVil[a * kLevelCount_ + b] =
+            3.44e-6 * std::pow((z[a] + z[b]) * 0.5, 4.0 / 7.0);
+      }
+   }
+
+   std::vector<std::size_t> radialIndices(radials);
+   std::iota(radialIndices.begin(), radialIndices.end(), 0u);
+
+   std::for_each(
+      std::execution::par,
+      radialIndices.cbegin(),
+      radialIndices.cend(),
+      [&](std::size_t radial)
+      {
+         if (!radialHeaders[radial].valid_)
+         {
+            return;
+         }
+
+         // Sample the center of the radial, which extends to the start of the
+         // following radial
+         const double startAngle = azimuths_[radial];
+         double       endAngle   = azimuths_[(radial + 1) % radials];
+         if (endAngle < startAngle)
+         {
+            endAngle += 360.0;
+         }
+         const double azimuth = (startAngle + endAngle) * 0.5;
+
+         const std::vector<VolumeIndex::BeamSample> beams =
+            volumeIndex.SampleRadial(azimuth, distances);
+
+         for (std::size_t gate = 0; gate < gates_; ++gate)
+         {
+            const std::span<const VolumeIndex::BeamSample> column {
+               beams.data() + gate * cuts, cuts};
+            const std::size_t bin = radial * gates_ + gate;
+
+            std::uint16_t                  maxLevel = 0u;
+            double                         vil      = 0.0;
+            const VolumeIndex::BeamSample* below    = nullptr;
+            const VolumeIndex::BeamSample* top      = nullptr;
+            const VolumeIndex::BeamSample* aboveTop = nullptr;
+
+            for (const VolumeIndex::BeamSample& beam : column)
+            {
+               if (!beam.valid_)
+               {
+                  continue;
+               }
+
+               const bool hasEcho = beam.level_ >= kMinEchoLevel_;
+
+               // Composite reflectivity is the maximum of all cuts
+               if (hasEcho)
+               {
+                  maxLevel = std::max(maxLevel, beam.level_);
+               }
+
+               // Echo tops are found from the highest beam meeting the
+               // threshold, and the beam above it
+               if (hasEcho && beam.level_ >= echoTopsLevel)
+               {
+                  top      = &beam;
+                  aboveTop = nullptr;
+               }
+               else if (hasEcho && below != nullptr && below == top)
+               {
+                  aboveTop = &beam;
+               }
+
+               // Vertically integrated liquid, from the mean liquid water
+               // content of each layer between adjacent beams
+               if (below != nullptr &&
+                   (hasEcho || below->level_ >= kMinEchoLevel_))
+               {
+                  const std::size_t a =
+                     std::min<std::size_t>(below->level_, kLevelCount_ - 1u);
+                  const std::size_t b =
+                     std::min<std::size_t>(beam.level_, kLevelCount_ - 1u);
+                  vil += layerVil[a * kLevelCount_ + b] *
+                         (beam.height_ - below->height_);
+               }
+
+               below = &beam;
+            }
+
+            compositeReflectivity_[bin] = static_cast<std::uint8_t>(
+               std::min<std::uint16_t>(maxLevel, 255u));
+
+            if (top != nullptr)
+            {
+               double echoTop = top->height_;
+
+               // Interpolate to the height at which reflectivity falls below
+               // the threshold
+               if (aboveTop != nullptr)
+               {
+                  const double dbzTop   = toDbz(top->level_);
+                  const double dbzAbove = toDbz(aboveTop->level_);
+                  echoTop += (aboveTop->height_ - top->height_) *
+                             (dbzTop - kEchoTopsThreshold_) /
+                             (dbzTop - dbzAbove);
+               }
+
+               const double echoTopKft =
+                  (echoTop + radarHeight) * kFeetPerMeter_ / 1000.0;
+               echoTops_[bin] = static_cast<std::uint8_t>(std::clamp<long>(
+                  std::lround(echoTopKft * kEchoTopsScale_ + kEchoTopsOffset_),
+                  2,
+                  255));
+            }
+
+            if (vil > 0.0)
+            {
+               vil_[bin] = static_cast<std::uint8_t>(std::clamp<long>(
+                  std::lround(vil * kVilScale_ + kVilOffset_), 2, 255));
+            }
+         }
+      });
+}
+
+std::shared_ptr<const rda::FlatElevationScan>
+DerivedProducts::elevation_scan() const
+{
+   return p->elevationScan_;
+}
+
+std::span<const float> DerivedProducts::azimuths() const
+{
+   return p->azimuths_;
+}
+
+std::size_t DerivedProducts::radial_count() const
+{
+   return p->azimuths_.size();
+}
+
+std::size_t DerivedProducts::gates() const
+{
+   return p->gates_;
+}
+
+double DerivedProducts::first_gate_range() const
+{
+   return p->firstGateRange_;
+}
+
+double DerivedProducts::gate_interval() const
+{
+   return p->gateInterval_;
+}
+
+std::span<const std::uint8_t>
+DerivedProducts::levels(common::Level2Product product) const
+{
+   switch (product)
+   {
+   case common::Level2Product::CompositeReflectivity:
+      return p->compositeReflectivity_;
+
+   case common::Level2Product::EchoTops:
+      return p->echoTops_;
+
+   case common::Level2Product::VerticallyIntegratedLiquid:
+      return p->vil_;
+
+   default:
+      return {};
+   }
+}
+
+float DerivedProducts::scale(common::Level2Product product) const
+{
+   switch (product)
+   {
+   case common::Level2Product::EchoTops:
+      return kEchoTopsScale_;
+
+   case common::Level2Product::VerticallyIntegratedLiquid:
+      return kVilScale_;
+
+   default:
+      return p->reflectivityScale_;
+   }
+}
+
+float DerivedProducts::offset(common::Level2Product product) const
+{
+   switch (product)
+   {
+   case common::Level2Product::EchoTops:
+      return kEchoTopsOffset_;
+
+   case common::Level2Product::VerticallyIntegratedLiquid:
+      return kVilOffset_;
+
+   default:
+      return p->reflectivityOffset_;
+   }
+}
+
+bool DerivedProducts::IsDerivedProduct(common::Level2Product product)
+{
+   return product == common::Level2Product::CompositeReflectivity ||
+          product == common::Level2Product::EchoTops ||
+          product == common::Level2Product::VerticallyIntegratedLiquid;
+}
+
+} // namespace wsr88d
+} // namespace scwx
@@ -1,10 +1,14 @@
 #include <scwx/wsr88d/level3_file.hpp>
 #include <scwx/wsr88d/rpg/ccb_header.hpp>
 #include <scwx/wsr88d/rpg/level3_message_factory.hpp>
+#include <scwx/util/inflate.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/mapped_file.hpp>
+#include <scwx/util/spanbuf.hpp>
+#include <scwx/util/streams.hpp>
+#include <scwx/util/vectorbuf.hpp>
 
 #include <fstream>
-#include <sstream>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -18,6 +22,7 @@
 #endif
 
 #include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/filtering_streambuf.hpp>
 #include <boost/iostreams/filter/zlib.hpp>
 
@@ -44,7 +49,9 @@ public:
        wmoHeader_ {}, ccbHeader_ {}, innerHeader_ {}, message_ {} {};
    ~Level3FileImpl() = default;
 
-   bool DecompressFile(std::istream& is, std::stringstream& ss);
+   bool DecompressFile(std::istream& is, std::vector<char>& data);
+   bool DecompressStream(std::istream& is, std::vector<char>& data);
+   bool LoadCompressedFileData(std::istream& is);
    bool LoadFileData(std::istream& is);
 
    std::shared_ptr<awips::WmoHeader>   wmoHeader_;
@@ -74,6 +81,17 @@ bool Level3File::LoadFile(const std::string& filename)
    logger_->debug("LoadFile: {}", filename);
    bool fileValid = true;
 
+   // Decode directly from the mapped file if possible, falling back to reading
+   // the file through a stream
+   util::MappedFile mappedFile {filename};
+   if (mappedFile.is_open())
+   {
+      util::spanbuf fileBuffer {mappedFile.data()};
+      std::istream  is {&fileBuffer};
+
+      return LoadData(is);
+   }
+
    std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
    if (!f.good())
    {
@@ -108,14 +126,7 @@ bool Level3File::LoadData(std::istream& is)
       // If the header is compressed
       if (is.peek() == 0x78)
       {
-         std::stringstream ss;
-
-         dataValid = p->DecompressFile(is, ss);
-
-         if (dataValid)
-         {
-            dataValid = p->LoadFileData(ss);
-         }
+         dataValid = p->LoadCompressedFileData(is);
       }
       else
       {
@@ -126,7 +137,65 @@ bool Level3File::LoadData(std::istream& is)
    return dataValid;
 }
 
-bool Level3FileImpl::DecompressFile(std::istream& is, std::stringstream& ss)
+bool Level3FileImpl::LoadCompressedFileData(std::istream& is)
+{
+   std::vector<char> data {};
+   util::vectorbuf   dataBuffer {data};
+   std::istream      ds {&dataBuffer};
+
+   bool dataValid = DecompressFile(is, data);
+
+   if (dataValid)
+   {
+      dataBuffer.update_read_pointers(data.size());
+
+      ccbHeader_ = std::make_shared<rpg::CcbHeader>();
+      dataValid  = ccbHeader_->Parse(ds);
+   }
+
+   if (dataValid)
+   {
+      innerHeader_ = std::make_shared<awips::WmoHeader>();
+      dataValid    = innerHeader_->Parse(ds);
+   }
+
+   if (dataValid)
+   {
+      dataValid = LoadFileData(ds);
+   }
+
+   return dataValid;
+}
+
+bool Level3FileImpl::DecompressFile(std::istream& is, std::vector<char>& data)
+{
+   // If the stream reads from memory, inflate all members in a single pass.
+   // Otherwise, decompress each member through the stream.
+   std::optional<std::span<const char>> compressedData =
+      util::GetUnreadData(is);
+
+   if (!compressedData.has_value())
+   {
+      return DecompressStream(is, data);
+   }
+
+   std::optional<std::size_t> bytesConsumed =
+      util::Inflate(*compressedData, util::InflateFormat::Zlib, data);
+
+   if (!bytesConsumed.has_value())
+   {
+      return false;
+   }
+
+   is.seekg(static_cast<std::streamoff>(*bytesConsumed), std::ios_base::cur);
+
+   logger_->trace("Input data consumed = {} bytes", *bytesConsumed);
+   logger_->trace("Decompressed data size = {} bytes", data.size());
+
+   return true;
+}
+
+bool Level3FileImpl::DecompressStream(std::istream& is, std::vector<char>& data)
 {
    bool dataValid = true;
 
@@ -142,8 +211,9 @@ bool Level3FileImpl::DecompressFile(std::istream& is, std::stringstream& ss)
          in.push(zlibDecompressor);
          in.push(is);
 
-         std::streamsize bytesCopied   = boost::iostreams::copy(in, ss);
-         int             bytesConsumed = zlibDecompressor.filter().total_in();
+         std::streamsize bytesCopied = boost::iostreams::copy(
+            in, boost::iostreams::back_inserter(data));
+         int bytesConsumed = zlibDecompressor.filter().total_in();
 
          totalBytesCopied += bytesCopied;
          totalBytesConsumed += bytesConsumed;
@@ -166,17 +236,8 @@ bool Level3FileImpl::DecompressFile(std::istream& is, std::stringstream& ss)
 
    if (dataValid)
    {
-      logger_->trace("Input data consumed = {} bytes", totalBytesCopied);
-      logger_->trace("Decompressed data size = {} bytes", totalBytesConsumed);
-
-      ccbHeader_ = std::make_shared<rpg::CcbHeader>();
-      dataValid  = ccbHeader_->Parse(ss);
-   }
-
-   if (dataValid)
-   {
-      innerHeader_ = std::make_shared<awips::WmoHeader>();
-      dataValid    = innerHeader_->Parse(ss);
+      logger_->trace("Input data consumed = {} bytes", totalBytesConsumed);
+      logger_->trace("Decompressed data size = {} bytes", totalBytesCopied);
    }
 
    return dataValid;
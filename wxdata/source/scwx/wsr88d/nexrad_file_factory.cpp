@@ -1,10 +1,14 @@
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 #include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/util/inflate.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/mapped_file.hpp>
+#include <scwx/util/spanbuf.hpp>
+#include <scwx/util/streams.hpp>
+#include <scwx/util/vectorbuf.hpp>
 
 #include <fstream>
-#include <sstream>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -18,6 +22,7 @@
 #endif
 
 #include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/filtering_streambuf.hpp>
 #include <boost/iostreams/filter/gzip.hpp>
 
@@ -37,14 +42,28 @@ namespace wsr88d
 static const std::string logPrefix_ = "scwx::wsr88d::nexrad_file_factory";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static bool DecompressGzip(std::istream& is, std::vector<char>& data);
+
 std::shared_ptr<NexradFile>
-NexradFileFactory::Create(const std::string& filename)
+NexradFileFactory::Create(const std::string&     filename,
+                          const PreloadFunction& preload)
 {
    logger_->debug("Create: {}", filename);
 
    std::shared_ptr<NexradFile> nexradFile = nullptr;
    bool                        fileValid  = true;
 
+   // Decode directly from the mapped file if possible, falling back to reading
+   // the file through a stream
+   util::MappedFile mappedFile {filename};
+   if (mappedFile.is_open())
+   {
+      util::spanbuf fileBuffer {mappedFile.data()};
+      std::istream  is {&fileBuffer};
+
+      return Create(is, preload);
+   }
+
    std::ifstream f(filename, std::ios_base::in | std::ios_base::binary);
    if (!f.good())
    {
@@ -54,19 +73,22 @@ NexradFileFactory::Create(const std::string& filename)
 
    if (fileValid)
    {
-      nexradFile = Create(f);
+      nexradFile = Create(f, preload);
    }
 
    return nexradFile;
 }
 
-std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
+std::shared_ptr<NexradFile>
+NexradFileFactory::Create(std::istream& is, const PreloadFunction& preload)
 {
    std::shared_ptr<NexradFile> message = nullptr;
 
    std::istream*     pis      = &is;
    std::streampos    pisBegin = is.tellg();
-   std::stringstream ss;
+   std::vector<char> decompressedData {};
+   util::vectorbuf   decompressedBuffer {decompressedData};
+   std::istream      decompressedStream {&decompressedBuffer};
    std::string       buffer;
    bool              dataValid;
 
@@ -78,34 +100,28 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
 
    if (dataValid && buffer.starts_with("\x1f\x8b"))
    {
-      boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
-      in.push(boost::iostreams::gzip_decompressor());
-      in.push(is);
+      // Decompress into a single buffer, which may be decoded in place
+      dataValid = DecompressGzip(is, decompressedData);
 
-      try
+      if (dataValid)
       {
-         std::streamsize bytesCopied = boost::iostreams::copy(in, ss);
+         decompressedBuffer.update_read_pointers(decompressedData.size());
 
-         pis      = &ss;
-         pisBegin = ss.tellg();
+         pis      = &decompressedStream;
+         pisBegin = decompressedStream.tellg();
 
-         ss.read(buffer.data(), 8);
-         dataValid = ss.good();
-         ss.seekg(pisBegin, std::ios_base::beg);
+         decompressedStream.read(buffer.data(), 8);
+         dataValid = decompressedStream.good();
+         decompressedStream.seekg(pisBegin, std::ios_base::beg);
 
-         logger_->trace("Decompressed file = {} bytes", bytesCopied);
+         logger_->trace("Decompressed file = {} bytes",
+                        decompressedData.size());
 
          if (!dataValid)
          {
             logger_->warn("Error reading decompressed stream");
          }
       }
-      catch (const boost::iostreams::gzip_error& ex)
-      {
-         logger_->warn("Error decompressing file: {}", ex.what());
-
-         dataValid = false;
-      }
    }
    else if (!dataValid)
    {
@@ -126,6 +142,11 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
 
    if (message != nullptr)
    {
+      if (preload != nullptr)
+      {
+         preload(message);
+      }
+
       dataValid = message->LoadData(*pis);
 
       if (!dataValid)
@@ -137,5 +158,33 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
    return message;
 }
 
+static bool DecompressGzip(std::istream& is, std::vector<char>& data)
+{
+   // If the stream reads from memory, inflate all members in a single pass.
+   // Otherwise, decompress through the stream.
+   if (auto compressedData = util::GetUnreadData(is);
+       compressedData.has_value())
+   {
+      return util::Inflate(*compressedData, util::InflateFormat::Gzip, data)
+         .has_value();
+   }
+
+   boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
+   in.push(boost::iostreams::gzip_decompressor());
+   in.push(is);
+
+   try
+   {
+      boost::iostreams::copy(in, boost::iostreams::back_inserter(data));
+   }
+   catch (const boost::iostreams::gzip_error& ex)
+   {
+      logger_->warn("Error decompressing file: {}", ex.what());
+      return false;
+   }
+
+   return true;
+}
+
 } // namespace wsr88d
 } // namespace scwx
@@ -1,5 +1,12 @@
 #include <scwx/wsr88d/rda/digital_radar_data_generic.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/streams.hpp>
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
 
 namespace scwx
 {
@@ -24,6 +31,24 @@ static const std::unordered_map<std::string, DataBlockType> strToDataBlock_ {
    {"RHO", DataBlockType::MomentRho},
    {"CFP", DataBlockType::MomentCfp}};
 
+static constexpr std::size_t kMomentDataBlockCount_ =
+   static_cast<std::size_t>(DataBlockType::MomentCfp) -
+   static_cast<std::size_t>(DataBlockType::MomentRef) + 1u;
+
+static constexpr std::streamoff kNoMomentDataBlockOffset_ = -1;
+
+static constexpr std::optional<std::size_t>
+GetMomentDataBlockIndex(DataBlockType type)
+{
+   if (type < DataBlockType::MomentRef || type > DataBlockType::MomentCfp)
+   {
+      return std::nullopt;
+   }
+
+   return static_cast<std::size_t>(type) -
+          static_cast<std::size_t>(DataBlockType::MomentRef);
+}
+
 class DigitalRadarDataGeneric::DataBlock::Impl
 {
 public:
@@ -37,9 +62,11 @@ public:
    std::string dataName_;
 };
 
-DigitalRadarDataGeneric::DataBlock::DataBlock(const std::string& dataBlockType,
-                                              const std::string& dataName) :
-    p(std::make_unique<Impl>(dataBlockType, dataName))
+DigitalRadarDataGeneric::DataBlock::DataBlock(
+   const std::string&         dataBlockType,
+   const std::string&         dataName,
+   std::pmr::memory_resource* resource) :
+    p(util::MakeArenaUnique<Impl>(resource, dataBlockType, dataName))
 {
 }
 DigitalRadarDataGeneric::DataBlock::~DataBlock() = default;
@@ -51,7 +78,10 @@ DigitalRadarDataGeneric::DataBlock::operator=(DataBlock&&) noexcept = default;
 class DigitalRadarDataGeneric::MomentDataBlock::Impl
 {
 public:
-   explicit Impl() {}
+   explicit Impl(std::pmr::memory_resource* resource) :
+       momentGates8_ {resource}, momentGates16_ {resource}
+   {
+   }
 
    std::uint16_t numberOfDataMomentGates_ {0};
    std::int16_t  dataMomentRange_ {0};
@@ -63,13 +93,52 @@ public:
    float         scale_ {0.0f};
    float         offset_ {0.0f};
 
-   std::vector<std::uint8_t>  momentGates8_ {};
-   std::vector<std::uint16_t> momentGates16_ {};
+   std::pmr::vector<std::uint8_t>  momentGates8_;
+   std::pmr::vector<std::uint16_t> momentGates16_;
+
+   std::shared_ptr<std::vector<char>> recordBuffer_ {nullptr};
+   void*                              dataMoments_ {nullptr};
+
+   bool ReferenceRecordBuffer(util::BigEndianReader& reader,
+                              std::size_t            dataSize,
+                              std::size_t            alignment);
 };
 
+bool DigitalRadarDataGeneric::MomentDataBlock::Impl::ReferenceRecordBuffer(
+   util::BigEndianReader& reader, std::size_t dataSize, std::size_t alignment)
+{
+   if (recordBuffer_ == nullptr)
+   {
+      return false;
+   }
+
+   const auto recordBegin =
+      reinterpret_cast<std::uintptr_t>(recordBuffer_->data());
+   const auto recordEnd = recordBegin + recordBuffer_->size();
+   const auto data      = reinterpret_cast<std::uintptr_t>(reader.current());
+
+   if (data < recordBegin || data + dataSize > recordEnd ||
+       dataSize > reader.remaining() || data % alignment != 0)
+   {
+      // Data moments cannot be referenced in place, and must be copied
+      recordBuffer_.reset();
+      return false;
+   }
+
+   dataMoments_ = recordBuffer_->data() + (data - recordBegin);
+   reader.Skip(dataSize);
+
+   return true;
+}
+
 DigitalRadarDataGeneric::MomentDataBlock::MomentDataBlock(
-   const std::string& dataBlockType, const std::string& dataName) :
-    DataBlock(dataBlockType, dataName), p(std::make_unique<Impl>())
+   const std::string&         dataBlockType,
+   const std::string&         dataName,
+   std::pmr::memory_resource* resource) :
+    DataBlock(dataBlockType, dataName, resource),
+    p(util::MakeArenaUnique<Impl>(
+       resource, resource != nullptr ? resource :
+                                       std::pmr::get_default_resource()))
 {
 }
 DigitalRadarDataGeneric::MomentDataBlock::~MomentDataBlock() = default;
@@ -140,6 +209,12 @@ const void* DigitalRadarDataGeneric::MomentDataBlock::data_moments() const
 {
    const void* dataMoments;
 
+   if (p->dataMoments_ != nullptr)
+   {
+      // Data moments reference the record buffer
+      return p->dataMoments_;
+   }
+
    switch (p->dataWordSize_)
    {
    case 8:
@@ -158,14 +233,18 @@ const void* DigitalRadarDataGeneric::MomentDataBlock::data_moments() const
 
 std::shared_ptr<DigitalRadarDataGeneric::MomentDataBlock>
 DigitalRadarDataGeneric::MomentDataBlock::Create(
-   const std::string& dataBlockType,
-   const std::string& dataName,
-   std::istream&      is)
+   const std::string&                 dataBlockType,
+   const std::string&                 dataName,
+   util::BigEndianReader&             reader,
+   std::shared_ptr<std::vector<char>> recordBuffer,
+   std::shared_ptr<util::MemoryArena> arena)
 {
-   std::shared_ptr<MomentDataBlock> p =
-      std::make_shared<MomentDataBlock>(dataBlockType, dataName);
+   std::shared_ptr<MomentDataBlock> p = util::MakeArenaShared<MomentDataBlock>(
+      arena, dataBlockType, dataName, arena.get());
 
-   if (!p->Parse(is))
+   p->p->recordBuffer_ = std::move(recordBuffer);
+
+   if (!p->Parse(reader))
    {
       p.reset();
    }
@@ -173,50 +252,72 @@ DigitalRadarDataGeneric::MomentDataBlock::Create(
    return p;
 }
 
-bool DigitalRadarDataGeneric::MomentDataBlock::Parse(std::istream& is)
+bool DigitalRadarDataGeneric::MomentDataBlock::Parse(
+   util::BigEndianReader& reader)
 {
    bool dataBlockValid = true;
 
-   is.seekg(4, std::ios_base::cur);                                   // 4-7
-   is.read(reinterpret_cast<char*>(&p->numberOfDataMomentGates_), 2); // 8-9
-   is.read(reinterpret_cast<char*>(&p->dataMomentRange_), 2);         // 10-11
-   is.read(reinterpret_cast<char*>(&p->dataMomentRangeSampleInterval_),
-           2);                                             // 12-13
-   is.read(reinterpret_cast<char*>(&p->tover_), 2);        // 14-15
-   is.read(reinterpret_cast<char*>(&p->snrThreshold_), 2); // 16-17
-   is.read(reinterpret_cast<char*>(&p->controlFlags_), 1); // 18
-   is.read(reinterpret_cast<char*>(&p->dataWordSize_), 1); // 19
-   is.read(reinterpret_cast<char*>(&p->scale_), 4);        // 20-23
-   is.read(reinterpret_cast<char*>(&p->offset_), 4);       // 24-27
-
-   p->numberOfDataMomentGates_       = ntohs(p->numberOfDataMomentGates_);
-   p->dataMomentRange_               = ntohs(p->dataMomentRange_);
-   p->dataMomentRangeSampleInterval_ = ntohs(p->dataMomentRangeSampleInterval_);
-   p->tover_                         = ntohs(p->tover_);
-   p->snrThreshold_                  = ntohs(p->snrThreshold_);
-   p->scale_                         = awips::Message::SwapFloat(p->scale_);
-   p->offset_                        = awips::Message::SwapFloat(p->offset_);
-
-   if (p->numberOfDataMomentGates_ <= 1840)
+   reader.Skip(4);                                                   // 4-7
+   p->numberOfDataMomentGates_       = reader.Read<std::uint16_t>(); // 8-9
+   p->dataMomentRange_               = reader.Read<std::int16_t>();  // 10-11
+   p->dataMomentRangeSampleInterval_ = reader.Read<std::uint16_t>(); // 12-13
+   p->tover_                         = reader.Read<std::uint16_t>(); // 14-15
+   p->snrThreshold_                  = reader.Read<std::int16_t>();  // 16-17
+   p->controlFlags_                  = reader.Read<std::uint8_t>();  // 18
+   p->dataWordSize_                  = reader.Read<std::uint8_t>();  // 19
+   p->scale_                         = reader.Read<float>();         // 20-23
+   p->offset_                        = reader.Read<float>();         // 24-27
+
+   if (reader.fail())
+   {
+      logger_->warn("Reached end of data moment block");
+      dataBlockValid = false;
+   }
+   else if (p->numberOfDataMomentGates_ <= 1840)
    {
       if (p->dataWordSize_ == 8)
       {
-         p->momentGates8_.resize(p->numberOfDataMomentGates_);
-         is.read(reinterpret_cast<char*>(p->momentGates8_.data()),
-                 p->numberOfDataMomentGates_);
+         if (!p->ReferenceRecordBuffer(reader,
+                                       p->numberOfDataMomentGates_,
+                                       alignof(std::uint8_t)))
+         {
+            p->momentGates8_.resize(p->numberOfDataMomentGates_);
+            reader.ReadBytes(p->momentGates8_.data(),
+                             p->numberOfDataMomentGates_);
+         }
       }
       else if (p->dataWordSize_ == 16)
       {
-         p->momentGates16_.resize(p->numberOfDataMomentGates_);
-         is.read(reinterpret_cast<char*>(p->momentGates16_.data()),
-                 p->numberOfDataMomentGates_ * 2);
-         awips::Message::SwapVector(p->momentGates16_);
+         if (p->ReferenceRecordBuffer(reader,
+                                      p->numberOfDataMomentGates_ * 2,
+                                      alignof(std::uint16_t)))
+         {
+            // Swap data moments in place within the record buffer
+            std::uint16_t* momentGates16 =
+               static_cast<std::uint16_t*>(p->dataMoments_);
+            std::transform(momentGates16,
+                           momentGates16 + p->numberOfDataMomentGates_,
+                           momentGates16,
+                           [](std::uint16_t u) { return ntohs(u); });
+         }
+         else
+         {
+            p->momentGates16_.resize(p->numberOfDataMomentGates_);
+            reader.ReadArray(p->momentGates16_.data(),
+                             p->numberOfDataMomentGates_);
+         }
       }
       else
       {
          logger_->warn("Invalid data word size: {}", p->dataWordSize_);
          dataBlockValid = false;
       }
+
+      if (reader.fail())
+      {
+         logger_->warn("Reached end of data moments");
+         dataBlockValid = false;
+      }
    }
    else
    {
@@ -250,8 +351,11 @@ public:
 };
 
 DigitalRadarDataGeneric::VolumeDataBlock::VolumeDataBlock(
-   const std::string& dataBlockType, const std::string& dataName) :
-    DataBlock(dataBlockType, dataName), p(std::make_unique<Impl>())
+   const std::string&         dataBlockType,
+   const std::string&         dataName,
+   std::pmr::memory_resource* resource) :
+    DataBlock(dataBlockType, dataName, resource),
+    p(util::MakeArenaUnique<Impl>(resource))
 {
 }
 DigitalRadarDataGeneric::VolumeDataBlock::~VolumeDataBlock() = default;
@@ -280,14 +384,15 @@ DigitalRadarDataGeneric::VolumeDataBlock::volume_coverage_pattern_number() const
 
 std::shared_ptr<DigitalRadarDataGeneric::VolumeDataBlock>
 DigitalRadarDataGeneric::VolumeDataBlock::Create(
-   const std::string& dataBlockType,
-   const std::string& dataName,
-   std::istream&      is)
+   const std::string&                 dataBlockType,
+   const std::string&                 dataName,
+   util::BigEndianReader&             reader,
+   std::shared_ptr<util::MemoryArena> arena)
 {
-   std::shared_ptr<VolumeDataBlock> p =
-      std::make_shared<VolumeDataBlock>(dataBlockType, dataName);
+   std::shared_ptr<VolumeDataBlock> p = util::MakeArenaShared<VolumeDataBlock>(
+      arena, dataBlockType, dataName, arena.get());
 
-   if (!p->Parse(is))
+   if (!p->Parse(reader))
    {
       p.reset();
    }
@@ -295,42 +400,31 @@ DigitalRadarDataGeneric::VolumeDataBlock::Create(
    return p;
 }
 
-bool DigitalRadarDataGeneric::VolumeDataBlock::Parse(std::istream& is)
+bool DigitalRadarDataGeneric::VolumeDataBlock::Parse(
+   util::BigEndianReader& reader)
 {
    bool dataBlockValid = true;
 
-   is.read(reinterpret_cast<char*>(&p->lrtup_), 2);               // 4-5
-   is.read(reinterpret_cast<char*>(&p->versionNumberMajor_), 1);  // 6
-   is.read(reinterpret_cast<char*>(&p->versionNumberMinor_), 1);  // 7
-   is.read(reinterpret_cast<char*>(&p->latitude_), 4);            // 8-11
-   is.read(reinterpret_cast<char*>(&p->longitude_), 4);           // 12-15
-   is.read(reinterpret_cast<char*>(&p->siteHeight_), 2);          // 16-17
-   is.read(reinterpret_cast<char*>(&p->feedhornHeight_), 2);      // 18-19
-   is.read(reinterpret_cast<char*>(&p->calibrationConstant_), 4); // 20-23
-   is.read(reinterpret_cast<char*>(&p->horizontaShvTxPower_), 4); // 24-27
-   is.read(reinterpret_cast<char*>(&p->verticalShvTxPower_), 4);  // 28-31
-   is.read(reinterpret_cast<char*>(&p->systemDifferentialReflectivity_),
-           4); // 32-35
-   is.read(reinterpret_cast<char*>(&p->initialSystemDifferentialPhase_),
-           4); // 36-39
-   is.read(reinterpret_cast<char*>(&p->volumeCoveragePatternNumber_),
-           2);                                                 // 40-41
-   is.read(reinterpret_cast<char*>(&p->processingStatus_), 2); // 42-43
-
-   p->lrtup_               = ntohs(p->lrtup_);
-   p->latitude_            = awips::Message::SwapFloat(p->latitude_);
-   p->longitude_           = awips::Message::SwapFloat(p->longitude_);
-   p->siteHeight_          = ntohs(p->siteHeight_);
-   p->feedhornHeight_      = ntohs(p->feedhornHeight_);
-   p->calibrationConstant_ = awips::Message::SwapFloat(p->calibrationConstant_);
-   p->horizontaShvTxPower_ = awips::Message::SwapFloat(p->horizontaShvTxPower_);
-   p->verticalShvTxPower_  = awips::Message::SwapFloat(p->verticalShvTxPower_);
-   p->systemDifferentialReflectivity_ =
-      awips::Message::SwapFloat(p->systemDifferentialReflectivity_);
-   p->initialSystemDifferentialPhase_ =
-      awips::Message::SwapFloat(p->initialSystemDifferentialPhase_);
-   p->volumeCoveragePatternNumber_ = ntohs(p->volumeCoveragePatternNumber_);
-   p->processingStatus_            = ntohs(p->processingStatus_);
+   p->lrtup_                          = reader.Read<std::uint16_t>(); // 4-5
+   p->versionNumberMajor_             = reader.Read<std::uint8_t>();  // 6
+   p->versionNumberMinor_             = reader.Read<std::uint8_t>();  // 7
+   p->latitude_                       = reader.Read<float>();         // 8-11
+   p->longitude_                      = reader.Read<float>();         // 12-15
+   p->siteHeight_                     = reader.Read<std::int16_t>();  // 16-17
+   p->feedhornHeight_                 = reader.Read<std::uint16_t>(); // 18-19
+   p->calibrationConstant_            = reader.Read<float>();         // 20-23
+   p->horizontaShvTxPower_            = reader.Read<float>();         // 24-27
+   p->verticalShvTxPower_             = reader.Read<float>();         // 28-31
+   p->systemDifferentialReflectivity_ = reader.Read<float>();         // 32-35
+   p->initialSystemDifferentialPhase_ = reader.Read<float>();         // 36-39
+   p->volumeCoveragePatternNumber_    = reader.Read<std::uint16_t>(); // 40-41
+   p->processingStatus_               = reader.Read<std::uint16_t>(); // 42-43
+
+   if (reader.fail())
+   {
+      logger_->warn("Reached end of volume data block");
+      dataBlockValid = false;
+   }
 
    return dataBlockValid;
 }
@@ -346,8 +440,11 @@ public:
 };
 
 DigitalRadarDataGeneric::ElevationDataBlock::ElevationDataBlock(
-   const std::string& dataBlockType, const std::string& dataName) :
-    DataBlock(dataBlockType, dataName), p(std::make_unique<Impl>())
+   const std::string&         dataBlockType,
+   const std::string&         dataName,
+   std::pmr::memory_resource* resource) :
+    DataBlock(dataBlockType, dataName, resource),
+    p(util::MakeArenaUnique<Impl>(resource))
 {
 }
 DigitalRadarDataGeneric::ElevationDataBlock::~ElevationDataBlock() = default;
@@ -360,14 +457,16 @@ DigitalRadarDataGeneric::ElevationDataBlock::operator=(
 
 std::shared_ptr<DigitalRadarDataGeneric::ElevationDataBlock>
 DigitalRadarDataGeneric::ElevationDataBlock::Create(
-   const std::string& dataBlockType,
-   const std::string& dataName,
-   std::istream&      is)
+   const std::string&                 dataBlockType,
+   const std::string&                 dataName,
+   util::BigEndianReader&             reader,
+   std::shared_ptr<util::MemoryArena> arena)
 {
    std::shared_ptr<ElevationDataBlock> p =
-      std::make_shared<ElevationDataBlock>(dataBlockType, dataName);
+      util::MakeArenaShared<ElevationDataBlock>(
+         arena, dataBlockType, dataName, arena.get());
 
-   if (!p->Parse(is))
+   if (!p->Parse(reader))
    {
       p.reset();
    }
@@ -375,17 +474,20 @@ DigitalRadarDataGeneric::ElevationDataBlock::Create(
    return p;
 }
 
-bool DigitalRadarDataGeneric::ElevationDataBlock::Parse(std::istream& is)
+bool DigitalRadarDataGeneric::ElevationDataBlock::Parse(
+   util::BigEndianReader& reader)
 {
    bool dataBlockValid = true;
 
-   is.read(reinterpret_cast<char*>(&p->lrtup_), 2);               // 4-5
-   is.read(reinterpret_cast<char*>(&p->atmos_), 2);               // 6-7
-   is.read(reinterpret_cast<char*>(&p->calibrationConstant_), 4); // 8-11
+   p->lrtup_               = reader.Read<std::uint16_t>(); // 4-5
+   p->atmos_               = reader.Read<std::int16_t>();  // 6-7
+   p->calibrationConstant_ = reader.Read<float>();         // 8-11
 
-   p->lrtup_               = ntohs(p->lrtup_);
-   p->atmos_               = ntohs(p->atmos_);
-   p->calibrationConstant_ = awips::Message::SwapFloat(p->calibrationConstant_);
+   if (reader.fail())
+   {
+      logger_->warn("Reached end of elevation data block");
+      dataBlockValid = false;
+   }
 
    return dataBlockValid;
 }
@@ -406,8 +508,11 @@ public:
 };
 
 DigitalRadarDataGeneric::RadialDataBlock::RadialDataBlock(
-   const std::string& dataBlockType, const std::string& dataName) :
-    DataBlock(dataBlockType, dataName), p(std::make_unique<Impl>())
+   const std::string&         dataBlockType,
+   const std::string&         dataName,
+   std::pmr::memory_resource* resource) :
+    DataBlock(dataBlockType, dataName, resource),
+    p(util::MakeArenaUnique<Impl>(resource))
 {
 }
 DigitalRadarDataGeneric::RadialDataBlock::~RadialDataBlock() = default;
@@ -425,14 +530,15 @@ float DigitalRadarDataGeneric::RadialDataBlock::unambiguous_range() const
 
 std::shared_ptr<DigitalRadarDataGeneric::RadialDataBlock>
 DigitalRadarDataGeneric::RadialDataBlock::Create(
-   const std::string& dataBlockType,
-   const std::string& dataName,
-   std::istream&      is)
+   const std::string&                 dataBlockType,
+   const std::string&                 dataName,
+   util::BigEndianReader&             reader,
+   std::shared_ptr<util::MemoryArena> arena)
 {
-   std::shared_ptr<RadialDataBlock> p =
-      std::make_shared<RadialDataBlock>(dataBlockType, dataName);
+   std::shared_ptr<RadialDataBlock> p = util::MakeArenaShared<RadialDataBlock>(
+      arena, dataBlockType, dataName, arena.get());
 
-   if (!p->Parse(is))
+   if (!p->Parse(reader))
    {
       p.reset();
    }
@@ -440,32 +546,25 @@ DigitalRadarDataGeneric::RadialDataBlock::Create(
    return p;
 }
 
-bool DigitalRadarDataGeneric::RadialDataBlock::Parse(std::istream& is)
+bool DigitalRadarDataGeneric::RadialDataBlock::Parse(
+   util::BigEndianReader& reader)
 {
    bool dataBlockValid = true;
 
-   is.read(reinterpret_cast<char*>(&p->lrtup_), 2);                // 4-5
-   is.read(reinterpret_cast<char*>(&p->unambigiousRange_), 2);     // 6-7
-   is.read(reinterpret_cast<char*>(&p->noiseLevelHorizontal_), 4); // 8-11
-   is.read(reinterpret_cast<char*>(&p->noiseLevelVertical_), 4);   // 12-15
-   is.read(reinterpret_cast<char*>(&p->nyquistVelocity_), 2);      // 16-17
-   is.read(reinterpret_cast<char*>(&p->radialFlags_), 2);          // 18-19
-   is.read(reinterpret_cast<char*>(&p->calibrationConstantHorizontal_),
-           4); // 20-23
-   is.read(reinterpret_cast<char*>(&p->calibrationConstantVertical_),
-           4); // 24-27
-
-   p->lrtup_            = ntohs(p->lrtup_);
-   p->unambigiousRange_ = ntohs(p->unambigiousRange_);
-   p->noiseLevelHorizontal_ =
-      awips::Message::SwapFloat(p->noiseLevelHorizontal_);
-   p->noiseLevelVertical_ = awips::Message::SwapFloat(p->noiseLevelVertical_);
-   p->nyquistVelocity_    = ntohs(p->nyquistVelocity_);
-   p->radialFlags_        = ntohs(p->radialFlags_);
-   p->calibrationConstantHorizontal_ =
-      awips::Message::SwapFloat(p->calibrationConstantHorizontal_);
-   p->calibrationConstantVertical_ =
-      awips::Message::SwapFloat(p->calibrationConstantVertical_);
+   p->lrtup_                         = reader.Read<std::uint16_t>(); // 4-5
+   p->unambigiousRange_              = reader.Read<std::uint16_t>(); // 6-7
+   p->noiseLevelHorizontal_          = reader.Read<float>();         // 8-11
+   p->noiseLevelVertical_            = reader.Read<float>();         // 12-15
+   p->nyquistVelocity_               = reader.Read<std::uint16_t>(); // 16-17
+   p->radialFlags_                   = reader.Read<std::uint16_t>(); // 18-19
+   p->calibrationConstantHorizontal_ = reader.Read<float>();         // 20-23
+   p->calibrationConstantVertical_   = reader.Read<float>();         // 24-27
+
+   if (reader.fail())
+   {
+      logger_->warn("Reached end of radial data block");
+      dataBlockValid = false;
+   }
 
    return dataBlockValid;
 }
@@ -473,9 +572,16 @@ bool DigitalRadarDataGeneric::RadialDataBlock::Parse(std::istream& is)
 class DigitalRadarDataGeneric::Impl
 {
 public:
-   explicit Impl() {};
+   explicit Impl(std::shared_ptr<util::MemoryArena> arena) :
+       arena_ {std::move(arena)}
+   {
+      momentDataBlockOffset_.fill(kNoMomentDataBlockOffset_);
+   }
    ~Impl() = default;
 
+   // Memory arena the message and its data blocks are allocated from
+   std::shared_ptr<util::MemoryArena> arena_;
+
    std::string                   radarIdentifier_ {};
    std::uint32_t                 collectionTime_ {0};
    std::uint16_t                 modifiedJulianDate_ {0};
@@ -496,12 +602,38 @@ public:
    std::shared_ptr<VolumeDataBlock>    volumeDataBlock_ {nullptr};
    std::shared_ptr<ElevationDataBlock> elevationDataBlock_ {nullptr};
    std::shared_ptr<RadialDataBlock>    radialDataBlock_ {nullptr};
-   std::unordered_map<DataBlockType, std::shared_ptr<MomentDataBlock>>
+   std::array<std::shared_ptr<MomentDataBlock>, kMomentDataBlockCount_>
       momentDataBlock_ {};
+
+   std::shared_ptr<std::vector<char>> recordBuffer_ {nullptr};
+   bool                               lazyMomentDecoding_ {false};
+
+   // Offsets of data moment blocks within the record buffer, which have not yet
+   // been decoded
+   std::array<std::streamoff, kMomentDataBlockCount_> momentDataBlockOffset_ {};
+   std::mutex                                         momentDataBlockMutex_ {};
+
+   std::shared_ptr<MomentDataBlock>
+   DecodeMomentDataBlock(std::streamoff offset) const;
 };
 
-DigitalRadarDataGeneric::DigitalRadarDataGeneric() :
-    GenericRadarData(), p(std::make_unique<Impl>())
+std::shared_ptr<DigitalRadarDataGeneric::MomentDataBlock>
+DigitalRadarDataGeneric::Impl::DecodeMomentDataBlock(
+   std::streamoff offset) const
+{
+   util::BigEndianReader reader {recordBuffer_->data(), recordBuffer_->size()};
+   reader.Seek(static_cast<std::size_t>(offset));
+
+   const std::string dataBlockType = reader.ReadString(1);
+   const std::string dataName      = reader.ReadString(3);
+
+   return MomentDataBlock::Create(
+      dataBlockType, dataName, reader, recordBuffer_, arena_);
+}
+
+DigitalRadarDataGeneric::DigitalRadarDataGeneric(
+   std::shared_ptr<util::MemoryArena> arena) :
+    GenericRadarData(), p(util::MakeArenaUnique<Impl>(arena.get(), arena))
 {
 }
 DigitalRadarDataGeneric::~DigitalRadarDataGeneric() = default;
@@ -551,7 +683,7 @@ std::uint8_t DigitalRadarDataGeneric::azimuth_resolution_spacing() const
    return p->azimuthResolutionSpacing_;
 }
 
-std::uint8_t DigitalRadarDataGeneric::radial_status() const
+std::uint16_t DigitalRadarDataGeneric::radial_status() const
 {
    return p->radialStatus_;
 }
@@ -621,10 +753,28 @@ DigitalRadarDataGeneric::moment_data_block(DataBlockType type) const
 {
    std::shared_ptr<MomentDataBlock> momentDataBlock = nullptr;
 
-   auto it = p->momentDataBlock_.find(type);
-   if (it != p->momentDataBlock_.end())
+   std::optional<std::size_t> index = GetMomentDataBlockIndex(type);
+   if (!index.has_value())
+   {
+      return momentDataBlock;
+   }
+
+   std::unique_lock<std::mutex> lock {p->momentDataBlockMutex_,
+                                      std::defer_lock};
+   if (p->lazyMomentDecoding_)
+   {
+      lock.lock();
+   }
+
+   momentDataBlock = p->momentDataBlock_[*index];
+
+   std::streamoff& offset = p->momentDataBlockOffset_[*index];
+   if (momentDataBlock == nullptr && offset != kNoMomentDataBlockOffset_)
    {
-      momentDataBlock = it->second;
+      // Decode the data moment block on first access, and cache the result
+      momentDataBlock             = p->DecodeMomentDataBlock(offset);
+      p->momentDataBlock_[*index] = momentDataBlock;
+      offset                      = kNoMomentDataBlockOffset_;
    }
 
    return momentDataBlock;
@@ -639,33 +789,64 @@ bool DigitalRadarDataGeneric::Parse(std::istream& is)
 
    std::streampos isBegin = is.tellg();
 
-   p->radarIdentifier_.resize(4);
-
-   is.read(&p->radarIdentifier_[0], 4);                                // 0-3
-   is.read(reinterpret_cast<char*>(&p->collectionTime_), 4);           // 4-7
-   is.read(reinterpret_cast<char*>(&p->modifiedJulianDate_), 2);       // 8-9
-   is.read(reinterpret_cast<char*>(&p->azimuthNumber_), 2);            // 10-11
-   is.read(reinterpret_cast<char*>(&p->azimuthAngle_), 4);             // 12-15
-   is.read(reinterpret_cast<char*>(&p->compressionIndicator_), 1);     // 16
-   is.seekg(1, std::ios_base::cur);                                    // 17
-   is.read(reinterpret_cast<char*>(&p->radialLength_), 2);             // 18-19
-   is.read(reinterpret_cast<char*>(&p->azimuthResolutionSpacing_), 1); // 20
-   is.read(reinterpret_cast<char*>(&p->radialStatus_), 1);             // 21
-   is.read(reinterpret_cast<char*>(&p->elevationNumber_), 1);          // 22
-   is.read(reinterpret_cast<char*>(&p->cutSectorNumber_), 1);          // 23
-   is.read(reinterpret_cast<char*>(&p->elevationAngle_), 4);           // 24-27
-   is.read(reinterpret_cast<char*>(&p->radialSpotBlankingStatus_), 1); // 28
-   is.read(reinterpret_cast<char*>(&p->azimuthIndexingMode_), 1);      // 29
-   is.read(reinterpret_cast<char*>(&p->dataBlockCount_), 2);           // 30-31
-
-   p->collectionTime_     = ntohl(p->collectionTime_);
-   p->modifiedJulianDate_ = ntohs(p->modifiedJulianDate_);
-   p->azimuthNumber_      = ntohs(p->azimuthNumber_);
-   p->azimuthAngle_       = SwapFloat(p->azimuthAngle_);
-   p->radialLength_       = ntohs(p->radialLength_);
-   p->elevationAngle_     = SwapFloat(p->elevationAngle_);
-   p->dataBlockCount_     = ntohs(p->dataBlockCount_);
+   // Decode the message directly from memory if the stream reads from a
+   // buffer. Otherwise, read the message from the stream at once.
+   std::span<const char> messageData {};
+   std::vector<char>     messageBuffer {};
 
+   if (auto data = util::GetUnreadData(is); data.has_value())
+   {
+      messageData = *data;
+   }
+   else
+   {
+      messageBuffer.resize(data_size());
+      is.read(messageBuffer.data(), messageBuffer.size());
+      messageBuffer.resize(static_cast<std::size_t>(is.gcount()));
+      messageData = messageBuffer;
+   }
+
+   util::BigEndianReader reader {messageData};
+
+   // Data moments may only reference the record buffer if the message is read
+   // from the record buffer
+   if (p->recordBuffer_ != nullptr)
+   {
+      const auto recordBegin =
+         reinterpret_cast<std::uintptr_t>(p->recordBuffer_->data());
+      const auto messageBegin =
+         reinterpret_cast<std::uintptr_t>(messageData.data());
+
+      if (messageBegin < recordBegin ||
+          messageBegin > recordBegin + p->recordBuffer_->size())
+      {
+         p->recordBuffer_.reset();
+         p->lazyMomentDecoding_ = false;
+      }
+   }
+
+   p->radarIdentifier_          = reader.ReadString(4);         // 0-3
+   p->collectionTime_           = reader.Read<std::uint32_t>(); // 4-7
+   p->modifiedJulianDate_       = reader.Read<std::uint16_t>(); // 8-9
+   p->azimuthNumber_            = reader.Read<std::uint16_t>(); // 10-11
+   p->azimuthAngle_             = reader.Read<float>();         // 12-15
+   p->compressionIndicator_     = reader.Read<std::uint8_t>();  // 16
+   reader.Skip(1);                                              // 17
+   p->radialLength_             = reader.Read<std::uint16_t>(); // 18-19
+   p->azimuthResolutionSpacing_ = reader.Read<std::uint8_t>();  // 20
+   p->radialStatus_             = reader.Read<std::uint8_t>();  // 21
+   p->elevationNumber_          = reader.Read<std::uint8_t>();  // 22
+   p->cutSectorNumber_          = reader.Read<std::uint8_t>();  // 23
+   p->elevationAngle_           = reader.Read<float>();         // 24-27
+   p->radialSpotBlankingStatus_ = reader.Read<std::uint8_t>();  // 28
+   p->azimuthIndexingMode_      = reader.Read<std::uint8_t>();  // 29
+   p->dataBlockCount_           = reader.Read<std::uint16_t>(); // 30-31
+
+   if (reader.fail())
+   {
+      logger_->warn("Reached end of message");
+      messageValid = false;
+   }
    if (p->azimuthNumber_ < 1 || p->azimuthNumber_ > 720)
    {
       logger_->warn("Invalid azimuth number: {}", p->azimuthNumber_);
@@ -692,21 +873,23 @@ bool DigitalRadarDataGeneric::Parse(std::istream& is)
       p->dataBlockCount_ = 0;
    }
 
-   is.read(reinterpret_cast<char*>(&p->dataBlockPointer_),
-           p->dataBlockCount_ * 4);
-
-   SwapArray(p->dataBlockPointer_, p->dataBlockCount_);
+   reader.ReadArray(p->dataBlockPointer_.data(), p->dataBlockCount_);
 
    for (uint16_t b = 0; b < p->dataBlockCount_; ++b)
    {
-      is.seekg(isBegin + std::streamoff(p->dataBlockPointer_[b]),
-               std::ios_base::beg);
+      reader.Seek(p->dataBlockPointer_[b]);
 
-      std::string dataBlockType(1, 0);
-      std::string dataName(3, 0);
+      const std::size_t dataBlockOffset = reader.position();
+      const std::string dataBlockType   = reader.ReadString(1);
+      const std::string dataName        = reader.ReadString(3);
 
-      is.read(&dataBlockType[0], 1);
-      is.read(&dataName[0], 3);
+      if (reader.fail())
+      {
+         logger_->warn("Invalid data block pointer: {}",
+                       p->dataBlockPointer_[b]);
+         messageValid = false;
+         break;
+      }
 
       DataBlockType dataBlock = DataBlockType::Unknown;
       try
@@ -720,16 +903,16 @@ bool DigitalRadarDataGeneric::Parse(std::istream& is)
       switch (dataBlock)
       {
       case DataBlockType::Volume:
-         p->volumeDataBlock_ =
-            std::move(VolumeDataBlock::Create(dataBlockType, dataName, is));
+         p->volumeDataBlock_ = std::move(VolumeDataBlock::Create(
+            dataBlockType, dataName, reader, p->arena_));
          break;
       case DataBlockType::Elevation:
-         p->elevationDataBlock_ =
-            std::move(ElevationDataBlock::Create(dataBlockType, dataName, is));
+         p->elevationDataBlock_ = std::move(ElevationDataBlock::Create(
+            dataBlockType, dataName, reader, p->arena_));
          break;
       case DataBlockType::Radial:
-         p->radialDataBlock_ =
-            std::move(RadialDataBlock::Create(dataBlockType, dataName, is));
+         p->radialDataBlock_ = std::move(RadialDataBlock::Create(
+            dataBlockType, dataName, reader, p->arena_));
          break;
       case DataBlockType::MomentRef:
       case DataBlockType::MomentVel:
@@ -738,9 +921,23 @@ bool DigitalRadarDataGeneric::Parse(std::istream& is)
       case DataBlockType::MomentPhi:
       case DataBlockType::MomentRho:
       case DataBlockType::MomentCfp:
-         p->momentDataBlock_[dataBlock] =
-            std::move(MomentDataBlock::Create(dataBlockType, dataName, is));
+      {
+         const std::size_t index = *GetMomentDataBlockIndex(dataBlock);
+
+         if (p->lazyMomentDecoding_)
+         {
+            // Defer decoding until the data moment block is requested
+            p->momentDataBlockOffset_[index] =
+               (messageData.data() - p->recordBuffer_->data()) +
+               static_cast<std::streamoff>(dataBlockOffset);
+         }
+         else
+         {
+            p->momentDataBlock_[index] = std::move(MomentDataBlock::Create(
+               dataBlockType, dataName, reader, p->recordBuffer_, p->arena_));
+         }
          break;
+      }
       default:
          logger_->warn("Unknown data name: {}", dataName);
          break;
@@ -757,11 +954,18 @@ bool DigitalRadarDataGeneric::Parse(std::istream& is)
 }
 
 std::shared_ptr<DigitalRadarDataGeneric>
-DigitalRadarDataGeneric::Create(Level2MessageHeader&& header, std::istream& is)
+DigitalRadarDataGeneric::Create(Level2MessageHeader&&              header,
+                                std::istream&                      is,
+                                std::shared_ptr<std::vector<char>> recordBuffer,
+                                bool lazyMomentDecoding,
+                                std::shared_ptr<util::MemoryArena> arena)
 {
    std::shared_ptr<DigitalRadarDataGeneric> message =
-      std::make_shared<DigitalRadarDataGeneric>();
+      util::MakeArenaShared<DigitalRadarDataGeneric>(arena, arena);
    message->set_header(std::move(header));
+   message->p->lazyMomentDecoding_ =
+      lazyMomentDecoding && recordBuffer != nullptr;
+   message->p->recordBuffer_ = std::move(recordBuffer);
 
    if (!message->Parse(is))
    {
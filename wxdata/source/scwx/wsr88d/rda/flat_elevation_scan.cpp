@@ -0,0 +1,345 @@
+#include <scwx/wsr88d/rda/flat_elevation_scan.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/time.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+static const std::string logPrefix_ = "scwx::wsr88d::rda::flat_elevation_scan";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+static constexpr std::size_t kDataBlockTypeCount_ =
+   static_cast<std::size_t>(DataBlockType::Unknown);
+
+class FlatElevationScan::Impl
+{
+public:
+   explicit Impl(std::shared_ptr<ElevationScan> elevationScan) :
+       elevationScan_ {std::move(elevationScan)}
+   {
+   }
+   ~Impl() = default;
+
+   void BuildRadialHeaders();
+
+   std::shared_ptr<ElevationScan> elevationScan_;
+   std::vector<RadialHeader>      radials_ {};
+
+   std::chrono::system_clock::time_point startTime_ {};
+   std::chrono::system_clock::time_point endTime_ {};
+   std::uint16_t                         vcpNumber_ {0};
+
+   mutable std::mutex momentDataMutex_ {};
+   mutable std::array<std::shared_ptr<const MomentData>, kDataBlockTypeCount_>
+      momentData_ {};
+};
+
+FlatElevationScan::FlatElevationScan(
+   std::shared_ptr<ElevationScan> elevationScan) :
+    p(std::make_unique<Impl>(std::move(elevationScan)))
+{
+   p->BuildRadialHeaders();
+}
+FlatElevationScan::~FlatElevationScan() = default;
+
+void FlatElevationScan::Impl::BuildRadialHeaders()
+{
+   if (elevationScan_ == nullptr || elevationScan_->empty())
+   {
+      return;
+   }
+
+   // Elevation scans are indexed by azimuth number - 1
+   radials_.resize(static_cast<std::size_t>(elevationScan_->crbegin()->first) +
+                   1u);
+
+   bool firstRadial = true;
+
+   for (auto& [azimuthIndex, radial] : *elevationScan_)
+   {
+      if (radial == nullptr)
+      {
+         continue;
+      }
+
+      RadialHeader& header       = radials_[azimuthIndex];
+      header.azimuthAngle_       = radial->azimuth_angle().value();
+      header.collectionTime_     = radial->collection_time();
+      header.modifiedJulianDate_ = radial->modified_julian_date();
+      header.azimuthNumber_      = radial->azimuth_number();
+      header.radialStatus_       = radial->radial_status();
+      header.valid_              = true;
+
+      const std::chrono::system_clock::time_point time = util::TimePoint(
+         header.modifiedJulianDate_, header.collectionTime_);
+
+      if (firstRadial)
+      {
+         startTime_  = time;
+         endTime_    = time;
+         vcpNumber_  = radial->volume_coverage_pattern_number();
+         firstRadial = false;
+      }
+      else
+      {
+         startTime_ = std::min(startTime_, time);
+         endTime_   = std::max(endTime_, time);
+      }
+   }
+
+   // Estimate the azimuth of missing radials from the preceding radial, so
+   // the edges of neighboring radials remain continuous
+   const float azimuthSpacing = 360.0f / static_cast<float>(radials_.size());
+
+   for (std::size_t i = 1; i < radials_.size(); ++i)
+   {
+      if (!radials_[i].valid_)
+      {
+         radials_[i].azimuthAngle_ = std::fmod(
+            radials_[i - 1].azimuthAngle_ + azimuthSpacing, 360.0f);
+      }
+   }
+}
+
+std::shared_ptr<ElevationScan> FlatElevationScan::elevation_scan() const
+{
+   return p->elevationScan_;
+}
+
+std::span<const FlatElevationScan::RadialHeader>
+FlatElevationScan::radials() const
+{
+   return p->radials_;
+}
+
+std::size_t FlatElevationScan::radial_count() const
+{
+   return p->radials_.size();
+}
+
+std::chrono::system_clock::time_point FlatElevationScan::start_time() const
+{
+   return p->startTime_;
+}
+
+std::chrono::system_clock::time_point FlatElevationScan::end_time() const
+{
+   return p->endTime_;
+}
+
+std::uint16_t FlatElevationScan::volume_coverage_pattern_number() const
+{
+   return p->vcpNumber_;
+}
+
+std::shared_ptr<const FlatElevationScan::MomentData>
+FlatElevationScan::moment_data(DataBlockType type) const
+{
+   const std::size_t index = static_cast<std::size_t>(type);
+
+   if (index >= kDataBlockTypeCount_ || p->elevationScan_ == nullptr ||
+       p->elevationScan_->empty())
+   {
+      return nullptr;
+   }
+
+   std::unique_lock lock {p->momentDataMutex_};
+
+   std::shared_ptr<const MomentData>& momentData = p->momentData_[index];
+
+   if (momentData == nullptr)
+   {
+      auto& radial0 = p->elevationScan_->cbegin()->second;
+
+      if (radial0 != nullptr && radial0->moment_data_block(type) != nullptr)
+      {
+         momentData = std::make_shared<MomentData>(
+            *p->elevationScan_, p->radials_.size(), type);
+      }
+   }
+
+   return momentData;
+}
+
+class FlatElevationScan::MomentData::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() = default;
+
+   DataBlockType dataBlockType_ {DataBlockType::Unknown};
+   std::uint16_t gates_ {0};
+   std::int16_t  dataMomentRange_ {0};
+   std::uint16_t dataMomentRangeSampleInterval_ {0};
+   std::int16_t  snrThreshold_ {0};
+   std::uint8_t  dataWordSize_ {0};
+   float         scale_ {0.0f};
+   float         offset_ {0.0f};
+
+   std::vector<RadialInfo>    radials_ {};
+   std::vector<std::uint8_t>  moments8_ {};
+   std::vector<std::uint16_t> moments16_ {};
+};
+
+FlatElevationScan::MomentData::MomentData(const ElevationScan& elevationScan,
+                                          std::size_t          radialCount,
+                                          DataBlockType        type) :
+    p(std::make_unique<Impl>())
+{
+   p->dataBlockType_ = type;
+   p->radials_.resize(radialCount);
+
+   auto momentData0 = elevationScan.cbegin()->second->moment_data_block(type);
+
+   p->dataMomentRange_ = momentData0->data_moment_range_raw();
+   p->dataMomentRangeSampleInterval_ =
+      momentData0->data_moment_range_sample_interval_raw();
+   p->snrThreshold_ = momentData0->snr_threshold_raw();
+   p->dataWordSize_ = momentData0->data_word_size();
+   p->scale_        = momentData0->scale();
+   p->offset_       = momentData0->offset();
+
+   // Collect the data moment blocks, and determine the matrix stride
+   std::vector<std::shared_ptr<GenericRadarData::MomentDataBlock>> blocks(
+      radialCount);
+
+   for (auto& [azimuthIndex, radial] : elevationScan)
+   {
+      if (radial == nullptr || azimuthIndex >= radialCount)
+      {
+         continue;
+      }
+
+      auto momentData = radial->moment_data_block(type);
+
+      if (momentData == nullptr || momentData->data_moments() == nullptr)
+      {
+         continue;
+      }
+      if (momentData->data_word_size() != p->dataWordSize_)
+      {
+         logger_->warn("Radial {} has different word size", azimuthIndex);
+         continue;
+      }
+
+      p->gates_ =
+         std::max(p->gates_, momentData->number_of_data_moment_gates());
+      blocks[azimuthIndex] = std::move(momentData);
+   }
+
+   // Copy the data moments of each radial into its row of the matrix
+   const std::size_t wordBytes = (p->dataWordSize_ == 16) ? 2u : 1u;
+   std::uint8_t*     matrix    = nullptr;
+
+   if (wordBytes == 2u)
+   {
+      p->moments16_.resize(radialCount * p->gates_);
+      matrix = reinterpret_cast<std::uint8_t*>(p->moments16_.data());
+   }
+   else
+   {
+      p->moments8_.resize(radialCount * p->gates_);
+      matrix = p->moments8_.data();
+   }
+
+   for (std::size_t radial = 0; radial < radialCount; ++radial)
+   {
+      auto& momentData = blocks[radial];
+
+      if (momentData == nullptr)
+      {
+         continue;
+      }
+
+      RadialInfo& info      = p->radials_[radial];
+      info.dataMomentRange_ = momentData->data_moment_range_raw();
+      info.dataMomentRangeSampleInterval_ =
+         momentData->data_moment_range_sample_interval_raw();
+      info.numberOfDataMomentGates_ = momentData->number_of_data_moment_gates();
+
+      std::memcpy(matrix + radial * p->gates_ * wordBytes,
+                  momentData->data_moments(),
+                  info.numberOfDataMomentGates_ * wordBytes);
+   }
+}
+FlatElevationScan::MomentData::~MomentData() = default;
+
+FlatElevationScan::MomentData::MomentData(MomentData&&) noexcept = default;
+FlatElevationScan::MomentData&
+FlatElevationScan::MomentData::operator=(MomentData&&) noexcept = default;
+
+DataBlockType FlatElevationScan::MomentData::data_block_type() const
+{
+   return p->dataBlockType_;
+}
+
+std::uint16_t FlatElevationScan::MomentData::gates() const
+{
+   return p->gates_;
+}
+
+units::kilometers<float>
+FlatElevationScan::MomentData::data_moment_range() const
+{
+   return units::kilometers<float> {p->dataMomentRange_ * 0.001f};
+}
+
+units::kilometers<float>
+FlatElevationScan::MomentData::data_moment_range_sample_interval() const
+{
+   return units::kilometers<float> {p->dataMomentRangeSampleInterval_ * 0.001f};
+}
+
+std::int16_t FlatElevationScan::MomentData::snr_threshold_raw() const
+{
+   return p->snrThreshold_;
+}
+
+std::uint8_t FlatElevationScan::MomentData::data_word_size() const
+{
+   return p->dataWordSize_;
+}
+
+float FlatElevationScan::MomentData::scale() const
+{
+   return p->scale_;
+}
+
+float FlatElevationScan::MomentData::offset() const
+{
+   return p->offset_;
+}
+
+std::span<const FlatElevationScan::MomentData::RadialInfo>
+FlatElevationScan::MomentData::radials() const
+{
+   return p->radials_;
+}
+
+const void*
+FlatElevationScan::MomentData::data_moments(std::size_t radial) const
+{
+   const std::size_t offset = radial * p->gates_;
+
+   if (p->dataWordSize_ == 16)
+   {
+      return p->moments16_.data() + offset;
+   }
+
+   return p->moments8_.data() + offset;
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -9,6 +9,7 @@
 #include <scwx/wsr88d/rda/performance_maintenance_data.hpp>
 #include <scwx/wsr88d/rda/rda_adaptation_data.hpp>
 #include <scwx/wsr88d/rda/rda_status_data.hpp>
+#include <scwx/wsr88d/rda/rda_types.hpp>
 #include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
 
 #include <unordered_map>
@@ -37,11 +38,20 @@ static const std::unordered_map<unsigned int, CreateLevel2MessageFunction>
             {13, ClutterFilterBypassMap::Create},
             {15, ClutterFilterMap::Create},
             {18, RdaAdaptationData::Create},
-            {31, DigitalRadarDataGeneric::Create}};
+            {31,
+             [](Level2MessageHeader&& header, std::istream& is)
+             {
+                return DigitalRadarDataGeneric::Create(std::move(header), is);
+             }}};
 
 struct Level2MessageFactory::Context
 {
-   Context() :
+   Context(std::shared_ptr<std::vector<char>> recordBuffer,
+           bool                               lazyMomentDecoding,
+           std::shared_ptr<util::MemoryArena> arena) :
+       recordBuffer_ {std::move(recordBuffer)},
+       lazyMomentDecoding_ {lazyMomentDecoding},
+       arena_ {std::move(arena)},
        messageData_ {},
        bufferedSize_ {},
        messageBuffer_ {messageData_},
@@ -49,6 +59,10 @@ struct Level2MessageFactory::Context
    {
    }
 
+   std::shared_ptr<std::vector<char>> recordBuffer_;
+   bool                               lazyMomentDecoding_;
+   std::shared_ptr<util::MemoryArena> arena_;
+
    std::vector<char> messageData_;
    size_t            bufferedSize_;
    util::vectorbuf   messageBuffer_;
@@ -57,9 +71,13 @@ struct Level2MessageFactory::Context
 };
 
 std::shared_ptr<Level2MessageFactory::Context>
-Level2MessageFactory::CreateContext()
+Level2MessageFactory::CreateContext(
+   std::shared_ptr<std::vector<char>> recordBuffer,
+   bool                               lazyMomentDecoding,
+   std::shared_ptr<util::MemoryArena> arena)
 {
-   return std::make_shared<Context>();
+   return std::make_shared<Context>(
+      std::move(recordBuffer), lazyMomentDecoding, std::move(arena));
 }
 
 Level2MessageInfo Level2MessageFactory::Create(std::istream&             is,
@@ -172,10 +190,31 @@ Level2MessageInfo Level2MessageFactory::Create(std::istream&             is,
          }
       }
 
-      if (messageStream != nullptr)
+      if (messageType ==
+          static_cast<std::uint8_t>(MessageId::DigitalRadarDataGeneric) &&
+          messageStream != nullptr)
+      {
+         // Unsegmented messages are read directly from the record buffer, and
+         // data moments may reference the buffer. Radar data is allocated from
+         // the memory arena, if provided.
+         const bool readFromRecord =
+            (messageStream == &is && ctx->recordBuffer_ != nullptr);
+
+         info.message = DigitalRadarDataGeneric::Create(
+            std::move(header),
+            *messageStream,
+            readFromRecord ? ctx->recordBuffer_ : nullptr,
+            ctx->lazyMomentDecoding_,
+            ctx->arena_);
+      }
+      else if (messageStream != nullptr)
       {
          info.message =
             create_.at(messageType)(std::move(header), *messageStream);
+      }
+
+      if (messageStream != nullptr)
+      {
          ctx->messageData_.resize(0);
          ctx->messageData_.shrink_to_fit();
          ctx->messageBufferStream_.clear();
@@ -1,15 +1,11 @@
 #include <scwx/wsr88d/rda/level2_message_header.hpp>
+#include <scwx/util/big_endian_reader.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <array>
 #include <istream>
 #include <string>
 
-#ifdef _WIN32
-#   include <WinSock2.h>
-#else
-#   include <arpa/inet.h>
-#endif
-
 namespace scwx
 {
 namespace wsr88d
@@ -105,21 +101,20 @@ bool Level2MessageHeader::Parse(std::istream& is)
 {
    bool headerValid = true;
 
-   is.read(reinterpret_cast<char*>(&p->messageSize_), 2);
-   is.read(reinterpret_cast<char*>(&p->rdaRedundantChannel_), 1);
-   is.read(reinterpret_cast<char*>(&p->messageType_), 1);
-   is.read(reinterpret_cast<char*>(&p->idSequenceNumber_), 2);
-   is.read(reinterpret_cast<char*>(&p->julianDate_), 2);
-   is.read(reinterpret_cast<char*>(&p->millisecondsOfDay_), 4);
-   is.read(reinterpret_cast<char*>(&p->numberOfMessageSegments_), 2);
-   is.read(reinterpret_cast<char*>(&p->messageSegmentNumber_), 2);
-
-   p->messageSize_             = ntohs(p->messageSize_);
-   p->idSequenceNumber_        = ntohs(p->idSequenceNumber_);
-   p->julianDate_              = ntohs(p->julianDate_);
-   p->millisecondsOfDay_       = ntohl(p->millisecondsOfDay_);
-   p->numberOfMessageSegments_ = ntohs(p->numberOfMessageSegments_);
-   p->messageSegmentNumber_    = ntohs(p->messageSegmentNumber_);
+   // Read the header at once, and decode its fields from memory
+   std::array<char, SIZE> buffer {};
+   is.read(buffer.data(), buffer.size());
+
+   util::BigEndianReader reader {buffer};
+
+   p->messageSize_             = reader.Read<std::uint16_t>();
+   p->rdaRedundantChannel_     = reader.Read<std::uint8_t>();
+   p->messageType_             = reader.Read<std::uint8_t>();
+   p->idSequenceNumber_        = reader.Read<std::uint16_t>();
+   p->julianDate_              = reader.Read<std::uint16_t>();
+   p->millisecondsOfDay_       = reader.Read<std::uint32_t>();
+   p->numberOfMessageSegments_ = reader.Read<std::uint16_t>();
+   p->messageSegmentNumber_    = reader.Read<std::uint16_t>();
 
    if (is.eof())
    {
@@ -3,6 +3,7 @@
 
 #include <istream>
 #include <string>
+#include <vector>
 
 namespace scwx
 {
@@ -118,6 +119,8 @@ bool DigitalPrecipitationDataArrayPacket::Parse(std::istream& is)
    {
       p->row_.resize(p->numberOfRows_);
 
+      std::vector<uint8_t> data {};
+
       for (uint16_t r = 0; r < p->numberOfRows_; r++)
       {
          auto& row = p->row_[r];
@@ -137,15 +140,19 @@ bool DigitalPrecipitationDataArrayPacket::Parse(std::istream& is)
             break;
          }
 
-         // Read row data
+         // Read row data at once, and separate the run and level of each
+         // record from memory
          size_t recordCount = row.numberOfBytes_ / 2;
+         data.resize(row.numberOfBytes_);
+         is.read(reinterpret_cast<char*>(data.data()), row.numberOfBytes_);
+
          row.run_.resize(recordCount);
          row.level_.resize(recordCount);
 
          for (size_t i = 0; i < recordCount; i++)
          {
-            is.read(reinterpret_cast<char*>(&row.run_[i]), 1);
-            is.read(reinterpret_cast<char*>(&row.level_[i]), 1);
+            row.run_[i]   = data[i * 2];
+            row.level_[i] = data[i * 2 + 1];
          }
 
          bytesRead += row.numberOfBytes_;
@@ -1,8 +1,11 @@
 #include <scwx/wsr88d/rpg/digital_radial_data_array_packet.hpp>
+#include <scwx/util/big_endian_reader.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <array>
 #include <istream>
 #include <string>
+#include <vector>
 
 namespace scwx
 {
@@ -15,19 +18,19 @@ static const std::string logPrefix_ =
    "scwx::wsr88d::rpg::digital_radial_data_array_packet";
 static const auto logger_ = util::Logger::Create(logPrefix_);
 
+static constexpr std::size_t kPacketHeaderSize_ = 14;
+static constexpr std::size_t kRadialHeaderSize_ = 6;
+
 class DigitalRadialDataArrayPacketImpl
 {
 public:
    struct Radial
    {
-      uint16_t             numberOfBytes_;
-      uint16_t             startAngle_;
-      uint16_t             deltaAngle_;
-      std::vector<uint8_t> level_;
+      uint16_t numberOfBytes_;
+      uint16_t startAngle_;
+      uint16_t deltaAngle_;
 
-      Radial() : numberOfBytes_ {0}, startAngle_ {0}, deltaAngle_ {0}, level_ {}
-      {
-      }
+      Radial() : numberOfBytes_ {0}, startAngle_ {0}, deltaAngle_ {0} {}
    };
 
    explicit DigitalRadialDataArrayPacketImpl() :
@@ -38,6 +41,7 @@ public:
        jCenterOfSweep_ {0},
        rangeScaleFactor_ {0},
        radial_ {},
+       level_ {},
        dataSize_ {0}
    {
    }
@@ -54,6 +58,10 @@ public:
    // Repeat for each radial
    std::vector<Radial> radial_;
 
+   // Levels of each radial, stored contiguously with a stride of the number of
+   // range bins
+   std::vector<uint8_t> level_;
+
    size_t dataSize_;
 };
 
@@ -118,10 +126,10 @@ float DigitalRadialDataArrayPacket::delta_angle(uint16_t r) const
    return p->radial_[r].deltaAngle_ * 0.1f;
 }
 
-const std::vector<uint8_t>&
-DigitalRadialDataArrayPacket::level(uint16_t r) const
+std::span<const uint8_t> DigitalRadialDataArrayPacket::level(uint16_t r) const
 {
-   return p->radial_[r].level_;
+   return std::span<const uint8_t> {p->level_}.subspan(
+      static_cast<size_t>(r) * p->numberOfRangeBins_, p->numberOfRangeBins_);
 }
 
 bool DigitalRadialDataArrayPacket::Parse(std::istream& is)
@@ -129,22 +137,20 @@ bool DigitalRadialDataArrayPacket::Parse(std::istream& is)
    bool   blockValid = true;
    size_t bytesRead  = 0;
 
-   is.read(reinterpret_cast<char*>(&p->packetCode_), 2);
-   is.read(reinterpret_cast<char*>(&p->indexOfFirstRangeBin_), 2);
-   is.read(reinterpret_cast<char*>(&p->numberOfRangeBins_), 2);
-   is.read(reinterpret_cast<char*>(&p->iCenterOfSweep_), 2);
-   is.read(reinterpret_cast<char*>(&p->jCenterOfSweep_), 2);
-   is.read(reinterpret_cast<char*>(&p->rangeScaleFactor_), 2);
-   is.read(reinterpret_cast<char*>(&p->numberOfRadials_), 2);
-   bytesRead += 14;
-
-   p->packetCode_           = ntohs(p->packetCode_);
-   p->indexOfFirstRangeBin_ = ntohs(p->indexOfFirstRangeBin_);
-   p->numberOfRangeBins_    = ntohs(p->numberOfRangeBins_);
-   p->iCenterOfSweep_       = ntohs(p->iCenterOfSweep_);
-   p->jCenterOfSweep_       = ntohs(p->jCenterOfSweep_);
-   p->rangeScaleFactor_     = ntohs(p->rangeScaleFactor_);
-   p->numberOfRadials_      = ntohs(p->numberOfRadials_);
+   // Read fixed length fields at once, and decode them from memory
+   std::array<char, kPacketHeaderSize_> packetHeader {};
+   is.read(packetHeader.data(), packetHeader.size());
+   bytesRead += packetHeader.size();
+
+   util::BigEndianReader headerReader {packetHeader};
+
+   p->packetCode_           = headerReader.Read<std::uint16_t>();
+   p->indexOfFirstRangeBin_ = headerReader.Read<std::uint16_t>();
+   p->numberOfRangeBins_    = headerReader.Read<std::uint16_t>();
+   p->iCenterOfSweep_       = headerReader.Read<std::int16_t>();
+   p->jCenterOfSweep_       = headerReader.Read<std::int16_t>();
+   p->rangeScaleFactor_     = headerReader.Read<std::uint16_t>();
+   p->numberOfRadials_      = headerReader.Read<std::uint16_t>();
 
    if (is.eof())
    {
@@ -180,19 +186,22 @@ bool DigitalRadialDataArrayPacket::Parse(std::istream& is)
    if (blockValid)
    {
       p->radial_.resize(p->numberOfRadials_);
+      p->level_.resize(static_cast<size_t>(p->numberOfRadials_) *
+                       p->numberOfRangeBins_);
 
       for (uint16_t r = 0; r < p->numberOfRadials_; r++)
       {
          auto& radial = p->radial_[r];
 
-         is.read(reinterpret_cast<char*>(&radial.numberOfBytes_), 2);
-         is.read(reinterpret_cast<char*>(&radial.startAngle_), 2);
-         is.read(reinterpret_cast<char*>(&radial.deltaAngle_), 2);
-         bytesRead += 6;
+         std::array<char, kRadialHeaderSize_> radialHeader {};
+         is.read(radialHeader.data(), radialHeader.size());
+         bytesRead += radialHeader.size();
 
-         radial.numberOfBytes_ = ntohs(radial.numberOfBytes_);
-         radial.startAngle_    = ntohs(radial.startAngle_);
-         radial.deltaAngle_    = ntohs(radial.deltaAngle_);
+         util::BigEndianReader radialReader {radialHeader};
+
+         radial.numberOfBytes_ = radialReader.Read<std::uint16_t>();
+         radial.startAngle_    = radialReader.Read<std::uint16_t>();
+         radial.deltaAngle_    = radialReader.Read<std::uint16_t>();
 
          if (radial.numberOfBytes_ < 1 || radial.numberOfBytes_ > 1840)
          {
@@ -213,12 +222,13 @@ bool DigitalRadialDataArrayPacket::Parse(std::istream& is)
             break;
          }
 
-         // Read radial bins
+         // Read radial bins directly into the radial's row of the level array,
+         // and skip any padding
          size_t dataSize = p->numberOfRangeBins_;
-         radial.level_.resize(dataSize);
-         is.read(reinterpret_cast<char*>(radial.level_.data()), dataSize);
-
-         is.seekg(radial.numberOfBytes_ - dataSize, std::ios_base::cur);
+         is.read(reinterpret_cast<char*>(p->level_.data() + r * dataSize),
+                 static_cast<std::streamsize>(dataSize));
+         is.ignore(
+            static_cast<std::streamsize>(radial.numberOfBytes_ - dataSize));
          bytesRead += radial.numberOfBytes_;
       }
    }
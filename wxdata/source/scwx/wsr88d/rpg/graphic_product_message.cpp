@@ -51,12 +51,15 @@ public:
    }
    ~GraphicProductMessageImpl() = default;
 
+   void BuildPacketIndex();
    bool LoadBlocks(std::istream& is);
 
    std::shared_ptr<ProductDescriptionBlock>  descriptionBlock_;
    std::shared_ptr<ProductSymbologyBlock>    symbologyBlock_;
    std::shared_ptr<GraphicAlphanumericBlock> graphicBlock_;
    std::shared_ptr<TabularAlphanumericBlock> tabularBlock_;
+
+   PacketIndex packetIndex_ {};
 };
 
 GraphicProductMessage::GraphicProductMessage() :
@@ -94,6 +97,11 @@ GraphicProductMessage::tabular_block() const
    return p->tabularBlock_;
 }
 
+const PacketIndex& GraphicProductMessage::packet_index() const
+{
+   return p->packetIndex_;
+}
+
 bool GraphicProductMessage::Parse(std::istream& is)
 {
    bool dataValid = true;
@@ -169,6 +177,10 @@ bool GraphicProductMessageImpl::LoadBlocks(std::istream& is)
    {
       symbologyBlock_ = std::make_shared<ProductSymbologyBlock>();
 
+      // Packets are decoded when accessed, so only the packets which are
+      // displayed need to be decoded
+      symbologyBlock_->set_lazy_packet_decoding(true);
+
       is.seekg(offsetToSymbology - offsetBase, std::ios_base::cur);
       symbologyValid = symbologyBlock_->Parse(is);
       is.seekg(offsetBasePos, std::ios_base::beg);
@@ -213,9 +225,45 @@ bool GraphicProductMessageImpl::LoadBlocks(std::istream& is)
       }
    }
 
+   BuildPacketIndex();
+
    return (symbologyValid && graphicValid && tabularValid);
 }
 
+void GraphicProductMessageImpl::BuildPacketIndex()
+{
+   // Symbology packets are indexed by packet code, and are not decoded until
+   // they are found
+   if (symbologyBlock_ != nullptr)
+   {
+      for (std::uint16_t layer = 0; layer < symbologyBlock_->number_of_layers();
+           ++layer)
+      {
+         const std::size_t packetCount = symbologyBlock_->packet_count(layer);
+
+         for (std::size_t i = 0; i < packetCount; ++i)
+         {
+            packetIndex_.Add(symbologyBlock_->packet_code(layer, i),
+                             [symbologyBlock = symbologyBlock_, layer, i]()
+                             { return symbologyBlock->packet(layer, i); });
+         }
+      }
+   }
+
+   // Graphic alphanumeric packets are decoded when the block is parsed
+   if (graphicBlock_ != nullptr)
+   {
+      for (auto& page : graphicBlock_->page_list())
+      {
+         for (auto& packet : page)
+         {
+            packetIndex_.Add(packet->packet_code(),
+                             [packet]() { return packet; });
+         }
+      }
+   }
+}
+
 std::shared_ptr<GraphicProductMessage>
 GraphicProductMessage::Create(Level3MessageHeader&& header, std::istream& is)
 {
@@ -1,5 +1,6 @@
 #include <scwx/wsr88d/rpg/packet_factory.hpp>
 
+#include <scwx/util/big_endian_reader.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/wsr88d/rpg/cell_trend_data_packet.hpp>
 #include <scwx/wsr88d/rpg/cell_trend_volume_scan_times.hpp>
@@ -108,6 +109,97 @@ std::shared_ptr<Packet> PacketFactory::Create(std::istream& is)
    return packet;
 }
 
+std::optional<std::size_t>
+PacketFactory::GetPacketSize(std::span<const char> data)
+{
+   util::BigEndianReader reader {data};
+
+   const std::uint16_t packetCode = reader.Read<std::uint16_t>();
+   std::size_t         packetSize = 0;
+
+   if (reader.fail() || !create_.contains(packetCode))
+   {
+      return std::nullopt;
+   }
+
+   switch (packetCode)
+   {
+   case 16: // Digital Radial Data Array
+   case 0xAF1F: // Radial Data
+   {
+      // 14 byte packet header, followed by radials with a 6 byte header
+      reader.Seek(12);
+      const std::uint16_t numberOfRadials = reader.Read<std::uint16_t>();
+
+      for (std::uint16_t r = 0; r < numberOfRadials && !reader.fail(); ++r)
+      {
+         // Packet 16 radials specify a number of bytes, and packet AF1F
+         // radials specify a number of RLE halfwords
+         std::size_t radialSize = reader.Read<std::uint16_t>();
+         if (packetCode == 0xAF1F)
+         {
+            radialSize *= 2u;
+         }
+         reader.Skip(4u + radialSize);
+      }
+
+      packetSize = reader.position();
+      break;
+   }
+
+   case 17: // Digital Precipitation Data Array
+   case 18: // Precipitation Rate Data Array
+   case 0xBA07: // Raster Data
+   case 0xBA0F: // Raster Data
+   {
+      // 10 or 22 byte packet header, followed by rows with a 2 byte length
+      const bool raster = (packetCode == 0xBA07 || packetCode == 0xBA0F);
+
+      reader.Seek(raster ? 18 : 8);
+      const std::uint16_t numberOfRows = reader.Read<std::uint16_t>();
+      if (raster)
+      {
+         reader.Skip(2);
+      }
+
+      for (std::uint16_t r = 0; r < numberOfRows && !reader.fail(); ++r)
+      {
+         const std::uint16_t numberOfBytes = reader.Read<std::uint16_t>();
+         reader.Skip(numberOfBytes);
+      }
+
+      packetSize = reader.position();
+      break;
+   }
+
+   case 28: // Generic Data
+   case 29: // Generic Data
+      reader.Skip(2);
+      packetSize = reader.Read<std::uint32_t>() + 8u;
+      break;
+
+   case 0x0802: // Set Color Level
+      packetSize = SetColorLevelPacket::SIZE;
+      break;
+
+   case 0x0E03: // Linked Contour Vector
+      reader.Skip(6);
+      packetSize = reader.Read<std::uint16_t>() + 10u;
+      break;
+
+   default: // Packets with a halfword length of block following the code
+      packetSize = reader.Read<std::uint16_t>() + 4u;
+      break;
+   }
+
+   if (reader.fail() || packetSize > data.size())
+   {
+      return std::nullopt;
+   }
+
+   return packetSize;
+}
+
 } // namespace rpg
 } // namespace wsr88d
 } // namespace scwx
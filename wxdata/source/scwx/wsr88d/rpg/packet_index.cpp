@@ -0,0 +1,181 @@
+#include <scwx/wsr88d/rpg/packet_index.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rpg
+{
+
+static const std::string logPrefix_ = "scwx::wsr88d::rpg::packet_index";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+class PacketIndex::Impl
+{
+public:
+   struct PacketEntry
+   {
+      std::uint16_t           packetCode_ {0};
+      PacketFunction          packetFunction_ {};
+      bool                    decoded_ {false};
+      std::shared_ptr<Packet> packet_ {nullptr};
+   };
+
+   explicit Impl() {}
+   ~Impl() = default;
+
+   const std::shared_ptr<Packet>& GetPacket(std::size_t i);
+   std::vector<std::shared_ptr<Packet>>
+   GetPackets(std::vector<std::size_t>& packetIndices);
+
+   std::vector<PacketEntry> packets_ {};
+
+   // Indices of the packets of each packet code, in message order
+   std::unordered_map<std::uint16_t, std::vector<std::size_t>>
+      packetCodeIndex_ {};
+
+   // Typed packet lists of each packet type which has been found
+   std::unordered_map<std::type_index, std::shared_ptr<void>> typeIndex_ {};
+
+   std::mutex mutex_ {};
+};
+
+PacketIndex::PacketIndex() : p(std::make_unique<Impl>()) {}
+PacketIndex::~PacketIndex() = default;
+
+PacketIndex::PacketIndex(PacketIndex&&) noexcept            = default;
+PacketIndex& PacketIndex::operator=(PacketIndex&&) noexcept = default;
+
+std::size_t PacketIndex::size() const
+{
+   return p->packets_.size();
+}
+
+std::size_t PacketIndex::packet_count(PacketCode packetCode) const
+{
+   auto it = p->packetCodeIndex_.find(static_cast<std::uint16_t>(packetCode));
+   return (it != p->packetCodeIndex_.cend()) ? it->second.size() : 0u;
+}
+
+void PacketIndex::Add(std::uint16_t packetCode, PacketFunction packet)
+{
+   p->packetCodeIndex_[packetCode].push_back(p->packets_.size());
+   p->packets_.push_back({packetCode, std::move(packet), false, nullptr});
+}
+
+const std::shared_ptr<Packet>& PacketIndex::Impl::GetPacket(std::size_t i)
+{
+   // Mutex must be locked prior to calling this function
+   PacketEntry& entry = packets_[i];
+
+   if (!entry.decoded_)
+   {
+      entry.packet_  = entry.packetFunction_();
+      entry.decoded_ = true;
+
+      if (entry.packet_ == nullptr)
+      {
+         logger_->debug("Packet {0} (0x{0:x}) could not be decoded",
+                        entry.packetCode_);
+      }
+   }
+
+   return entry.packet_;
+}
+
+std::vector<std::shared_ptr<Packet>>
+PacketIndex::Impl::GetPackets(std::vector<std::size_t>& packetIndices)
+{
+   // Mutex must be locked prior to calling this function
+   std::vector<std::shared_ptr<Packet>> packetList {};
+   packetList.reserve(packetIndices.size());
+
+   // Return packets in message order
+   std::sort(packetIndices.begin(), packetIndices.end());
+
+   for (std::size_t i : packetIndices)
+   {
+      const std::shared_ptr<Packet>& packet = GetPacket(i);
+      if (packet != nullptr)
+      {
+         packetList.push_back(packet);
+      }
+   }
+
+   return packetList;
+}
+
+std::vector<std::shared_ptr<Packet>> PacketIndex::FindPacketsByCode(
+   std::initializer_list<PacketCode> packetCodes) const
+{
+   std::unique_lock lock {p->mutex_};
+
+   std::vector<std::size_t> packetIndices {};
+
+   for (PacketCode packetCode : packetCodes)
+   {
+      auto it =
+         p->packetCodeIndex_.find(static_cast<std::uint16_t>(packetCode));
+      if (it != p->packetCodeIndex_.cend())
+      {
+         packetIndices.insert(
+            packetIndices.end(), it->second.cbegin(), it->second.cend());
+      }
+   }
+
+   return p->GetPackets(packetIndices);
+}
+
+std::shared_ptr<void> PacketIndex::FindPacketsOfType(
+   std::type_index                      type,
+   const IsTypeFunction&                isType,
+   const CreateTypedPacketListFunction& createTypedPacketList) const
+{
+   std::unique_lock lock {p->mutex_};
+
+   auto it = p->typeIndex_.find(type);
+   if (it != p->typeIndex_.cend())
+   {
+      return it->second;
+   }
+
+   std::vector<std::size_t> packetIndices {};
+
+   // Each packet code is decoded by a single packet type, so only the first
+   // packet of each packet code needs to be decoded to determine whether the
+   // packet code matches
+   for (auto& [packetCode, codePacketIndices] : p->packetCodeIndex_)
+   {
+      for (std::size_t i : codePacketIndices)
+      {
+         const std::shared_ptr<Packet>& packet = p->GetPacket(i);
+
+         if (packet != nullptr)
+         {
+            if (isType(*packet))
+            {
+               packetIndices.insert(packetIndices.end(),
+                                    codePacketIndices.cbegin(),
+                                    codePacketIndices.cend());
+            }
+            break;
+         }
+      }
+   }
+
+   std::shared_ptr<void> typedPacketList =
+      createTypedPacketList(p->GetPackets(packetIndices));
+
+   p->typeIndex_.emplace(type, typedPacketList);
+
+   return typedPacketList;
+}
+
+} // namespace rpg
+} // namespace wsr88d
+} // namespace scwx
@@ -1,8 +1,14 @@
 #include <scwx/wsr88d/rpg/product_symbology_block.hpp>
 #include <scwx/wsr88d/rpg/packet_factory.hpp>
+#include <scwx/util/big_endian_reader.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/spanbuf.hpp>
 
+#include <algorithm>
 #include <istream>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 
 namespace scwx
@@ -29,12 +35,39 @@ public:
    }
    ~ProductSymbologyBlockImpl() = default;
 
+   struct PacketRecord
+   {
+      std::uint16_t                   packetCode_ {0};
+      std::size_t                     offset_ {0}; // Offset into packet data
+      std::size_t                     size_ {0};
+      mutable bool                    decoded_ {false};
+      mutable std::shared_ptr<Packet> packet_ {nullptr};
+   };
+
+   std::uint32_t DecodePackets(std::istream&              is,
+                               std::uint32_t              lengthOfDataLayer,
+                               std::vector<PacketRecord>& packetList);
+   std::uint32_t RecordPackets(std::istream&              is,
+                               std::uint32_t              lengthOfDataLayer,
+                               std::vector<PacketRecord>& packetList);
+
+   const PacketRecord* GetPacketRecord(std::uint16_t layer,
+                                       std::size_t   i) const;
+   std::shared_ptr<Packet> DecodePacket(const PacketRecord& record) const;
+
    int16_t  blockDivider_;
    int16_t  blockId_;
    uint32_t lengthOfBlock_;
    uint16_t numberOfLayers_;
 
-   std::vector<std::vector<std::shared_ptr<Packet>>> layerList_;
+   std::vector<std::vector<PacketRecord>> layerList_;
+
+   bool lazyPacketDecoding_ {false};
+
+   // Packet data of each layer, retained for lazy packet decoding
+   std::vector<char> packetData_ {};
+
+   mutable std::mutex packetMutex_ {};
 };
 
 ProductSymbologyBlock::ProductSymbologyBlock() :
@@ -58,10 +91,51 @@ uint16_t ProductSymbologyBlock::number_of_layers() const
    return p->numberOfLayers_;
 }
 
+std::size_t ProductSymbologyBlock::packet_count(std::uint16_t layer) const
+{
+   return (layer < p->layerList_.size()) ? p->layerList_[layer].size() : 0u;
+}
+
+std::uint16_t ProductSymbologyBlock::packet_code(std::uint16_t layer,
+                                                 std::size_t   i) const
+{
+   const auto* record = p->GetPacketRecord(layer, i);
+   return (record != nullptr) ? record->packetCode_ : 0u;
+}
+
+std::shared_ptr<Packet> ProductSymbologyBlock::packet(std::uint16_t layer,
+                                                      std::size_t   i) const
+{
+   const auto* record = p->GetPacketRecord(layer, i);
+   if (record == nullptr)
+   {
+      return nullptr;
+   }
+
+   std::unique_lock lock {p->packetMutex_};
+   return p->DecodePacket(*record);
+}
+
 std::vector<std::shared_ptr<Packet>>
 ProductSymbologyBlock::packet_list(uint16_t i) const
 {
-   return p->layerList_[i];
+   std::vector<std::shared_ptr<Packet>> packetList {};
+
+   std::unique_lock lock {p->packetMutex_};
+
+   const auto& layer = p->layerList_[i];
+   packetList.reserve(layer.size());
+
+   for (auto& record : layer)
+   {
+      std::shared_ptr<Packet> packet = p->DecodePacket(record);
+      if (packet != nullptr)
+      {
+         packetList.push_back(std::move(packet));
+      }
+   }
+
+   return packetList;
 }
 
 size_t ProductSymbologyBlock::data_size() const
@@ -69,6 +143,133 @@ size_t ProductSymbologyBlock::data_size() const
    return p->lengthOfBlock_;
 }
 
+void ProductSymbologyBlock::set_lazy_packet_decoding(bool lazyPacketDecoding)
+{
+   p->lazyPacketDecoding_ = lazyPacketDecoding;
+}
+
+const ProductSymbologyBlockImpl::PacketRecord*
+ProductSymbologyBlockImpl::GetPacketRecord(std::uint16_t layer,
+                                           std::size_t   i) const
+{
+   if (layer >= layerList_.size() || i >= layerList_[layer].size())
+   {
+      return nullptr;
+   }
+
+   return &layerList_[layer][i];
+}
+
+std::shared_ptr<Packet>
+ProductSymbologyBlockImpl::DecodePacket(const PacketRecord& record) const
+{
+   // Packet mutex must be locked prior to calling this function
+   if (!record.decoded_)
+   {
+      // Decode from the beginning of the packet through the end of the packet
+      // data, as if the packet were being read from the product
+      util::spanbuf packetBuffer {
+         std::span<const char> {packetData_}.subspan(record.offset_)};
+      std::istream is {&packetBuffer};
+
+      record.packet_  = PacketFactory::Create(is);
+      record.decoded_ = true;
+
+      if (record.packet_ == nullptr)
+      {
+         logger_->warn("Could not decode packet: {0} (0x{0:x})",
+                       record.packetCode_);
+      }
+      else if (record.packet_->data_size() != record.size_)
+      {
+         logger_->warn("Decoded packet size does not match: {} != {} bytes",
+                       record.packet_->data_size(),
+                       record.size_);
+      }
+   }
+
+   return record.packet_;
+}
+
+std::uint32_t ProductSymbologyBlockImpl::DecodePackets(
+   std::istream&              is,
+   std::uint32_t              lengthOfDataLayer,
+   std::vector<PacketRecord>& packetList)
+{
+   uint32_t bytesRead = 0;
+
+   while (bytesRead < lengthOfDataLayer)
+   {
+      std::shared_ptr<Packet> packet = PacketFactory::Create(is);
+      if (packet != nullptr)
+      {
+         const std::size_t packetSize = packet->data_size();
+
+         packetList.push_back({packet->packet_code(),
+                               0u,
+                               packetSize,
+                               true,
+                               std::move(packet)});
+         bytesRead += static_cast<uint32_t>(packetSize);
+      }
+      else
+      {
+         break;
+      }
+   }
+
+   return bytesRead;
+}
+
+std::uint32_t ProductSymbologyBlockImpl::RecordPackets(
+   std::istream&              is,
+   std::uint32_t              lengthOfDataLayer,
+   std::vector<PacketRecord>& packetList)
+{
+   // Read the layer at once, bounded by the length of the block
+   const std::size_t layerOffset = packetData_.size();
+   const std::size_t layerLength =
+      std::min<std::size_t>(lengthOfDataLayer, lengthOfBlock_);
+
+   packetData_.resize(layerOffset + layerLength);
+   is.read(packetData_.data() + layerOffset,
+           static_cast<std::streamsize>(layerLength));
+   packetData_.resize(layerOffset + static_cast<std::size_t>(is.gcount()));
+
+   const std::span<const char> layerData =
+      std::span<const char> {packetData_}.subspan(layerOffset);
+
+   // Record the code and location of each packet, without decoding
+   std::size_t bytesRead = 0;
+
+   while (bytesRead < layerData.size())
+   {
+      const std::span<const char> packetData = layerData.subspan(bytesRead);
+      const std::optional<std::size_t> packetSize =
+         PacketFactory::GetPacketSize(packetData);
+
+      if (!packetSize.has_value())
+      {
+         logger_->warn("Invalid packet: {0} (0x{0:x})",
+                       (packetData.size() >= 2) ?
+                          util::BigEndianReader::Decode<std::uint16_t>(
+                             packetData.data()) :
+                          0u);
+         break;
+      }
+
+      packetList.push_back(
+         {util::BigEndianReader::Decode<std::uint16_t>(packetData.data()),
+          layerOffset + bytesRead,
+          *packetSize,
+          false,
+          nullptr});
+      bytesRead += *packetSize;
+   }
+
+   return static_cast<std::uint32_t>(bytesRead);
+}
+
 bool ProductSymbologyBlock::Parse(std::istream& is)
 {
    bool blockValid = true;
@@ -123,8 +324,8 @@ bool ProductSymbologyBlock::Parse(std::istream& is)
       {
          logger_->trace("Layer {}", i);
 
-         std::vector<std::shared_ptr<Packet>> packetList;
-         uint32_t                             bytesRead = 0;
+         std::vector<ProductSymbologyBlockImpl::PacketRecord> packetList;
+         uint32_t                                              bytesRead = 0;
 
          is.read(reinterpret_cast<char*>(&layerDivider), 2);
          is.read(reinterpret_cast<char*>(&lengthOfDataLayer), 4);
@@ -136,18 +337,13 @@ bool ProductSymbologyBlock::Parse(std::istream& is)
          std::streampos layerEnd =
             layerStart + static_cast<std::streamoff>(lengthOfDataLayer);
 
-         while (bytesRead < lengthOfDataLayer)
+         if (p->lazyPacketDecoding_)
+         {
+            bytesRead = p->RecordPackets(is, lengthOfDataLayer, packetList);
+         }
+         else
          {
-            std::shared_ptr<Packet> packet = PacketFactory::Create(is);
-            if (packet != nullptr)
-            {
-               packetList.push_back(packet);
-               bytesRead += static_cast<uint32_t>(packet->data_size());
-            }
-            else
-            {
-               break;
-            }
+            bytesRead = p->DecodePackets(is, lengthOfDataLayer, packetList);
          }
 
          if (bytesRead < lengthOfDataLayer)
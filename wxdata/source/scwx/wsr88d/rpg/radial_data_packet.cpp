@@ -1,8 +1,12 @@
 #include <scwx/wsr88d/rpg/radial_data_packet.hpp>
+#include <scwx/util/big_endian_reader.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/run_length.hpp>
 
+#include <array>
 #include <istream>
 #include <string>
+#include <vector>
 
 namespace scwx
 {
@@ -14,25 +18,19 @@ namespace rpg
 static const std::string logPrefix_ = "scwx::wsr88d::rpg::radial_data_packet";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static constexpr std::size_t kPacketHeaderSize_ = 14;
+static constexpr std::size_t kRadialHeaderSize_ = 6;
+
 class RadialDataPacketImpl
 {
 public:
    struct Radial
    {
-      uint16_t             numberOfRleHalfwords_;
-      uint16_t             startAngle_;
-      uint16_t             angleDelta_;
-      std::vector<uint8_t> data_;
-      std::vector<uint8_t> level_;
-
-      Radial() :
-          numberOfRleHalfwords_ {0},
-          startAngle_ {0},
-          angleDelta_ {0},
-          data_ {},
-          level_ {}
-      {
-      }
+      uint16_t numberOfRleHalfwords_;
+      uint16_t startAngle_;
+      uint16_t angleDelta_;
+
+      Radial() : numberOfRleHalfwords_ {0}, startAngle_ {0}, angleDelta_ {0} {}
    };
 
    explicit RadialDataPacketImpl() :
@@ -43,6 +41,7 @@ public:
        jCenterOfSweep_ {0},
        scaleFactor_ {0},
        radial_ {},
+       level_ {},
        dataSize_ {0}
    {
    }
@@ -59,6 +58,10 @@ public:
    // Repeat for each radial
    std::vector<Radial> radial_;
 
+   // Levels of each radial, stored contiguously with a stride of the number of
+   // range bins
+   std::vector<uint8_t> level_;
+
    size_t dataSize_;
 };
 
@@ -117,9 +120,10 @@ float RadialDataPacket::delta_angle(uint16_t r) const
    return p->radial_[r].angleDelta_ * 0.1f;
 }
 
-const std::vector<uint8_t>& RadialDataPacket::level(uint16_t r) const
+std::span<const uint8_t> RadialDataPacket::level(uint16_t r) const
 {
-   return p->radial_[r].level_;
+   return std::span<const uint8_t> {p->level_}.subspan(
+      static_cast<size_t>(r) * p->numberOfRangeBins_, p->numberOfRangeBins_);
 }
 
 size_t RadialDataPacket::data_size() const
@@ -132,22 +136,20 @@ bool RadialDataPacket::Parse(std::istream& is)
    bool   blockValid = true;
    size_t bytesRead  = 0;
 
-   is.read(reinterpret_cast<char*>(&p->packetCode_), 2);
-   is.read(reinterpret_cast<char*>(&p->indexOfFirstRangeBin_), 2);
-   is.read(reinterpret_cast<char*>(&p->numberOfRangeBins_), 2);
-   is.read(reinterpret_cast<char*>(&p->iCenterOfSweep_), 2);
-   is.read(reinterpret_cast<char*>(&p->jCenterOfSweep_), 2);
-   is.read(reinterpret_cast<char*>(&p->scaleFactor_), 2);
-   is.read(reinterpret_cast<char*>(&p->numberOfRadials_), 2);
-   bytesRead += 14;
-
-   p->packetCode_           = ntohs(p->packetCode_);
-   p->indexOfFirstRangeBin_ = ntohs(p->indexOfFirstRangeBin_);
-   p->numberOfRangeBins_    = ntohs(p->numberOfRangeBins_);
-   p->iCenterOfSweep_       = ntohs(p->iCenterOfSweep_);
-   p->jCenterOfSweep_       = ntohs(p->jCenterOfSweep_);
-   p->scaleFactor_          = ntohs(p->scaleFactor_);
-   p->numberOfRadials_      = ntohs(p->numberOfRadials_);
+   // Read fixed length fields at once, and decode them from memory
+   std::array<char, kPacketHeaderSize_> packetHeader {};
+   is.read(packetHeader.data(), packetHeader.size());
+   bytesRead += packetHeader.size();
+
+   util::BigEndianReader headerReader {packetHeader};
+
+   p->packetCode_           = headerReader.Read<std::uint16_t>();
+   p->indexOfFirstRangeBin_ = headerReader.Read<std::uint16_t>();
+   p->numberOfRangeBins_    = headerReader.Read<std::uint16_t>();
+   p->iCenterOfSweep_       = headerReader.Read<std::int16_t>();
+   p->jCenterOfSweep_       = headerReader.Read<std::int16_t>();
+   p->scaleFactor_          = headerReader.Read<std::uint16_t>();
+   p->numberOfRadials_      = headerReader.Read<std::uint16_t>();
 
    if (is.eof())
    {
@@ -177,19 +179,24 @@ bool RadialDataPacket::Parse(std::istream& is)
    if (blockValid)
    {
       p->radial_.resize(p->numberOfRadials_);
+      p->level_.resize(static_cast<size_t>(p->numberOfRadials_) *
+                       p->numberOfRangeBins_);
+
+      std::vector<uint8_t> data {};
 
       for (uint16_t r = 0; r < p->numberOfRadials_; r++)
       {
          auto& radial = p->radial_[r];
 
-         is.read(reinterpret_cast<char*>(&radial.numberOfRleHalfwords_), 2);
-         is.read(reinterpret_cast<char*>(&radial.startAngle_), 2);
-         is.read(reinterpret_cast<char*>(&radial.angleDelta_), 2);
-         bytesRead += 6;
+         std::array<char, kRadialHeaderSize_> radialHeader {};
+         is.read(radialHeader.data(), radialHeader.size());
+         bytesRead += radialHeader.size();
 
-         radial.numberOfRleHalfwords_ = ntohs(radial.numberOfRleHalfwords_);
-         radial.startAngle_           = ntohs(radial.startAngle_);
-         radial.angleDelta_           = ntohs(radial.angleDelta_);
+         util::BigEndianReader radialReader {radialHeader};
+
+         radial.numberOfRleHalfwords_ = radialReader.Read<std::uint16_t>();
+         radial.startAngle_           = radialReader.Read<std::uint16_t>();
+         radial.angleDelta_           = radialReader.Read<std::uint16_t>();
 
          if (radial.numberOfRleHalfwords_ < 1 ||
              radial.numberOfRleHalfwords_ > 230)
@@ -203,30 +210,18 @@ bool RadialDataPacket::Parse(std::istream& is)
 
          // Read RLE halfwords
          size_t dataSize = radial.numberOfRleHalfwords_ * 2;
-         radial.data_.resize(dataSize);
-         is.read(reinterpret_cast<char*>(radial.data_.data()), dataSize);
+         data.resize(dataSize);
+         is.read(reinterpret_cast<char*>(data.data()), dataSize);
          bytesRead += dataSize;
 
-         // If the final byte is 0, truncate it
-         if (radial.data_.back() == 0)
-         {
-            radial.data_.pop_back();
-         }
-
-         // Unpack the levels from the Run Length Encoded data
-         radial.level_.resize(p->numberOfRangeBins_);
-
-         uint16_t b = 0;
-         for (auto it = radial.data_.cbegin(); it != radial.data_.cend(); it++)
-         {
-            uint8_t run   = *it >> 4;
-            uint8_t level = *it & 0x0f;
-
-            for (int i = 0; i < run && b < p->numberOfRangeBins_; i++)
-            {
-               radial.level_[b++] = level;
-            }
-         }
+         // Unpack the levels from the Run Length Encoded data directly into the
+         // radial's row of the level array. A final padding byte of 0 encodes
+         // no bins.
+         util::DecodeRunLength(
+            data,
+            std::span<uint8_t> {p->level_}.subspan(
+               static_cast<size_t>(r) * p->numberOfRangeBins_,
+               p->numberOfRangeBins_));
       }
    }
 
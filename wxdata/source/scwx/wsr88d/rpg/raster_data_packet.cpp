@@ -1,8 +1,12 @@
 #include <scwx/wsr88d/rpg/raster_data_packet.hpp>
+#include <scwx/util/big_endian_reader.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/run_length.hpp>
 
+#include <array>
 #include <istream>
 #include <string>
+#include <vector>
 
 namespace scwx
 {
@@ -14,16 +18,18 @@ namespace rpg
 static const std::string logPrefix_ = "scwx::wsr88d::rpg::raster_data_packet";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static constexpr std::size_t kPacketHeaderSize_ = 22;
+
 class RasterDataPacketImpl
 {
 public:
    struct Row
    {
-      uint16_t             numberOfBytes_;
-      std::vector<uint8_t> data_;
-      std::vector<uint8_t> level_;
+      uint16_t numberOfBytes_;
+      size_t   levelOffset_; // Offset into level array
+      size_t   levelSize_;
 
-      Row() : numberOfBytes_ {0}, data_ {}, level_ {} {}
+      Row() : numberOfBytes_ {0}, levelOffset_ {0}, levelSize_ {0} {}
    };
 
    explicit RasterDataPacketImpl() :
@@ -38,6 +44,7 @@ public:
        numberOfRows_ {0},
        packagingDescriptor_ {0},
        row_ {},
+       level_ {},
        dataSize_ {0}
    {
    }
@@ -57,6 +64,9 @@ public:
    // Repeat for each row
    std::vector<Row> row_;
 
+   // Levels of each row, stored contiguously
+   std::vector<uint8_t> level_;
+
    size_t dataSize_;
 };
 
@@ -120,9 +130,11 @@ uint16_t RasterDataPacket::packaging_descriptor() const
    return p->packagingDescriptor_;
 }
 
-const std::vector<uint8_t>& RasterDataPacket::level(uint16_t r) const
+std::span<const uint8_t> RasterDataPacket::level(uint16_t r) const
 {
-   return p->row_[r].level_;
+   const auto& row = p->row_[r];
+   return std::span<const uint8_t> {p->level_}.subspan(row.levelOffset_,
+                                                       row.levelSize_);
 }
 
 size_t RasterDataPacket::data_size() const
@@ -135,29 +147,23 @@ bool RasterDataPacket::Parse(std::istream& is)
    bool   blockValid = true;
    size_t bytesRead  = 0;
 
-   is.read(reinterpret_cast<char*>(&p->packetCode_), 2);
-   is.read(reinterpret_cast<char*>(p->opFlag_.data()), 4);
-   is.read(reinterpret_cast<char*>(&p->iCoordinateStart_), 2);
-   is.read(reinterpret_cast<char*>(&p->jCoordinateStart_), 2);
-   is.read(reinterpret_cast<char*>(&p->xScaleInt_), 2);
-   is.read(reinterpret_cast<char*>(&p->xScaleFractional_), 2);
-   is.read(reinterpret_cast<char*>(&p->yScaleInt_), 2);
-   is.read(reinterpret_cast<char*>(&p->yScaleFractional_), 2);
-   is.read(reinterpret_cast<char*>(&p->numberOfRows_), 2);
-   is.read(reinterpret_cast<char*>(&p->packagingDescriptor_), 2);
-   bytesRead += 22;
-
-   p->packetCode_          = ntohs(p->packetCode_);
-   p->iCoordinateStart_    = ntohs(p->iCoordinateStart_);
-   p->jCoordinateStart_    = ntohs(p->jCoordinateStart_);
-   p->xScaleInt_           = ntohs(p->xScaleInt_);
-   p->xScaleFractional_    = ntohs(p->xScaleFractional_);
-   p->yScaleInt_           = ntohs(p->yScaleInt_);
-   p->yScaleFractional_    = ntohs(p->yScaleFractional_);
-   p->numberOfRows_        = ntohs(p->numberOfRows_);
-   p->packagingDescriptor_ = ntohs(p->packagingDescriptor_);
-
-   SwapArray(p->opFlag_);
+   // Read fixed length fields at once, and decode them from memory
+   std::array<char, kPacketHeaderSize_> packetHeader {};
+   is.read(packetHeader.data(), packetHeader.size());
+   bytesRead += packetHeader.size();
+
+   util::BigEndianReader headerReader {packetHeader};
+
+   p->packetCode_ = headerReader.Read<std::uint16_t>();
+   headerReader.ReadArray(p->opFlag_);
+   p->iCoordinateStart_    = headerReader.Read<std::int16_t>();
+   p->jCoordinateStart_    = headerReader.Read<std::int16_t>();
+   p->xScaleInt_           = headerReader.Read<std::uint16_t>();
+   p->xScaleFractional_    = headerReader.Read<std::uint16_t>();
+   p->yScaleInt_           = headerReader.Read<std::uint16_t>();
+   p->yScaleFractional_    = headerReader.Read<std::uint16_t>();
+   p->numberOfRows_        = headerReader.Read<std::uint16_t>();
+   p->packagingDescriptor_ = headerReader.Read<std::uint16_t>();
 
    if (is.eof())
    {
@@ -182,6 +188,11 @@ bool RasterDataPacket::Parse(std::istream& is)
    {
       p->row_.resize(p->numberOfRows_);
 
+      // Read the Run Length Encoded data of each row into a single buffer
+      std::vector<uint8_t> data {};
+      std::vector<size_t>  dataOffset(p->numberOfRows_ + 1u, 0u);
+      size_t               levelSize = 0;
+
       for (uint16_t r = 0; r < p->numberOfRows_; r++)
       {
          auto& row = p->row_[r];
@@ -203,36 +214,37 @@ bool RasterDataPacket::Parse(std::istream& is)
 
          // Read row data
          size_t dataSize = row.numberOfBytes_;
-         row.data_.resize(dataSize);
-         is.read(reinterpret_cast<char*>(row.data_.data()), dataSize);
+         data.resize(dataOffset[r] + dataSize);
+         is.read(reinterpret_cast<char*>(data.data() + dataOffset[r]),
+                 dataSize);
          bytesRead += dataSize;
 
-         // If the final byte is 0, truncate it
-         if (row.data_.back() == 0)
-         {
-            row.data_.pop_back();
-         }
+         dataOffset[r + 1u] = dataOffset[r] + dataSize;
 
-         // Unpack the levels from the Run Length Encoded data
-         uint16_t binCount =
-            std::accumulate(row.data_.cbegin(),
-                            row.data_.cend(),
-                            static_cast<uint16_t>(0u),
-                            [](const uint16_t& a, const uint8_t& b) -> uint16_t
-                            { return a + (b >> 4); });
+         // Determine the location of the row in the level array. A final
+         // padding byte of 0 encodes no bins.
+         row.levelOffset_ = levelSize;
+         row.levelSize_   = util::GetRunLengthBinCount(
+            std::span<const uint8_t> {data}.subspan(dataOffset[r], dataSize));
 
-         row.level_.resize(binCount);
+         levelSize += row.levelSize_;
+      }
+
+      // Unpack the levels from the Run Length Encoded data directly into the
+      // contiguous level array
+      if (blockValid)
+      {
+         p->level_.resize(levelSize);
 
-         uint16_t b = 0;
-         for (auto it = row.data_.cbegin(); it != row.data_.cend(); it++)
+         for (uint16_t r = 0; r < p->numberOfRows_; r++)
          {
-            uint8_t run   = *it >> 4;
-            uint8_t level = *it & 0x0f;
+            const auto& row = p->row_[r];
 
-            for (int i = 0; i < run && b < binCount; i++)
-            {
-               row.level_[b++] = level;
-            }
+            util::DecodeRunLength(
+               std::span<const uint8_t> {data}.subspan(
+                  dataOffset[r], dataOffset[r + 1u] - dataOffset[r]),
+               std::span<uint8_t> {p->level_}.subspan(row.levelOffset_,
+                                                      row.levelSize_));
          }
       }
    }
@@ -0,0 +1,416 @@
+#include <scwx/wsr88d/volume_index.hpp>
+#include <scwx/util/azimuth_lookup.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <numbers>
+#include <numeric>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static const std::string logPrefix_ = "scwx::wsr88d::volume_index";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+static constexpr std::uint16_t RANGE_FOLDED = 1u;
+
+static constexpr double kDegreesToRadians_ = std::numbers::pi / 180.0;
+
+class VolumeIndex::Impl
+{
+public:
+   struct Cut
+   {
+      explicit Cut(float                                         elevation,
+                   std::shared_ptr<const rda::FlatElevationScan> scan);
+
+      std::optional<std::size_t>   FindGate(double distance) const;
+      std::optional<std::uint16_t> GetBinLevel(double      azimuth,
+                                               std::size_t gate) const;
+      std::optional<std::uint16_t> GetBinLevel(std::size_t radial,
+                                               std::size_t gate) const;
+
+      float                                         elevation_;
+      std::shared_ptr<const rda::FlatElevationScan> scan_;
+      std::shared_ptr<const rda::FlatElevationScan::MomentData> momentData_ {
+         nullptr};
+      std::unique_ptr<util::AzimuthLookup> azimuthLookup_ {nullptr};
+      std::uint16_t                        snrThreshold_ {0};
+
+      // Beam geometry, indexed by gate. Gate edges have one additional entry,
+      // for the far edge of the last gate.
+      std::vector<double> gateEdgeDistance_ {}; // Meters
+      std::vector<float>  gateHeight_ {};       // Meters
+      std::vector<float>  gateHalfWidth_ {};    // Meters
+   };
+
+   explicit Impl(rda::DataBlockType dataBlockType, float beamWidth) :
+       dataBlockType_ {dataBlockType}, beamWidth_ {beamWidth}
+   {
+   }
+   ~Impl() = default;
+
+   void IndexCut(Cut& cut) const;
+
+   rda::DataBlockType dataBlockType_;
+   float              beamWidth_;
+
+   std::vector<Cut>   cuts_ {};
+   std::vector<float> elevationCuts_ {};
+};
+
+VolumeIndex::VolumeIndex(const Ar2vFile&                       file,
+                         rda::DataBlockType                    dataBlockType,
+                         std::chrono::system_clock::time_point time,
+                         float                                 beamWidth) :
+    p(std::make_unique<Impl>(dataBlockType, beamWidth))
+{
+   std::vector<float> elevationCuts;
+   std::tie(std::ignore, std::ignore, elevationCuts) =
+      file.GetFlatElevationScan(dataBlockType, 0.0f, time);
+
+   std::sort(elevationCuts.begin(), elevationCuts.end());
+
+   for (float elevation : elevationCuts)
+   {
+      auto [scan, elevationCut, cuts] =
+         file.GetFlatElevationScan(dataBlockType, elevation, time);
+
+      if (scan != nullptr)
+      {
+         p->cuts_.emplace_back(elevationCut, std::move(scan));
+      }
+   }
+
+   // Moment matrices are built on first access, so each cut is indexed in
+   // parallel
+   std::for_each(std::execution::par,
+                 p->cuts_.begin(),
+                 p->cuts_.end(),
+                 [this](Impl::Cut& cut) { p->IndexCut(cut); });
+
+   // Remove cuts without the data moment
+   std::erase_if(p->cuts_,
+                 [](const Impl::Cut& cut)
+                 { return cut.momentData_ == nullptr; });
+
+   p->elevationCuts_.reserve(p->cuts_.size());
+   for (const auto& cut : p->cuts_)
+   {
+      p->elevationCuts_.push_back(cut.elevation_);
+   }
+
+   logger_->debug("Indexed {} cuts", p->cuts_.size());
+}
+
+VolumeIndex::~VolumeIndex() = default;
+
+VolumeIndex::VolumeIndex(VolumeIndex&&) noexcept            = default;
+VolumeIndex& VolumeIndex::operator=(VolumeIndex&&) noexcept = default;
+
+VolumeIndex::Impl::Cut::Cut(
+   float elevation, std::shared_ptr<const rda::FlatElevationScan> scan) :
+    elevation_ {elevation}, scan_ {std::move(scan)}
+{
+}
+
+void VolumeIndex::Impl::IndexCut(Cut& cut) const
+{
+   cut.momentData_ = cut.scan_->moment_data(dataBlockType_);
+
+   if (cut.momentData_ == nullptr)
+   {
+      return;
+   }
+
+   // Azimuth lookup table
+   const auto         radialHeaders = cut.scan_->radials();
+   std::vector<float> azimuths(radialHeaders.size());
+   std::transform(radialHeaders.begin(),
+                  radialHeaders.end(),
+                  azimuths.begin(),
+                  [](const auto& header) { return header.azimuthAngle_; });
+
+   cut.azimuthLookup_ = std::make_unique<util::AzimuthLookup>(azimuths);
+
+   // Threshold at which to display an individual bin (minimum of 2)
+   cut.snrThreshold_ = static_cast<std::uint16_t>(
+      std::max<std::int16_t>(2, cut.momentData_->snr_threshold_raw()));
+
+   // Beam height table
+   const std::uint16_t gates = cut.momentData_->gates();
+   const double        firstGateRange =
+      cut.momentData_->data_moment_range().value() * 1000.0;
+   const double gateInterval =
+      cut.momentData_->data_moment_range_sample_interval().value() * 1000.0;
+   const double halfBeamWidth =
+      std::tan(beamWidth_ * 0.5 * kDegreesToRadians_);
+
+   cut.gateEdgeDistance_.resize(gates + 1u);
+   cut.gateHeight_.resize(gates);
+   cut.gateHalfWidth_.resize(gates);
+
+   for (std::uint16_t gate = 0; gate <= gates; ++gate)
+   {
+      const double edgeRange =
+         std::max(0.0, firstGateRange + (gate - 0.5) * gateInterval);
+      cut.gateEdgeDistance_[gate] = BeamDistance(edgeRange, cut.elevation_);
+
+      if (gate < gates)
+      {
+         const double range = firstGateRange + gate * gateInterval;
+         cut.gateHeight_[gate] =
+            static_cast<float>(BeamHeight(range, cut.elevation_));
+         cut.gateHalfWidth_[gate] = static_cast<float>(range * halfBeamWidth);
+      }
+   }
+}
+
+std::optional<std::size_t>
+VolumeIndex::Impl::Cut::FindGate(double distance) const
+{
+   // Find the gate whose edges contain the distance
+   auto it = std::upper_bound(
+      gateEdgeDistance_.cbegin(), gateEdgeDistance_.cend(), distance);
+
+   if (it == gateEdgeDistance_.cbegin() || it == gateEdgeDistance_.cend())
+   {
+      // Distance is nearer or farther than the range of the cut
+      return std::nullopt;
+   }
+
+   return static_cast<std::size_t>(
+      std::distance(gateEdgeDistance_.cbegin(), it) - 1);
+}
+
+std::optional<std::uint16_t>
+VolumeIndex::Impl::Cut::GetBinLevel(double azimuth, std::size_t gate) const
+{
+   std::optional<std::size_t> radial = azimuthLookup_->FindRadial(azimuth);
+
+   if (!radial.has_value())
+   {
+      // No radial was found (not likely to happen without a gap in data)
+      return std::nullopt;
+   }
+
+   return GetBinLevel(*radial, gate);
+}
+
+std::optional<std::uint16_t>
+VolumeIndex::Impl::Cut::GetBinLevel(std::size_t radial, std::size_t gate) const
+{
+   const auto& momentRadial = momentData_->radials()[radial];
+
+   if (gate >= momentRadial.numberOfDataMomentGates_)
+   {
+      // Missing radial, or gate beyond the range of the radial
+      return std::nullopt;
+   }
+
+   std::uint16_t level;
+
+   if (momentData_->data_word_size() == 8)
+   {
+      level = reinterpret_cast<const std::uint8_t*>(
+         momentData_->data_moments(radial))[gate];
+   }
+   else
+   {
+      level = reinterpret_cast<const std::uint16_t*>(
+         momentData_->data_moments(radial))[gate];
+   }
+
+   if (level < snrThreshold_ && level != RANGE_FOLDED)
+   {
+      return std::nullopt;
+   }
+
+   return level;
+}
+
+rda::DataBlockType VolumeIndex::data_block_type() const
+{
+   return p->dataBlockType_;
+}
+
+std::size_t VolumeIndex::cut_count() const
+{
+   return p->cuts_.size();
+}
+
+std::span<const float> VolumeIndex::elevation_cuts() const
+{
+   return p->elevationCuts_;
+}
+
+std::shared_ptr<const rda::FlatElevationScan>
+VolumeIndex::elevation_scan(std::size_t cut) const
+{
+   return p->cuts_.at(cut).scan_;
+}
+
+float VolumeIndex::scale() const
+{
+   return p->cuts_.empty() ? 1.0f : p->cuts_.front().momentData_->scale();
+}
+
+float VolumeIndex::offset() const
+{
+   return p->cuts_.empty() ? 0.0f : p->cuts_.front().momentData_->offset();
+}
+
+double VolumeIndex::BeamHeight(double range, double elevation)
+{
+   constexpr double R = kEffectiveEarthRadius_;
+
+   const double sinElevation = std::sin(elevation * kDegreesToRadians_);
+
+   return std::sqrt(range * range + R * R + 2.0 * range * R * sinElevation) -
+          R;
+}
+
+double VolumeIndex::BeamDistance(double range, double elevation)
+{
+   constexpr double R = kEffectiveEarthRadius_;
+
+   const double cosElevation = std::cos(elevation * kDegreesToRadians_);
+   const double height       = BeamHeight(range, elevation);
+
+   return R * std::asin(range * cosElevation / (R + height));
+}
+
+std::optional<std::uint16_t>
+VolumeIndex::GetBinLevel(std::size_t cut, double azimuth, double distance) const
+{
+   const Impl::Cut& indexedCut = p->cuts_.at(cut);
+
+   std::optional<std::size_t> gate = indexedCut.FindGate(distance);
+
+   if (!gate.has_value())
+   {
+      return std::nullopt;
+   }
+
+   return indexedCut.GetBinLevel(azimuth, *gate);
+}
+
+std::vector<VolumeIndex::BeamSample>
+VolumeIndex::SampleRadial(double                  azimuth,
+                          std::span<const double> distances) const
+{
+   const std::size_t cuts = p->cuts_.size();
+
+   std::vector<BeamSample> beams(distances.size() * cuts);
+
+   for (std::size_t c = 0; c < cuts; ++c)
+   {
+      const Impl::Cut& cut = p->cuts_[c];
+
+      std::optional<std::size_t> radial =
+         cut.azimuthLookup_->FindRadial(azimuth);
+
+      for (std::size_t d = 0; d < distances.size(); ++d)
+      {
+         std::optional<std::size_t> gate = cut.FindGate(distances[d]);
+
+         if (!gate.has_value())
+         {
+            continue;
+         }
+
+         BeamSample& beam = beams[d * cuts + c];
+
+         beam.height_    = cut.gateHeight_[*gate];
+         beam.halfWidth_ = cut.gateHalfWidth_[*gate];
+         beam.valid_     = true;
+
+         if (radial.has_value())
+         {
+            beam.level_ = cut.GetBinLevel(*radial, *gate).value_or(0u);
+         }
+      }
+   }
+
+   return beams;
+}
+
+std::vector<std::uint16_t>
+VolumeIndex::SampleCrossSection(std::span<const PolarCoordinate> path,
+                                std::span<const double>          heights) const
+{
+   const std::size_t columns = path.size();
+
+   std::vector<std::uint16_t> levels(heights.size() * columns, 0u);
+
+   std::vector<std::size_t> columnIndices(columns);
+   std::iota(columnIndices.begin(), columnIndices.end(), 0u);
+
+   std::for_each(
+      std::execution::par,
+      columnIndices.cbegin(),
+      columnIndices.cend(),
+      [&](std::size_t column)
+      {
+         const PolarCoordinate& point = path[column];
+
+         // Sample every cut beneath the point. Beam heights increase with
+         // elevation, so the samples are ordered by height.
+         std::vector<BeamSample> beams {};
+         beams.reserve(p->cuts_.size());
+
+         for (const Impl::Cut& cut : p->cuts_)
+         {
+            std::optional<std::size_t> gate = cut.FindGate(point.distance_);
+
+            if (gate.has_value())
+            {
+               beams.push_back(
+                  {cut.gateHeight_[*gate],
+                   cut.gateHalfWidth_[*gate],
+                   cut.GetBinLevel(point.azimuth_, *gate).value_or(0u),
+                   true});
+            }
+         }
+
+         if (beams.empty())
+         {
+            return;
+         }
+
+         // Assign each height the level of the nearest beam covering it
+         for (std::size_t row = 0; row < heights.size(); ++row)
+         {
+            const double height = heights[row];
+
+            auto upper = std::lower_bound(
+               beams.cbegin(),
+               beams.cend(),
+               height,
+               [](const BeamSample& beam, double h)
+               { return beam.height_ < h; });
+
+            auto nearest = upper;
+            if (upper == beams.cend() ||
+                (upper != beams.cbegin() &&
+                 height - std::prev(upper)->height_ < upper->height_ - height))
+            {
+               nearest = std::prev(upper);
+            }
+
+            if (std::abs(nearest->height_ - height) <= nearest->halfWidth_)
+            {
+               levels[row * columns + column] = nearest->level_;
+            }
+         }
+      });
+
+   return levels;
+}
+
+} // namespace wsr88d
+} // namespace scwx
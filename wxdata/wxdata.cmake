@@ -7,6 +7,7 @@ find_package(cpr)
 find_package(LibXml2)
 find_package(re2)
 find_package(spdlog)
+find_package(ZLIB)
 
 if (NOT MSVC)
     find_package(TBB)
@@ -36,6 +37,7 @@ set(HDR_COMMON include/scwx/common/characters.hpp
                include/scwx/common/color_table.hpp
                include/scwx/common/constants.hpp
                include/scwx/common/geographic.hpp
+               include/scwx/common/mosaic_grid.hpp
                include/scwx/common/products.hpp
                include/scwx/common/sites.hpp
                include/scwx/common/types.hpp
@@ -43,6 +45,7 @@ set(HDR_COMMON include/scwx/common/characters.hpp
 set(SRC_COMMON source/scwx/common/characters.cpp
                source/scwx/common/color_table.cpp
                source/scwx/common/geographic.cpp
+               source/scwx/common/mosaic_grid.cpp
                source/scwx/common/products.cpp
                source/scwx/common/sites.cpp
                source/scwx/common/vcp.cpp)
@@ -55,57 +58,81 @@ set(HDR_NETWORK include/scwx/network/cpr.hpp
                 include/scwx/network/dir_list.hpp)
 set(SRC_NETWORK source/scwx/network/cpr.cpp
                 source/scwx/network/dir_list.cpp)
-set(HDR_PROVIDER include/scwx/provider/aws_level2_data_provider.hpp
+set(HDR_PROVIDER include/scwx/provider/aws_level2_chunks_data_provider.hpp
+                 include/scwx/provider/aws_level2_data_provider.hpp
                  include/scwx/provider/aws_level3_data_provider.hpp
                  include/scwx/provider/aws_nexrad_data_provider.hpp
+                 include/scwx/provider/level2_chunks_data_provider.hpp
+                 include/scwx/provider/local_level2_chunks_data_provider.hpp
                  include/scwx/provider/nexrad_data_provider.hpp
                  include/scwx/provider/nexrad_data_provider_factory.hpp
                  include/scwx/provider/warnings_provider.hpp)
-set(SRC_PROVIDER source/scwx/provider/aws_level2_data_provider.cpp
+set(SRC_PROVIDER source/scwx/provider/aws_level2_chunks_data_provider.cpp
+                 source/scwx/provider/aws_level2_data_provider.cpp
                  source/scwx/provider/aws_level3_data_provider.cpp
                  source/scwx/provider/aws_nexrad_data_provider.cpp
+                 source/scwx/provider/level2_chunks_data_provider.cpp
+                 source/scwx/provider/local_level2_chunks_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider_factory.cpp
                  source/scwx/provider/warnings_provider.cpp)
-set(HDR_UTIL include/scwx/util/digest.hpp
+set(HDR_UTIL include/scwx/util/azimuth_lookup.hpp
+             include/scwx/util/big_endian_reader.hpp
+             include/scwx/util/digest.hpp
              include/scwx/util/enum.hpp
              include/scwx/util/environment.hpp
              include/scwx/util/float.hpp
              include/scwx/util/hash.hpp
+             include/scwx/util/inflate.hpp
              include/scwx/util/iterator.hpp
              include/scwx/util/logger.hpp
              include/scwx/util/map.hpp
+             include/scwx/util/mapped_file.hpp
+             include/scwx/util/memory_arena.hpp
              include/scwx/util/rangebuf.hpp
+             include/scwx/util/run_length.hpp
+             include/scwx/util/spanbuf.hpp
              include/scwx/util/streams.hpp
              include/scwx/util/strings.hpp
              include/scwx/util/threads.hpp
              include/scwx/util/time.hpp
              include/scwx/util/vectorbuf.hpp)
-set(SRC_UTIL source/scwx/util/digest.cpp
+set(SRC_UTIL source/scwx/util/azimuth_lookup.cpp
+             source/scwx/util/digest.cpp
              source/scwx/util/environment.cpp
              source/scwx/util/float.cpp
              source/scwx/util/hash.cpp
+             source/scwx/util/inflate.cpp
              source/scwx/util/logger.cpp
+             source/scwx/util/mapped_file.cpp
+             source/scwx/util/memory_arena.cpp
              source/scwx/util/rangebuf.cpp
+             source/scwx/util/run_length.cpp
+             source/scwx/util/spanbuf.cpp
              source/scwx/util/streams.cpp
              source/scwx/util/strings.cpp
              source/scwx/util/time.cpp
              source/scwx/util/threads.cpp
              source/scwx/util/vectorbuf.cpp)
 set(HDR_WSR88D include/scwx/wsr88d/ar2v_file.hpp
+               include/scwx/wsr88d/derived_products.hpp
                include/scwx/wsr88d/level3_file.hpp
                include/scwx/wsr88d/nexrad_file.hpp
                include/scwx/wsr88d/nexrad_file_factory.hpp
+               include/scwx/wsr88d/volume_index.hpp
                include/scwx/wsr88d/wsr88d_types.hpp)
 set(SRC_WSR88D source/scwx/wsr88d/ar2v_file.cpp
+               source/scwx/wsr88d/derived_products.cpp
                source/scwx/wsr88d/level3_file.cpp
                source/scwx/wsr88d/nexrad_file.cpp
                source/scwx/wsr88d/nexrad_file_factory.cpp
+               source/scwx/wsr88d/volume_index.cpp
                source/scwx/wsr88d/wsr88d_types.cpp)
 set(HDR_WSR88D_RDA include/scwx/wsr88d/rda/clutter_filter_bypass_map.hpp
                    include/scwx/wsr88d/rda/clutter_filter_map.hpp
                    include/scwx/wsr88d/rda/digital_radar_data.hpp
                    include/scwx/wsr88d/rda/digital_radar_data_generic.hpp
+                   include/scwx/wsr88d/rda/flat_elevation_scan.hpp
                    include/scwx/wsr88d/rda/generic_radar_data.hpp
                    include/scwx/wsr88d/rda/level2_message.hpp
                    include/scwx/wsr88d/rda/level2_message_factory.hpp
@@ -119,6 +146,7 @@ set(SRC_WSR88D_RDA source/scwx/wsr88d/rda/clutter_filter_bypass_map.cpp
                    source/scwx/wsr88d/rda/clutter_filter_map.cpp
                    source/scwx/wsr88d/rda/digital_radar_data.cpp
                    source/scwx/wsr88d/rda/digital_radar_data_generic.cpp
+                   source/scwx/wsr88d/rda/flat_elevation_scan.cpp
                    source/scwx/wsr88d/rda/generic_radar_data.cpp
                    source/scwx/wsr88d/rda/level2_message.cpp
                    source/scwx/wsr88d/rda/level2_message_factory.cpp
@@ -146,6 +174,7 @@ set(HDR_WSR88D_RPG include/scwx/wsr88d/rpg/ccb_header.hpp
                    include/scwx/wsr88d/rpg/mesocyclone_symbol_packet.hpp
                    include/scwx/wsr88d/rpg/packet.hpp
                    include/scwx/wsr88d/rpg/packet_factory.hpp
+                   include/scwx/wsr88d/rpg/packet_index.hpp
                    include/scwx/wsr88d/rpg/point_feature_symbol_packet.hpp
                    include/scwx/wsr88d/rpg/point_graphic_symbol_packet.hpp
                    include/scwx/wsr88d/rpg/precipitation_rate_data_array_packet.hpp
@@ -187,6 +216,7 @@ set(SRC_WSR88D_RPG source/scwx/wsr88d/rpg/ccb_header.cpp
                    source/scwx/wsr88d/rpg/mesocyclone_symbol_packet.cpp
                    source/scwx/wsr88d/rpg/packet.cpp
                    source/scwx/wsr88d/rpg/packet_factory.cpp
+                   source/scwx/wsr88d/rpg/packet_index.cpp
                    source/scwx/wsr88d/rpg/point_feature_symbol_packet.cpp
                    source/scwx/wsr88d/rpg/point_graphic_symbol_packet.cpp
                    source/scwx/wsr88d/rpg/precipitation_rate_data_array_packet.cpp
@@ -282,7 +312,8 @@ target_link_libraries(wxdata PUBLIC aws-cpp-sdk-core
                                     LibXml2::LibXml2
                                     re2::re2
                                     spdlog::spdlog
-                                    units::units)
+                                    units::units
+                                    ZLIB::ZLIB)
 target_link_libraries(wxdata INTERFACE Boost::iostreams
                                        BZip2::BZip2
                                        hsluv-c)